@@ -0,0 +1,79 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Microbenchmark harness. The core (bench.c) is plain C with no IDF
+ * dependency beyond the cycle counter, so it builds for the host too:
+ *   target: CPU cycles (esp_cpu_get_cycle_count → mcycle on RISC-V)
+ *   host  : nanoseconds (clock_gettime(CLOCK_MONOTONIC))
+ *
+ * Each case runs `warmup` untimed reps, then `reps` timed reps of `iters`
+ * calls; the per-call cost is reported as median and MAD (median absolute
+ * deviation) over reps, and checked against a stored baseline.
+ *
+ * Output is line-oriented on stdout:
+ *   BENCH <suite>/<case> median=<n> mad=<n> min=<n> unit=<cycles|ns> [base=<n> +<pct>% REGRESSION]
+ * and, for pasting into bench_baselines.c:
+ *   BENCH-BASELINE { "<suite>/<case>", <median> },
+ */
+
+/** Body: perform the operation `iters` times. */
+typedef void (*bench_fn_t)(void *arg, uint32_t iters);
+
+typedef struct {
+    const char *name;
+    bench_fn_t  fn;
+    void       *arg;
+    uint32_t    iters;    // calls per timed rep (0 = 1)
+} bench_case_t;
+
+typedef struct {
+    uint32_t warmup;       // untimed reps
+    uint32_t reps;         // timed reps (≤ BENCH_MAX_REPS)
+    uint32_t regress_pct;  // median above baseline by more than this → regression
+} bench_cfg_t;
+
+#define BENCH_MAX_REPS 64
+#define BENCH_CFG_DEFAULT() { .warmup = 3, .reps = 15, .regress_pct = 10 }
+
+typedef struct {
+    uint64_t median;       // per call, in bench_unit()
+    uint64_t mad;
+    uint64_t min;
+} bench_result_t;
+
+typedef struct {
+    const char *name;      // "<suite>/<case>"
+    uint64_t    median;    // per call, in the unit of the platform it was recorded on
+} bench_baseline_t;
+
+/** Stored baselines (bench_baselines.c). */
+extern const bench_baseline_t bench_baselines[];
+extern const size_t           bench_baseline_count;
+
+uint64_t    bench_now(void);
+const char *bench_unit(void);
+
+void bench_run_case(const bench_case_t *c, const bench_cfg_t *cfg, bench_result_t *out);
+
+/**
+ * Run and report every case of a suite against bench_baselines.
+ * @return number of cases that regressed beyond cfg->regress_pct
+ */
+int bench_run_suite(const char *suite, const bench_case_t *cases, size_t n, const bench_cfg_t *cfg);
+
+/**
+ * Built-in suites (ui_gfx primitives, kernels, filter, color, font, util,
+ * timing). fb is scratch (w×h RGB565) and is overwritten.
+ * @return total regressions.
+ */
+int bench_run_all(uint16_t *fb, int w, int h, const bench_cfg_t *cfg);
+
+#ifdef __cplusplus
+}
+#endif
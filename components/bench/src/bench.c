@@ -0,0 +1,106 @@
+#include "bench/bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include "esp_cpu.h"
+
+uint64_t bench_now(void)
+{
+    return (uint64_t)esp_cpu_get_cycle_count();  // 32-bit; reps are far shorter than a wrap
+}
+
+const char *bench_unit(void)
+{
+    return "cycles";
+}
+#else
+#include <time.h>
+
+uint64_t bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+const char *bench_unit(void)
+{
+    return "ns";
+}
+#endif
+
+static int cmp_u64(const void *a, const void *b)
+{
+    const uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static uint64_t median_sorted(const uint64_t *v, uint32_t n)
+{
+    return (n & 1) ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+}
+
+void bench_run_case(const bench_case_t *c, const bench_cfg_t *cfg, bench_result_t *out)
+{
+    const uint32_t iters = c->iters ? c->iters : 1;
+    uint32_t reps = cfg->reps ? cfg->reps : 1;
+    if (reps > BENCH_MAX_REPS) reps = BENCH_MAX_REPS;
+
+    for (uint32_t i = 0; i < cfg->warmup; ++i) c->fn(c->arg, iters);
+
+    uint64_t t[BENCH_MAX_REPS];
+    for (uint32_t i = 0; i < reps; ++i) {
+        const uint64_t t0 = bench_now();
+        c->fn(c->arg, iters);
+        const uint64_t dt = bench_now() - t0;
+        t[i] = (dt & 0xFFFFFFFFu) / iters;   // mask: target counter is 32-bit
+    }
+    qsort(t, reps, sizeof(t[0]), cmp_u64);
+    out->min    = t[0];
+    out->median = median_sorted(t, reps);
+
+    for (uint32_t i = 0; i < reps; ++i) {
+        t[i] = t[i] > out->median ? t[i] - out->median : out->median - t[i];
+    }
+    qsort(t, reps, sizeof(t[0]), cmp_u64);
+    out->mad = median_sorted(t, reps);
+}
+
+static const bench_baseline_t *find_baseline(const char *suite, const char *name)
+{
+    const size_t sl = strlen(suite);
+    for (size_t i = 0; i < bench_baseline_count; ++i) {
+        const char *b = bench_baselines[i].name;
+        if (strncmp(b, suite, sl) == 0 && b[sl] == '/' && strcmp(b + sl + 1, name) == 0) {
+            return &bench_baselines[i];
+        }
+    }
+    return NULL;
+}
+
+int bench_run_suite(const char *suite, const bench_case_t *cases, size_t n, const bench_cfg_t *cfg)
+{
+    int regressions = 0;
+    for (size_t i = 0; i < n; ++i) {
+        bench_result_t r;
+        bench_run_case(&cases[i], cfg, &r);
+        printf("BENCH %s/%s median=%llu mad=%llu min=%llu unit=%s", suite, cases[i].name,
+               (unsigned long long)r.median, (unsigned long long)r.mad,
+               (unsigned long long)r.min, bench_unit());
+
+        const bench_baseline_t *b = find_baseline(suite, cases[i].name);
+        if (b && b->median) {
+            const long long pct = ((long long)r.median - (long long)b->median) * 100 / (long long)b->median;
+            const int bad = pct > (long long)cfg->regress_pct;
+            printf(" base=%llu %+lld%%%s", (unsigned long long)b->median, pct, bad ? " REGRESSION" : "");
+            regressions += bad;
+        }
+        putchar('\n');
+        printf("BENCH-BASELINE { \"%s/%s\", %llu },\n", suite, cases[i].name,
+               (unsigned long long)r.median);
+    }
+    return regressions;
+}
@@ -0,0 +1,49 @@
+#include "bench/bench.h"
+
+/*
+ * Per-call medians from a known-good run, one table per platform since the
+ * units differ (target: CPU cycles, host: ns). Refresh by pasting the
+ * BENCH-BASELINE lines of a run; cases without an entry are reported but
+ * never flagged. Keep the { NULL, 0 } terminator last.
+ */
+const bench_baseline_t bench_baselines[] = {
+#if defined(ESP_PLATFORM)
+    /* ESP32-P4: none recorded yet (kRunMicroBench on the board prints them) */
+#else
+    /* host_test bench_host, BENCH_CFG_DEFAULT, median of 3 runs on a 1-vCPU x86-64 Xeon */
+    { "ui_gfx/put_pixel",          3 },
+    { "ui_gfx/hline_full",         835 },
+    { "ui_gfx/vline_full",         3713 },
+    { "ui_gfx/fill_64x64",         11975 },
+    { "ui_gfx/fill_full",          1887962 },
+    { "ui_gfx/blit_64x64",         403 },
+    { "ui_gfx/crosshair_r20",      245 },
+    { "kernels/clear_generic",     1887339 },
+    { "kernels/clear",             2156144 },
+    { "kernels/pattern",           72535 },
+    { "kernels/copy_full",         207341 },
+    { "filter/tile_hash_32",       2327417 },
+    { "filter/tile_hash_64",       3211548 },
+    { "color/rgb888_none",         366502 },
+    { "color/rgb888_bayer4",       532401 },
+    { "color/rgb888_bayer8",       371356 },
+    { "color/rgb888_diffusion",    2384354 },
+    { "color/argb8888_bayer8",     550044 },
+    { "color/gradient_v",          465925 },
+    { "color/gradient_h",          319287 },
+    { "font/glyph_lookup",         6 },
+    { "font/char_opaque",          301 },
+    { "font/char_transparent",     147 },
+    { "font/text_30ch",            8986 },
+    { "util/dirty_rects_add",      331 },
+    { "util/latency_add",          4 },
+    { "util/anim_advance",         10 },
+    { "timing/now_us",             53 },
+    { "timing/sleep_500us_tick",   499979 },
+    { "timing/sleep_500us_timer",  565494 },
+    { "timing/sleep_periodic_1ms", 1015229 },
+#endif
+    { NULL, 0 },
+};
+
+const size_t bench_baseline_count = sizeof(bench_baselines) / sizeof(bench_baselines[0]) - 1;
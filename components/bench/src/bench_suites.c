@@ -0,0 +1,325 @@
+#include "bench/bench.h"
+
+#include <stdio.h>
+
+#include "ui_gfx/color_conv.h"
+#include "ui_gfx/ui_draw.h"
+#include "ui_gfx/font5x7.h"
+#include "ui_gfx/ui_kernels.h"
+#include "util/anim_clock.h"
+#include "util/dirty_rect.h"
+#include "util/fb.h"
+#include "util/latency.h"
+#include "util/tile_hash.h"
+#include "util/timing.h"
+
+/* Shared scratch for the ui_gfx cases. */
+typedef struct {
+    uint16_t *fb;
+    int       w, h;
+} surf_t;
+
+static surf_t s_surf;
+
+/* Second full-size buffer for the copy kernel. */
+static uint16_t *s_back;
+
+/* Source band for the color conversion cases (RGB888 or ARGB8888). */
+#define COLOR_BAND_ROWS 64
+static uint8_t *s_color_src;
+
+/* Keeps results observable so the compiler can't drop the loop. */
+static volatile uint32_t s_sink;
+
+/* ---- ui_gfx primitives ---- */
+static void b_put_pixel(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    for (uint32_t i = 0; i < n; ++i) ui_put_pixel565(s->fb, s->w, s->h, (int)(i % 256), (int)(i / 256 % 256), 0xF800);
+}
+
+static void b_hline(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    for (uint32_t i = 0; i < n; ++i) ui_draw_hline565(s->fb, s->w, s->h, 0, s->w - 1, (int)(i % (uint32_t)s->h), 0x07E0);
+}
+
+static void b_vline(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    for (uint32_t i = 0; i < n; ++i) ui_draw_vline565(s->fb, s->w, s->h, (int)(i % (uint32_t)s->w), 0, s->h - 1, 0x001F);
+}
+
+static void b_fill_tile(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    for (uint32_t i = 0; i < n; ++i) ui_fill_rect565(s->fb, s->w, s->h, 10, 10, 73, 73, (uint16_t)i);
+}
+
+static void b_fill_full(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    for (uint32_t i = 0; i < n; ++i) ui_fill_rect565(s->fb, s->w, s->h, 0, 0, s->w - 1, s->h - 1, (uint16_t)i);
+}
+
+static void b_blit_tile(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    /* Source: the first 64 rows of the surface, copied further down. */
+    for (uint32_t i = 0; i < n; ++i) ui_blit565(s->fb, s->w, s->h, 0, 128, s->fb, 64, 64);
+}
+
+static void b_crosshair(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    for (uint32_t i = 0; i < n; ++i) ui_draw_crosshair(s->fb, s->w, s->h, s->w / 2, s->h / 2, 20, 0xFFFF);
+}
+
+/* ---- whole-buffer kernels (clear: generic loop vs fixed-geometry dispatch) ---- */
+static const uint16_t kTile[4] = { 0xFFFF, 0x0000, 0x0000, 0xFFFF };  // 2×2 checker
+
+static void b_clear(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    for (uint32_t i = 0; i < n; ++i) ui_clear565(s->fb, s->w, s->h, (uint16_t)i);
+}
+
+static void b_pattern(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    for (uint32_t i = 0; i < n; ++i) ui_pattern_fill565(s->fb, s->w, s->h, kTile, 2, 2);
+}
+
+static void b_copy_full(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    for (uint32_t i = 0; i < n; ++i) ui_copy_rect565(s_back, s->fb, s->w, s->h, 0, 0, s->w - 1, s->h - 1);
+}
+
+static void b_generic(bench_fn_t fn, void *arg, uint32_t n)
+{
+    ui_kernels_set_specialized(false);
+    fn(arg, n);
+    ui_kernels_set_specialized(true);
+}
+
+static void b_clear_generic(void *arg, uint32_t n) { b_generic(b_clear, arg, n); }
+
+/* ---- present filter: hashing a whole frame by tiles (compare with a full present) ---- */
+static void hash_frame(const surf_t *s, int t, uint32_t n)
+{
+    uint32_t acc = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+        for (int y = 0; y < s->h; y += t) {
+            for (int x = 0; x < s->w; x += t) {
+                acc += tile_hash565(s->fb + (size_t)y * s->w + x, s->w,
+                                    (x + t <= s->w) ? t : s->w - x, (y + t <= s->h) ? t : s->h - y);
+            }
+        }
+    }
+    s_sink = acc;
+}
+
+static void b_hash_frame_32(void *arg, uint32_t n) { hash_frame(arg, 32, n); }
+static void b_hash_frame_64(void *arg, uint32_t n) { hash_frame(arg, 64, n); }
+
+/* ---- color conversion: one w×COLOR_BAND_ROWS band into the surface ---- */
+static void convert_band(const surf_t *s, uint32_t n, bool argb, ui_dither_t mode)
+{
+    for (uint32_t i = 0; i < n; ++i) {
+        if (argb) {
+            (void)ui_argb8888_to_565(s->fb, s->w, (const uint32_t *)s_color_src, s->w, s->w, COLOR_BAND_ROWS, mode);
+        } else {
+            (void)ui_rgb888_to_565(s->fb, s->w, s_color_src, s->w * 3, s->w, COLOR_BAND_ROWS, mode);
+        }
+    }
+}
+
+static void b_rgb888_none(void *arg, uint32_t n)      { convert_band(arg, n, false, UI_DITHER_NONE); }
+static void b_rgb888_bayer4(void *arg, uint32_t n)    { convert_band(arg, n, false, UI_DITHER_BAYER4); }
+static void b_rgb888_bayer8(void *arg, uint32_t n)    { convert_band(arg, n, false, UI_DITHER_BAYER8); }
+static void b_rgb888_diffusion(void *arg, uint32_t n) { convert_band(arg, n, false, UI_DITHER_DIFFUSION); }
+static void b_argb8888_bayer8(void *arg, uint32_t n)  { convert_band(arg, n, true, UI_DITHER_BAYER8); }
+
+static void b_gradient_v(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    for (uint32_t i = 0; i < n; ++i) {
+        ui_gradient_fill565(s->fb, s->w, s->h, 0, 0, s->w - 1, s->h - 1, 0x000000, 0x00FF00, true, UI_DITHER_BAYER8);
+    }
+}
+
+static void b_gradient_h(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    for (uint32_t i = 0; i < n; ++i) {
+        ui_gradient_fill565(s->fb, s->w, s->h, 0, 0, s->w - 1, s->h - 1, 0xFF0000, 0x0000FF, false, UI_DITHER_BAYER8);
+    }
+}
+
+/* ---- font ---- */
+static void b_glyph(void *arg, uint32_t n)
+{
+    uint32_t acc = 0;
+    for (uint32_t i = 0; i < n; ++i) acc += ui_gfx_font5x7_glyph((char)(32 + i % 95))[0];
+    s_sink = acc;
+}
+
+static void b_char_opaque(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    for (uint32_t i = 0; i < n; ++i) ui_draw_char5x7(s->fb, s->w, s->h, 8, 8, (char)('A' + i % 26), 0xFFFF, 0x0000);
+}
+
+static void b_char_transparent(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    for (uint32_t i = 0; i < n; ++i) {
+        ui_draw_char5x7(s->fb, s->w, s->h, 8, 8, (char)('A' + i % 26), 0xFFFF, UI_GFX_BG_TRANSPARENT);
+    }
+}
+
+static void b_text_line(void *arg, uint32_t n)
+{
+    const surf_t *s = arg;
+    for (uint32_t i = 0; i < n; ++i) {
+        s_sink = (uint32_t)ui_draw_text5x7(s->fb, s->w, s->h, 4, 40, "The quick brown fox 0123456789",
+                                           0xFFFF, 0x0000);
+    }
+}
+
+/* ---- util ---- */
+static void b_dirty_add(void *arg, uint32_t n)
+{
+    dirty_rects_t d;
+    for (uint32_t i = 0; i < n; ++i) {
+        if ((i & 63) == 0) dirty_rects_reset(&d, 8);
+        const int x = (int)((i * 37) % 760), y = (int)((i * 91) % 1240);
+        dirty_rects_add(&d, x, y, x + 12, y + 12);
+    }
+    s_sink = (uint32_t)d.n;
+}
+
+static void b_latency_add(void *arg, uint32_t n)
+{
+    static latency_hist_t h;
+    for (uint32_t i = 0; i < n; ++i) latency_hist_add(&h, i);
+}
+
+static void b_anim_advance(void *arg, uint32_t n)
+{
+    anim_clock_t c;
+    anim_clock_init(&c, 10000, 8, 0);
+    uint32_t acc = 0;
+    for (uint32_t i = 0; i < n; ++i) acc += anim_clock_advance(&c, (uint64_t)i * 4000);
+    s_sink = acc;
+}
+
+/* ---- timing ---- */
+static void b_now_us(void *arg, uint32_t n)
+{
+    uint64_t acc = 0;
+    for (uint32_t i = 0; i < n; ++i) acc += timing_now_us();
+    s_sink = (uint32_t)acc;
+}
+
+static void b_sleep_mode(void *arg, uint32_t n, timing_sleep_mode_t mode)
+{
+    const timing_sleep_mode_t prev = timing_get_sleep_mode();
+    timing_set_sleep_mode(mode, TIMING_FINAL_SPIN_US);
+    for (uint32_t i = 0; i < n; ++i) (void)timing_sleep_until_abs_us(timing_now_us() + 500);
+    timing_set_sleep_mode(prev, TIMING_FINAL_SPIN_US);
+}
+
+static void b_sleep_500us_tick(void *arg, uint32_t n)  { b_sleep_mode(arg, n, TIMING_SLEEP_TICK_SPIN); }
+static void b_sleep_500us_timer(void *arg, uint32_t n) { b_sleep_mode(arg, n, TIMING_SLEEP_TIMER); }
+
+static void b_sleep_periodic(void *arg, uint32_t n)
+{
+    uint64_t next = 0;
+    for (uint32_t i = 0; i < n; ++i) (void)timing_sleep_periodic_us(&next, 1000);
+}
+
+int bench_run_all(uint16_t *fb, int w, int h, const bench_cfg_t *cfg)
+{
+    if (!fb || w < 256 || h < 256) return 0;
+    s_surf = (surf_t){ .fb = fb, .w = w, .h = h };
+
+    const bench_case_t gfx[] = {
+        { "put_pixel",       b_put_pixel,   &s_surf, 4096 },
+        { "hline_full",      b_hline,       &s_surf, 256  },
+        { "vline_full",      b_vline,       &s_surf, 256  },
+        { "fill_64x64",      b_fill_tile,   &s_surf, 64   },
+        { "fill_full",       b_fill_full,   &s_surf, 2    },
+        { "blit_64x64",      b_blit_tile,   &s_surf, 64   },
+        { "crosshair_r20",   b_crosshair,   &s_surf, 256  },
+    };
+    const bench_case_t kernels[] = {
+        { "clear_generic", b_clear_generic, &s_surf, 2 },
+        { "clear",         b_clear,         &s_surf, 2 },
+        { "pattern",       b_pattern,       &s_surf, 2 },
+        { "copy_full",     b_copy_full,     &s_surf, 2 },
+    };
+    const bench_case_t filter[] = {
+        { "tile_hash_32", b_hash_frame_32, &s_surf, 1 },
+        { "tile_hash_64", b_hash_frame_64, &s_surf, 1 },
+    };
+    const bench_case_t color[] = {
+        { "rgb888_none",      b_rgb888_none,      &s_surf, 2 },
+        { "rgb888_bayer4",    b_rgb888_bayer4,    &s_surf, 2 },
+        { "rgb888_bayer8",    b_rgb888_bayer8,    &s_surf, 2 },
+        { "rgb888_diffusion", b_rgb888_diffusion, &s_surf, 1 },
+        { "argb8888_bayer8",  b_argb8888_bayer8,  &s_surf, 2 },
+        { "gradient_v",       b_gradient_v,       &s_surf, 1 },
+        { "gradient_h",       b_gradient_h,       &s_surf, 1 },
+    };
+    const bench_case_t font[] = {
+        { "glyph_lookup",    b_glyph,            NULL,    4096 },
+        { "char_opaque",     b_char_opaque,      &s_surf, 1024 },
+        { "char_transparent", b_char_transparent, &s_surf, 1024 },
+        { "text_30ch",       b_text_line,        &s_surf, 64   },
+    };
+    const bench_case_t util[] = {
+        { "dirty_rects_add", b_dirty_add,    NULL, 1024 },
+        { "latency_add",     b_latency_add,  NULL, 4096 },
+        { "anim_advance",    b_anim_advance, NULL, 4096 },
+    };
+    const bench_case_t timing[] = {
+        { "now_us",             b_now_us,            NULL, 1024 },
+        { "sleep_500us_tick",   b_sleep_500us_tick,  NULL, 4    },
+        { "sleep_500us_timer",  b_sleep_500us_timer, NULL, 4    },
+        { "sleep_periodic_1ms", b_sleep_periodic,    NULL, 4    },
+    };
+
+    int bad = 0;
+    bad += bench_run_suite("ui_gfx", gfx,    sizeof(gfx) / sizeof(gfx[0]),       cfg);
+    if (!ui_kernels_fixed_for(w, h)) {
+        printf("BENCH kernels: no fixed-geometry build for %dx%d, both clears are generic\n", w, h);
+    }
+    s_back = util_malloc_psram_dma((size_t)w * (size_t)h * sizeof(uint16_t));
+    if (s_back) {
+        bad += bench_run_suite("kernels", kernels, sizeof(kernels) / sizeof(kernels[0]), cfg);
+        util_free_psram_dma(s_back);
+        s_back = NULL;
+    } else {
+        bad += bench_run_suite("kernels", kernels, 3, cfg);  // copy needs a second buffer
+    }
+    bad += bench_run_suite("filter", filter, sizeof(filter) / sizeof(filter[0]), cfg);
+    s_color_src = util_malloc_psram_dma((size_t)w * COLOR_BAND_ROWS * 4);
+    if (s_color_src) {
+        uint32_t x = 0x12345678u;  // xorshift noise: no runs for the dither to coast on
+        for (size_t i = 0; i < (size_t)w * COLOR_BAND_ROWS * 4; ++i) {
+            x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+            s_color_src[i] = (uint8_t)x;
+        }
+        bad += bench_run_suite("color", color, sizeof(color) / sizeof(color[0]), cfg);
+        util_free_psram_dma(s_color_src);
+        s_color_src = NULL;
+    } else {
+        bad += bench_run_suite("color", &color[5], 2, cfg);  // gradients need no source band
+    }
+    bad += bench_run_suite("font",   font,   sizeof(font) / sizeof(font[0]),     cfg);
+    bad += bench_run_suite("util",   util,   sizeof(util) / sizeof(util[0]),     cfg);
+    bad += bench_run_suite("timing", timing, sizeof(timing) / sizeof(timing[0]), cfg);
+    return bad;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "display_panel/display.h"
+#include "demos/demos.h"
+
+typedef enum {
+    DEMO_BENCH_OUT_LOG = 0,   // human-readable ESP_LOG lines only
+    DEMO_BENCH_OUT_CSV,       // plus one "demo_bench,..." CSV line per demo on stdout
+    DEMO_BENCH_OUT_JSON,      // plus one JSON object per demo on stdout
+} demo_bench_output_t;
+
+typedef struct {
+    uint32_t            frames;   // measured steps per demo
+    uint32_t            warmup;   // steps run before measuring (caches, first full present)
+    demo_bench_output_t output;
+} demo_bench_cfg_t;
+
+#define DEMO_BENCH_CFG_DEFAULT() { .frames = 300, .warmup = 10, .output = DEMO_BENCH_OUT_LOG }
+
+typedef struct {
+    const char *name;
+    uint32_t    frames;
+    uint32_t    fps_x100;          // measured steps per second ×100
+    uint32_t    render_us_avg;     // step time not spent presenting
+    uint32_t    present_us_avg;    // time inside demo_present()
+    uint32_t    px_per_frame;      // pixels handed to the panel per step
+    uint32_t    bytes_per_frame;   // px_per_frame × 2 (RGB565)
+    uint32_t    p50_us, p95_us, p99_us, max_us;  // whole-step times
+} demo_bench_result_t;
+
+/**
+ * Run one demo unpaced for cfg->frames steps (after cfg->warmup) and fill *out.
+ * The panel shows the demo while it runs. Returns ESP_ERR_NO_MEM if the
+ * per-frame sample buffer can't be allocated.
+ */
+esp_err_t demo_bench_run(const demo_desc_t *desc, display_handle_t d, uint16_t *fb,
+                         const demo_bench_cfg_t *cfg, demo_bench_result_t *out);
+
+/** Benchmark every built-in demo in order and report each result per cfg->output. */
+void demo_bench_run_all(display_handle_t d, uint16_t *fb, const demo_bench_cfg_t *cfg);
+
+#ifdef __cplusplus
+}
+#endif
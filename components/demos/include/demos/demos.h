@@ -3,13 +3,89 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "display_panel/display.h"
+#include "util/arena.h"
+
+/**
+ * Per-run context handed to a frame-stepped demo.
+ * Demos draw into fb and present through d; state is demo-private.
+ */
+typedef struct {
+    display_handle_t d;
+    uint16_t        *fb;
+    int              W, H;
+    uint64_t         t_start_us;
+    uint64_t         t_end_us;     // step() should return false once now >= t_end_us
+    uint32_t         frame;        // step() calls so far
+    void            *state;
+
+    bool             unpaced;      // benchmark: no deadline; static demos redraw every step
+    arena_frame_t    scratch;      // this frame's arena scratch (released once its presents land)
+
+    /* Accumulated by demo_present() (reset by demo_begin()). */
+    uint32_t         present_calls;
+    uint64_t         present_us;
+    uint64_t         present_px;
+} demo_ctx_t;
+
+/**
+ * Frame-stepped demo: start() once, step() once per frame until it returns
+ * false, then stop(). stop() also runs when the demo is cancelled early, so it
+ * must restore anything start()/step() changed (panel power, buffers).
+ * start() may leave ctx->state NULL when it fails; step() then just returns false.
+ */
+typedef struct {
+    const char *name;
+    uint32_t    frame_us;          // preferred frame period; 0 = caller's default
+    void (*start)(demo_ctx_t *c);
+    bool (*step)(demo_ctx_t *c, uint64_t now_us);
+    void (*stop)(demo_ctx_t *c);   // optional
+} demo_desc_t;
+
+extern const demo_desc_t demo_color_bars_desc;
+extern const demo_desc_t demo_vertical_gradient_desc;
+extern const demo_desc_t demo_bounce_desc;
+extern const demo_desc_t demo_checker_sleep_wake_desc;
+extern const demo_desc_t demo_particles_desc;
+extern const demo_desc_t demo_plasma_desc;
+extern const demo_desc_t demo_anim_desc;
+extern const demo_desc_t demo_slideshow_desc;
+
+/** Built-in demos in menu order. */
+int                demos_count(void);
+const demo_desc_t *demos_get(int index);
+
+/**
+ * Present a region through the context (display_draw_bitmap semantics:
+ * x1/y1 exclusive) and account its time and pixels.
+ */
+esp_err_t demo_present(demo_ctx_t *c, int x0, int y0, int x1, int y1, const void *buf);
+
+/** True while the demo should keep running (deadline not reached, or unpaced). */
+static inline bool demo_running(const demo_ctx_t *c, uint64_t now_us)
+{
+    return c->unpaced || now_us < c->t_end_us;
+}
+
+/** Fill ctx and call desc->start(). */
+void demo_begin(const demo_desc_t *desc, demo_ctx_t *c,
+                display_handle_t d, uint16_t *fb, int seconds);
+
+/** Advance one frame; false when the demo has finished. */
+bool demo_step(const demo_desc_t *desc, demo_ctx_t *c, uint64_t now_us);
+
+/** Finish or cancel: call desc->stop() if present. */
+void demo_end(const demo_desc_t *desc, demo_ctx_t *c);
+
+/** Run a demo to completion on the calling task (paced at desc->frame_us). */
+void demo_run_blocking(const demo_desc_t *desc, display_handle_t d, uint16_t *fb, int seconds);
 
 /* Draw 7 vertical color bars and hold for N seconds. */
 void demo_color_bars(display_handle_t d, uint16_t *fb, int seconds);
 
-/* Vertical green gradient (top→bottom), then hold for N seconds. */
+/* Dithered vertical green gradient (top→bottom), then hold for N seconds. */
 void demo_vertical_gradient(display_handle_t d, uint16_t *fb, int seconds);
 
 /* Animate a bouncing square for N seconds; uses partial blits when reasonable. */
@@ -18,6 +94,21 @@ void demo_bounce_seconds(display_handle_t d, uint16_t *fb, int seconds);
 /* Draw checkerboard, briefly sleep the panel, then wake and hold until deadline. */
 void demo_checker_sleep_wake(display_handle_t d, uint16_t *fb, int seconds);
 
+/* Ramp hundreds→thousands of bouncing sprites; logs where 60 fps is first missed. */
+void demo_particles(display_handle_t d, uint16_t *fb, int seconds);
+
+/* Full-screen fixed-point plasma (compute-bound); logs fps and render/present split. */
+void demo_plasma(display_handle_t d, uint16_t *fb, int seconds);
+
+/* Play the image sequence in the "anim" data partition (zero-copy where possible). */
+void demo_anim(display_handle_t d, uint16_t *fb, int seconds);
+
+/* Photo slideshow from the "photos" partition (read/decode pipelined ahead of the display). */
+void demo_slideshow(display_handle_t d, uint16_t *fb, int seconds);
+
+/* Take the slideshow's photos from a directory instead (NULL: the partition again); not copied. */
+void demo_slideshow_set_dir(const char *dir);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -0,0 +1,139 @@
+#include "demos/demo_bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "util/arena.h"
+#include "util/mem.h"
+#include "util/timing.h"
+
+static const char *TAG = "demo_bench";
+
+static int cmp_u32(const void *a, const void *b)
+{
+    const uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/* Nearest-rank percentile over a sorted array. */
+static uint32_t pct(const uint32_t *sorted, uint32_t n, uint32_t p)
+{
+    uint32_t rank = (p * n + 99) / 100;
+    if (rank < 1) rank = 1;
+    return sorted[rank - 1];
+}
+
+esp_err_t demo_bench_run(const demo_desc_t *desc, display_handle_t d, uint16_t *fb,
+                         const demo_bench_cfg_t *cfg, demo_bench_result_t *out)
+{
+    ESP_RETURN_ON_FALSE(desc && d && fb && cfg && out && cfg->frames > 0,
+                        ESP_ERR_INVALID_ARG, TAG, "bad args");
+
+    uint32_t *step_us = mem_malloc(MEM_TAG_DEMOS, cfg->frames * sizeof(uint32_t), MALLOC_CAP_DEFAULT);
+    ESP_RETURN_ON_FALSE(step_us, ESP_ERR_NO_MEM, TAG, "no mem for %u samples",
+                        (unsigned)cfg->frames);
+
+    demo_ctx_t c;
+    demo_begin(desc, &c, d, fb, 0);
+    c.unpaced = true;
+
+    bool alive = true;
+    for (uint32_t i = 0; alive && i < cfg->warmup; ++i) {
+        alive = demo_step(desc, &c, timing_now_us());
+    }
+
+    /* Only the measured window counts toward present totals. */
+    c.present_calls = 0;
+    c.present_us    = 0;
+    c.present_px    = 0;
+
+    uint32_t n = 0;
+    const uint64_t t_begin = timing_now_us();
+    while (alive && n < cfg->frames) {
+        const uint64_t t0 = timing_now_us();
+        alive = demo_step(desc, &c, t0);
+        step_us[n++] = (uint32_t)(timing_now_us() - t0);
+    }
+    const uint64_t elapsed = timing_now_us() - t_begin;
+    demo_end(desc, &c);
+
+    *out = (demo_bench_result_t){ .name = desc->name, .frames = n };
+    if (n > 0) {
+        const uint64_t present_avg = c.present_us / n;
+        const uint64_t step_avg    = elapsed / n;
+        out->fps_x100        = elapsed ? (uint32_t)((uint64_t)n * 100000000ULL / elapsed) : 0;
+        out->present_us_avg  = (uint32_t)present_avg;
+        out->render_us_avg   = step_avg > present_avg ? (uint32_t)(step_avg - present_avg) : 0;
+        out->px_per_frame    = (uint32_t)(c.present_px / n);
+        out->bytes_per_frame = out->px_per_frame * (uint32_t)sizeof(uint16_t);
+
+        qsort(step_us, n, sizeof(uint32_t), cmp_u32);
+        out->p50_us = pct(step_us, n, 50);
+        out->p95_us = pct(step_us, n, 95);
+        out->p99_us = pct(step_us, n, 99);
+        out->max_us = step_us[n - 1];
+    }
+    mem_free(MEM_TAG_DEMOS, step_us);
+    return ESP_OK;
+}
+
+static void report(const demo_bench_result_t *r, demo_bench_output_t output)
+{
+    ESP_LOGI(TAG, "%-11s %4u frames %3u.%02u fps  render %5u us  present %5u us  "
+                  "%7u px (%u B)/frame  p50 %u p95 %u p99 %u max %u us",
+             r->name, (unsigned)r->frames,
+             (unsigned)(r->fps_x100 / 100), (unsigned)(r->fps_x100 % 100),
+             (unsigned)r->render_us_avg, (unsigned)r->present_us_avg,
+             (unsigned)r->px_per_frame, (unsigned)r->bytes_per_frame,
+             (unsigned)r->p50_us, (unsigned)r->p95_us, (unsigned)r->p99_us,
+             (unsigned)r->max_us);
+
+    /* Plain stdout so log prefixes/colours don't get in the way of parsers. */
+    if (output == DEMO_BENCH_OUT_CSV) {
+        printf("demo_bench,%s,%u,%u.%02u,%u,%u,%u,%u,%u,%u,%u,%u\n",
+               r->name, (unsigned)r->frames,
+               (unsigned)(r->fps_x100 / 100), (unsigned)(r->fps_x100 % 100),
+               (unsigned)r->render_us_avg, (unsigned)r->present_us_avg,
+               (unsigned)r->px_per_frame, (unsigned)r->bytes_per_frame,
+               (unsigned)r->p50_us, (unsigned)r->p95_us, (unsigned)r->p99_us,
+               (unsigned)r->max_us);
+    } else if (output == DEMO_BENCH_OUT_JSON) {
+        printf("{\"demo\":\"%s\",\"frames\":%u,\"fps\":%u.%02u,\"render_us\":%u,"
+               "\"present_us\":%u,\"px_per_frame\":%u,\"bytes_per_frame\":%u,"
+               "\"p50_us\":%u,\"p95_us\":%u,\"p99_us\":%u,\"max_us\":%u}\n",
+               r->name, (unsigned)r->frames,
+               (unsigned)(r->fps_x100 / 100), (unsigned)(r->fps_x100 % 100),
+               (unsigned)r->render_us_avg, (unsigned)r->present_us_avg,
+               (unsigned)r->px_per_frame, (unsigned)r->bytes_per_frame,
+               (unsigned)r->p50_us, (unsigned)r->p95_us, (unsigned)r->p99_us,
+               (unsigned)r->max_us);
+    }
+}
+
+void demo_bench_run_all(display_handle_t d, uint16_t *fb, const demo_bench_cfg_t *cfg)
+{
+    if (cfg->output == DEMO_BENCH_OUT_CSV) {
+        printf("demo_bench,demo,frames,fps,render_us,present_us,px_per_frame,"
+               "bytes_per_frame,p50_us,p95_us,p99_us,max_us\n");
+    }
+    for (int i = 0; i < demos_count(); ++i) {
+        demo_bench_result_t r;
+        const esp_err_t err = demo_bench_run(demos_get(i), d, fb, cfg, &r);
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "%s: %s", demos_get(i)->name, esp_err_to_name(err));
+            continue;
+        }
+        report(&r, cfg->output);
+    }
+
+    static const char *const kRegion[ARENA_REGION_COUNT] = { "internal", "psram" };
+    for (int i = 0; i < ARENA_REGION_COUNT; ++i) {
+        arena_stats_t as;
+        arena_get_stats((arena_region_t)i, &as);
+        ESP_LOGI(TAG, "arena %-8s high water %u / %u B, %u failed requests",
+                 kRegion[i], (unsigned)as.high_water, (unsigned)as.capacity, (unsigned)as.failures);
+    }
+}
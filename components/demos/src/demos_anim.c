@@ -0,0 +1,120 @@
+#include <string.h>
+#include "esp_log.h"
+#include "demos/demos.h"
+#include "image/img_seq.h"
+#include "util/timing.h"
+
+static const char *TAG = "demo_anim";
+
+/* Data partition holding an ISEQ blob (see partitions.csv, tools/mkseq.py). */
+#ifndef ANIM_PARTITION_LABEL
+#define ANIM_PARTITION_LABEL "anim"
+#endif
+
+typedef struct {
+    img_seq_handle_t seq;
+    img_seq_info_t   info;
+    int              x, y;       // centred on the panel
+    uint64_t         due_us;
+    uint32_t         shown, late;
+    uint64_t         first_us, last_us;   // first and last frame out
+    uint64_t         present_us_sum;
+    uint64_t         px_sum, zero_copy_px_sum;
+} anim_state_t;
+
+static anim_state_t s_anim;
+
+static void anim_start(demo_ctx_t *c)
+{
+    anim_state_t *a = &s_anim;
+    memset(a, 0, sizeof(*a));
+    esp_err_t err = img_seq_open_partition(ANIM_PARTITION_LABEL, &a->seq);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "no playable sequence in '%s': %s", ANIM_PARTITION_LABEL, esp_err_to_name(err));
+        return;
+    }
+    img_seq_get_info(a->seq, &a->info);
+    if (a->info.width > c->W || a->info.height > c->H) {
+        ESP_LOGW(TAG, "sequence %dx%d larger than panel", a->info.width, a->info.height);
+        img_seq_close(a->seq);
+        a->seq = NULL;
+        return;
+    }
+
+    /* Clear the margins once; frames only ever cover the sequence area. */
+    if (a->info.width < c->W || a->info.height < c->H) {
+        memset(c->fb, 0, (size_t)c->W * c->H * sizeof(uint16_t));
+        (void)demo_present(c, 0, 0, c->W, c->H, c->fb);
+    }
+    a->x = (c->W - a->info.width) / 2;
+    a->y = (c->H - a->info.height) / 2;
+    a->due_us = c->t_start_us;
+    c->state = a;
+}
+
+static bool anim_step(demo_ctx_t *c, uint64_t now_us)
+{
+    anim_state_t *a = (anim_state_t *)c->state;
+    if (!a || !demo_running(c, now_us)) return false;
+    if (!c->unpaced && now_us < a->due_us) return true;
+
+    /* Delta frames depend on their predecessor: present late rather than skip. */
+    if (now_us > a->due_us + a->info.frame_us) a->late++;
+
+    img_seq_frame_stats_t st;
+    const uint64_t p0 = c->present_us;
+    const uint64_t t0 = timing_now_us();
+    const esp_err_t err = img_seq_present_next(a->seq, c->d, a->x, a->y, &st);
+    /* Account through the ctx too, so the demo benchmark sees these presents. */
+    c->present_us += timing_now_us() - t0;
+    c->present_calls += (uint32_t)st.rects;
+    c->present_px += st.px;
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "frame %d: %s", st.index, esp_err_to_name(err));
+        return false;
+    }
+
+    if (!a->shown) a->first_us = t0;
+    a->last_us = timing_now_us();
+    a->shown++;
+    a->present_us_sum   += c->present_us - p0;
+    a->px_sum           += st.px;
+    a->zero_copy_px_sum += st.zero_copy_px;
+    a->due_us += a->info.frame_us;
+    if (a->due_us < now_us) a->due_us = now_us;  // don't try to catch up in a burst
+    return true;
+}
+
+static void anim_stop(demo_ctx_t *c)
+{
+    anim_state_t *a = (anim_state_t *)c->state;
+    if (!a || !a->seq) return;
+    if (a->shown) {
+        ESP_LOGI(TAG, "%u frames, %u late; present avg %u us, %u px/frame (%u%% zero-copy)",
+                 (unsigned)a->shown, (unsigned)a->late,
+                 (unsigned)(a->present_us_sum / a->shown), (unsigned)(a->px_sum / a->shown),
+                 (unsigned)(a->px_sum ? a->zero_copy_px_sum * 100 / a->px_sum : 0));
+        /* Frames faster than the panel refresh are never all seen. */
+        const uint64_t span = a->last_us - a->first_us;
+        if (a->shown > 1 && span) {
+            ESP_LOGI(TAG, "achieved %.1f fps (sequence %.1f fps, panel %.1f Hz)",
+                     (double)((a->shown - 1) * 1e6 / (double)span),
+                     (double)(1e6 / (double)a->info.frame_us), (double)display_refresh_hz(c->d));
+        }
+    }
+    img_seq_close(a->seq);
+    a->seq = NULL;
+}
+
+const demo_desc_t demo_anim_desc = {
+    .name     = "Animation",
+    .frame_us = 2000,   // poll; frames go out on the sequence's own schedule
+    .start    = anim_start,
+    .step     = anim_step,
+    .stop     = anim_stop,
+};
+
+void demo_anim(display_handle_t d, uint16_t *fb, int seconds)
+{
+    demo_run_blocking(&demo_anim_desc, d, fb, seconds);
+}
@@ -1,13 +1,16 @@
 #include <string.h>
-#include <stdlib.h>
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
-#include "esp_timer.h"
-#include "esp_heap_caps.h"
+#include "esp_log.h"
 #include "demos/demos.h"
-#include "util/timing.h"
+#include "util/anim_clock.h"
+#include "util/arena.h"
 
-typedef struct { int x, y, dx, dy, size; uint16_t color; } Sprite;
+static const char *TAG = "demo_bounce";
+
+/* Q16.16 position/velocity; (px,py) is the previous simulation step for interpolation. */
+typedef struct { int32_t x, y, px, py, dx, dy; int size; uint16_t color; } Sprite;
+
+#define FX_SHIFT 16
+#define FX(v)    ((int32_t)((v) * (1 << FX_SHIFT)))
 
 /* Inner fill (RGB565) with simple clipping. */
 static inline void fill_rect565(uint16_t *fb, int W, int H, int x0,int y0,int x1,int y1, uint16_t c)
@@ -36,63 +39,129 @@ static inline void copy_region_to_buf(const uint16_t *fb, int W, int x0,int y0,i
     }
 }
 
-void demo_bounce_seconds(display_handle_t d, uint16_t *fb, int seconds)
-{
-    const int W = display_width(d);
-    const int H = display_height(d);
-    if (W <= 0 || H <= 0 || !fb) return;
+typedef struct {
+    Sprite       s;
+    anim_clock_t clk;
+    int          drawn_x, drawn_y;  // where the square is on screen now
+    uint16_t    *rect_buf;
+    arena_mark_t mark;
+} bounce_state_t;
+
+static bounce_state_t s_bounce;
 
+#define BOUNCE_MARGIN  2
+#define BOUNCE_MAX_W   128
+#define BOUNCE_MAX_H   128
+
+/* 100 Hz simulation; speeds match the old 6/5 px per 24.5 ms frame. */
+#define BOUNCE_STEP_US    10000
+#define BOUNCE_MAX_STEPS  8       // >80 ms behind: drop time rather than jump
+
+static void bounce_start(demo_ctx_t *c)
+{
     /* Clear + present once (matches original cadence). */
-    memset(fb, 0, (size_t)W * H * sizeof(uint16_t));
-    (void)display_draw_bitmap(d, 0, 0, W, H, fb);
-    vTaskDelay(pdMS_TO_TICKS(30));
-
-    Sprite s = { .x = 20, .y = 20, .dx = 6, .dy = 5, .size = 80, .color = 0xF800 };
-    const int margin = 2, max_w = 128, max_h = 128;
-
-    /* Prefer internal/8-bit capable buffer; fall back to malloc. */
-    uint16_t *rect_buf = heap_caps_malloc((size_t)max_w * max_h * sizeof(uint16_t),
-                                          MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-    if (!rect_buf) rect_buf = (uint16_t *)malloc((size_t)max_w * max_h * sizeof(uint16_t));
-
-    const uint64_t t_end = esp_timer_get_time() + (uint64_t)seconds * 1000000ULL;
-    uint64_t next_frame = esp_timer_get_time();
-    const uint32_t frame_us = 24500; // ~40.8 FPS
-
-    while (esp_timer_get_time() < t_end) {
-        /* erase old */
-        fill_rect565(fb, W, H, s.x, s.y, s.x + s.size, s.y + s.size, 0x0000);
-
-        /* advance & bounce */
-        s.x += s.dx; s.y += s.dy;
-        if (s.x < 0 || s.x + s.size > W) { s.dx = -s.dx; s.x += s.dx; }
-        if (s.y < 0 || s.y + s.size > H) { s.dy = -s.dy; s.y += s.dy; }
-
-        /* draw new */
-        fill_rect565(fb, W, H, s.x, s.y, s.x + s.size, s.y + s.size, s.color);
-
-        /* dirty region around sprite (with margin) */
-        int x0 = s.x - margin, y0 = s.y - margin;
-        int x1 = s.x + s.size + margin, y1 = s.y + s.size + margin;
-        if (x0 < 0) 
-            x0 = 0; 
-        if (y0 < 0) 
-            y0 = 0;
-        if (x1 > W) 
-            x1 = W; 
-        if (y1 > H) 
-            y1 = H;
-
-        const int rw = x1 - x0, rh = y1 - y0;
-        if (rect_buf && rw <= max_w && rh <= max_h) {
-            copy_region_to_buf(fb, W, x0, y0, x1, y1, rect_buf);
-            (void)display_draw_bitmap(d, x0, y0, x1, y1, rect_buf);
-        } else {
-            (void)display_draw_bitmap(d, 0, 0, W, H, fb);
-        }
-
-        timing_sleep_periodic_us(&next_frame, frame_us);
+    memset(c->fb, 0, (size_t)c->W * c->H * sizeof(uint16_t));
+    (void)demo_present(c, 0, 0, c->W, c->H, c->fb);
+
+    s_bounce.s = (Sprite){ .x = FX(20), .y = FX(20), .px = FX(20), .py = FX(20),
+                           .dx = FX(2.45), .dy = FX(2.04), .size = 80, .color = 0xF800 };
+    s_bounce.drawn_x = -1;  // nothing drawn yet
+    anim_clock_init(&s_bounce.clk, BOUNCE_STEP_US, BOUNCE_MAX_STEPS, c->t_start_us);
+
+    /* Internal DMA arena; without it every frame falls back to a full present. */
+    const size_t bytes = (size_t)BOUNCE_MAX_W * BOUNCE_MAX_H * sizeof(uint16_t);
+    s_bounce.mark     = arena_mark(ARENA_INTERNAL_DMA);
+    s_bounce.rect_buf = arena_alloc(ARENA_INTERNAL_DMA, bytes);
+
+    c->state = &s_bounce;
+}
+
+static void bounce_sim(Sprite *s, int W, int H)
+{
+    const int32_t xmax = (int32_t)(W - s->size) << FX_SHIFT;
+    const int32_t ymax = (int32_t)(H - s->size) << FX_SHIFT;
+    s->px = s->x; s->py = s->y;
+    s->x += s->dx; s->y += s->dy;
+    if (s->x < 0 || s->x > xmax) { s->dx = -s->dx; s->x += s->dx; }
+    if (s->y < 0 || s->y > ymax) { s->dy = -s->dy; s->y += s->dy; }
+}
+
+static bool bounce_step(demo_ctx_t *c, uint64_t now_us)
+{
+    bounce_state_t *st = (bounce_state_t *)c->state;
+    if (!st || !demo_running(c, now_us)) return false;
+
+    const int W = c->W, H = c->H;
+    uint16_t *fb = c->fb;
+    Sprite *s = &st->s;
+
+    /* Simulate in fixed ticks; a slow frame runs more ticks, not slower motion.
+     * Benchmarks step one tick per frame instead, so every frame moves. */
+    uint32_t alpha = 1u << 16;
+    if (c->unpaced) {
+        bounce_sim(s, W, H);
+    } else {
+        for (uint32_t n = anim_clock_advance(&st->clk, now_us); n > 0; --n) bounce_sim(s, W, H);
+        alpha = anim_clock_alpha_q16(&st->clk);
+    }
+    const int nx = anim_lerp_q16(s->px, s->x, alpha) >> FX_SHIFT;
+    const int ny = anim_lerp_q16(s->py, s->y, alpha) >> FX_SHIFT;
+    const int ox = st->drawn_x < 0 ? nx : st->drawn_x;
+    const int oy = st->drawn_x < 0 ? ny : st->drawn_y;
+    if (st->drawn_x >= 0 && nx == ox && ny == oy) return true;  // nothing moved on screen
+
+    /* erase old, draw new */
+    fill_rect565(fb, W, H, ox, oy, ox + s->size, oy + s->size, 0x0000);
+    fill_rect565(fb, W, H, nx, ny, nx + s->size, ny + s->size, s->color);
+    st->drawn_x = nx;
+    st->drawn_y = ny;
+
+    /* dirty region: old ∪ new (with margin) */
+    int x0 = (ox < nx ? ox : nx) - BOUNCE_MARGIN, y0 = (oy < ny ? oy : ny) - BOUNCE_MARGIN;
+    int x1 = (ox > nx ? ox : nx) + s->size + BOUNCE_MARGIN;
+    int y1 = (oy > ny ? oy : ny) + s->size + BOUNCE_MARGIN;
+    if (x0 < 0) 
+        x0 = 0; 
+    if (y0 < 0) 
+        y0 = 0;
+    if (x1 > W) 
+        x1 = W; 
+    if (y1 > H) 
+        y1 = H;
+
+    const int rw = x1 - x0, rh = y1 - y0;
+    if (st->rect_buf && rw <= BOUNCE_MAX_W && rh <= BOUNCE_MAX_H) {
+        copy_region_to_buf(fb, W, x0, y0, x1, y1, st->rect_buf);
+        (void)demo_present(c, x0, y0, x1, y1, st->rect_buf);
+    } else {
+        (void)demo_present(c, 0, 0, W, H, fb);
+    }
+    return true;
+}
+
+static void bounce_stop(demo_ctx_t *c)
+{
+    bounce_state_t *st = (bounce_state_t *)c->state;
+    if (st && st->clk.frames) {
+        ESP_LOGI(TAG, "%u frames for %u sim steps, %u ms of backlog dropped",
+                 (unsigned)st->clk.frames, (unsigned)st->clk.steps,
+                 (unsigned)(st->clk.dropped_us / 1000));
     }
+    if (st && st->rect_buf) {
+        arena_reset_to(ARENA_INTERNAL_DMA, st->mark);
+        st->rect_buf = NULL;
+    }
+}
+
+const demo_desc_t demo_bounce_desc = {
+    .name     = "Bounce 5s",
+    .frame_us = 24500, // ~40.8 FPS render; motion runs off the 100 Hz anim clock
+    .start    = bounce_start,
+    .step     = bounce_step,
+    .stop     = bounce_stop,
+};
 
-    if (rect_buf) free(rect_buf);
+void demo_bounce_seconds(display_handle_t d, uint16_t *fb, int seconds)
+{
+    demo_run_blocking(&demo_bounce_desc, d, fb, seconds);
 }
@@ -1,33 +1,101 @@
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
 #include "demos/demos.h"
-#include "esp_timer.h"
-#include "util/timing.h"
+#include "ui_gfx/ui_kernels.h"
+#include "util/arena.h"
+#include "util/jobs.h"
 
-void demo_checker_sleep_wake(display_handle_t d, uint16_t *fb, int seconds)
-{
-    const int W = display_width(d);
-    const int H = display_height(d);
-    if (W <= 0 || H <= 0 || !fb) return;
+/* Sleep→wake schedule relative to start (µs). */
+#define CHECKER_OFF_AT_US   300000
+#define CHECKER_ON_AT_US    600000
+
+#define CHECKER_CELL        32
+
+typedef struct {
+    bool panel_off;
+    bool cycled;
+} checker_state_t;
 
-    uint64_t t_end = esp_timer_get_time() + (uint64_t)seconds * 1000000ULL;
+static checker_state_t s_checker;
+
+static void checker_rows(int y0, int y1, void *arg)
+{
+    demo_ctx_t *c = (demo_ctx_t *)arg;
+    const int W = c->W;
 
     /* Checkerboard fill */
-    const int sz = 32;
-    for (int y = 0; y < H; ++y) {
-        uint16_t *row = fb + y * W;
+    const int sz = CHECKER_CELL;
+    for (int y = y0; y < y1; ++y) {
+        uint16_t *row = c->fb + y * W;
         for (int x = 0; x < W; ++x) {
             row[x] = (((x / sz) ^ (y / sz)) & 1) ? 0xFFFF : 0x0000;
         }
     }
-    (void)display_draw_bitmap(d, 0, 0, W, H, fb);
+}
+
+/* One 2×2-cell tile replicated by the pattern kernel; per-pixel rows if no scratch. */
+static void checker_render(demo_ctx_t *c)
+{
+    const int sz = CHECKER_CELL, tw = 2 * sz;
+    uint16_t *tile = arena_scratch(ARENA_INTERNAL_DMA, (size_t)tw * tw * sizeof(uint16_t));
+    if (tile) {
+        for (int y = 0; y < tw; ++y) {
+            for (int x = 0; x < tw; ++x) tile[y * tw + x] = (((x / sz) ^ (y / sz)) & 1) ? 0xFFFF : 0x0000;
+        }
+        ui_pattern_fill565(c->fb, c->W, c->H, tile, tw, tw);
+    } else {
+        parallel_for_rows(0, c->H, 0, checker_rows, c);
+    }
+    (void)demo_present(c, 0, 0, c->W, c->H, c->fb);
+}
+
+static void checker_start(demo_ctx_t *c)
+{
+    checker_render(c);
+    s_checker = (checker_state_t){0};
+    c->state  = &s_checker;
+}
+
+/* Short sleep→wake cycle, then hold until the deadline. */
+static bool checker_step(demo_ctx_t *c, uint64_t now_us)
+{
+    checker_state_t *s = (checker_state_t *)c->state;
+    if (!s) return false;
+
+    /* Benchmarks measure the pattern, not panel power cycling. */
+    if (c->unpaced) {
+        checker_render(c);
+        return true;
+    }
+
+    const uint64_t t = now_us - c->t_start_us;
+    if (!s->cycled && !s->panel_off && t >= CHECKER_OFF_AT_US) {
+        (void)display_on(c->d, false);
+        s->panel_off = true;
+    } else if (s->panel_off && t >= CHECKER_ON_AT_US) {
+        (void)display_on(c->d, true);
+        s->panel_off = false;
+        s->cycled    = true;
+    }
+    return s->panel_off || now_us < c->t_end_us;
+}
 
-    /* Short sleep→wake cycle */
-    vTaskDelay(pdMS_TO_TICKS(300));
-    (void)display_on(d, false);
-    vTaskDelay(pdMS_TO_TICKS(300));
-    (void)display_on(d, true);
-    vTaskDelay(pdMS_TO_TICKS(300));
+static void checker_stop(demo_ctx_t *c)
+{
+    checker_state_t *s = (checker_state_t *)c->state;
+    if (s && s->panel_off) {
+        (void)display_on(c->d, true);  // cancelled mid-sleep: never leave the panel dark
+        s->panel_off = false;
+    }
+}
 
-    timing_sleep_until_abs_us(t_end);
+const demo_desc_t demo_checker_sleep_wake_desc = {
+    .name     = "Sleep/Wake",
+    .frame_us = 20000,
+    .start    = checker_start,
+    .step     = checker_step,
+    .stop     = checker_stop,
+};
+
+void demo_checker_sleep_wake(display_handle_t d, uint16_t *fb, int seconds)
+{
+    demo_run_blocking(&demo_checker_sleep_wake_desc, d, fb, seconds);
 }
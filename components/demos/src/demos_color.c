@@ -1,31 +1,49 @@
 #include <string.h>
 #include "demos/demos.h"
-#include "esp_timer.h"
-#include "util/timing.h"
+#include "util/jobs.h"
 
-static inline void full_present(display_handle_t d, uint16_t *fb, int W, int H) {
-    (void)display_draw_bitmap(d, 0, 0, W, H, fb);
+static inline void full_present(demo_ctx_t *c) {
+    (void)demo_present(c, 0, 0, c->W, c->H, c->fb);
 }
 
-void demo_color_bars(display_handle_t d, uint16_t *fb, int seconds)
-{
-    const int W = display_width(d);
-    const int H = display_height(d);
-    if (W <= 0 || H <= 0 || !fb) return;
+/* Same 7-bar palette as before. */
+static const uint16_t bars[7] = {0xF800,0xFBE0,0x07E0,0x07FF,0x001F,0xF81F,0xFFFF};
 
-    uint64_t t_end = esp_timer_get_time() + (uint64_t)seconds * 1000000ULL;
-
-    /* Same 7-bar palette as before. */
-    static const uint16_t bars[7] = {0xF800,0xFBE0,0x07E0,0x07FF,0x001F,0xF81F,0xFFFF};
+static void color_bars_rows(int y0, int y1, void *arg)
+{
+    demo_ctx_t *c = (demo_ctx_t *)arg;
+    const int W = c->W;
     const int band = (W + 6) / 7;
-
-    for (int y = 0; y < H; ++y) {
-        uint16_t *row = fb + y * W;
+    for (int y = y0; y < y1; ++y) {
+        uint16_t *row = c->fb + y * W;
         for (int x = 0; x < W; ++x) {
             int idx = x / band; if (idx > 6) idx = 6;
             row[x] = bars[idx];
         }
     }
-    full_present(d, fb, W, H);
-    timing_sleep_until_abs_us(t_end);
+}
+
+static void color_bars_start(demo_ctx_t *c)
+{
+    parallel_for_rows(0, c->H, 0, color_bars_rows, c);
+    full_present(c);
+}
+
+/* Static frame: hold until the deadline (benchmarks redraw every step). */
+static bool color_bars_step(demo_ctx_t *c, uint64_t now_us)
+{
+    if (c->unpaced) color_bars_start(c);
+    return demo_running(c, now_us);
+}
+
+const demo_desc_t demo_color_bars_desc = {
+    .name     = "Color Bars",
+    .frame_us = 50000,
+    .start    = color_bars_start,
+    .step     = color_bars_step,
+};
+
+void demo_color_bars(display_handle_t d, uint16_t *fb, int seconds)
+{
+    demo_run_blocking(&demo_color_bars_desc, d, fb, seconds);
 }
@@ -1,22 +1,29 @@
 #include "demos/demos.h"
-#include "esp_timer.h"
-#include "util/timing.h"
+#include "ui_gfx/color_conv.h"
 
-void demo_vertical_gradient(display_handle_t d, uint16_t *fb, int seconds)
+/* Black to full green; 8×8 ordered dither hides the 64-step banding of a plain ramp. */
+#define GRADIENT_DITHER UI_DITHER_BAYER8
+
+static void gradient_start(demo_ctx_t *c)
+{
+    ui_gradient_fill565(c->fb, c->W, c->H, 0, 0, c->W - 1, c->H - 1, 0x000000, 0x00FF00, true, GRADIENT_DITHER);
+    (void)demo_present(c, 0, 0, c->W, c->H, c->fb);
+}
+
+static bool gradient_step(demo_ctx_t *c, uint64_t now_us)
 {
-    const int W = display_width(d);
-    const int H = display_height(d);
-    if (W <= 0 || H <= 0 || !fb) return;
+    if (c->unpaced) gradient_start(c);
+    return demo_running(c, now_us);
+}
 
-    uint64_t t_end = esp_timer_get_time() + (uint64_t)seconds * 1000000ULL;
+const demo_desc_t demo_vertical_gradient_desc = {
+    .name     = "Gradient",
+    .frame_us = 50000,
+    .start    = gradient_start,
+    .step     = gradient_step,
+};
 
-    for (int y = 0; y < H; ++y) {
-        /* 6-bit green ramp; same mapping as original. */
-        const uint8_t  g = (uint8_t)((y * 63) / (H - 1));
-        const uint16_t c = ((uint16_t)g & 0x3F) << 5;
-        uint16_t *row = fb + y * W;
-        for (int x = 0; x < W; ++x) row[x] = c;
-    }
-    (void)display_draw_bitmap(d, 0, 0, W, H, fb);
-    timing_sleep_until_abs_us(t_end);
+void demo_vertical_gradient(display_handle_t d, uint16_t *fb, int seconds)
+{
+    demo_run_blocking(&demo_vertical_gradient_desc, d, fb, seconds);
 }
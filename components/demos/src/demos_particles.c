@@ -0,0 +1,288 @@
+#include <string.h>
+#include "esp_log.h"
+#include "demos/demos.h"
+#include "util/arena.h"
+#include "util/dirty_rect.h"
+#include "util/timing.h"
+
+static const char *TAG = "demo_particles";
+
+/* Sprite population ramps from START by ×5/4 every STAGE_FRAMES up to MAX. */
+#ifndef PARTICLES_START
+#define PARTICLES_START        64
+#endif
+#ifndef PARTICLES_MAX
+#define PARTICLES_MAX          4096
+#endif
+#define PARTICLES_STAGE_FRAMES 60
+#define PARTICLES_SIZE         6        // px, square
+#define PARTICLES_BUDGET_US    16667    // 60 fps
+#define PARTICLES_DIRTY_SLOP   8        // px gap still worth merging across
+#ifndef PARTICLES_MAX_BANDS
+#define PARTICLES_MAX_BANDS    3        // presents per frame
+#endif
+
+/* Q16.16 fixed point. */
+#define FX_SHIFT 16
+#define FX(v)    ((int32_t)((v) * (1 << FX_SHIFT)))
+
+/*
+ * Structure-of-arrays: the update loops touch only the lanes they need, in
+ * unit stride, with no per-sprite branches the compiler can't turn into selects.
+ */
+typedef struct {
+    int32_t  *x, *y;         // Q16.16 top-left
+    int32_t  *vx, *vy;       // Q16.16 px/frame
+    int16_t  *ox, *oy;       // last drawn position (erase)
+    uint16_t *color;
+    void     *block;         // single arena block backing the lanes above
+    arena_mark_t mark[ARENA_REGION_COUNT];
+
+    int       count;
+    uint32_t  rng;
+
+    /* current stage */
+    uint32_t  stage_frames;
+    uint64_t  stage_cpu_us, stage_present_us;
+    uint32_t  stage_px, stage_presents;
+    int       missed_at;     // first count that blew the budget (0 = not yet)
+} particles_t;
+
+static particles_t s_particles;
+
+static uint32_t xorshift(uint32_t *s)
+{
+    uint32_t v = *s;
+    v ^= v << 13; v ^= v >> 17; v ^= v << 5;
+    return *s = v;
+}
+
+static void spawn(particles_t *p, int from, int to, int W, int H)
+{
+    static const uint16_t palette[] = { 0xF800, 0x07E0, 0x001F, 0xFFE0, 0xF81F, 0x07FF, 0xFBE0, 0xFFFF };
+    for (int i = from; i < to; ++i) {
+        const uint32_t r = xorshift(&p->rng);
+        p->x[i]  = (int32_t)((r % (uint32_t)(W - PARTICLES_SIZE)) << FX_SHIFT);
+        p->y[i]  = (int32_t)(((r >> 11) % (uint32_t)(H - PARTICLES_SIZE)) << FX_SHIFT);
+        /* 0.5..4.5 px/frame, random sign */
+        const uint32_t r2 = xorshift(&p->rng);
+        const int32_t sx = FX(0.5) + (int32_t)(r2 & 0x3FFFF);
+        const int32_t sy = FX(0.5) + (int32_t)((r2 >> 14) & 0x3FFFF);
+        p->vx[i] = (r2 & 0x80000000u) ? -sx : sx;
+        p->vy[i] = (r2 & 0x40000000u) ? -sy : sy;
+        p->ox[i] = (int16_t)(p->x[i] >> FX_SHIFT);
+        p->oy[i] = (int16_t)(p->y[i] >> FX_SHIFT);
+        p->color[i] = palette[i & 7];
+    }
+}
+
+static void fill_sq(uint16_t *fb, int W, int x, int y, uint16_t c)
+{
+    for (int r = 0; r < PARTICLES_SIZE; ++r) {
+        uint16_t *row = fb + (y + r) * W + x;
+        for (int k = 0; k < PARTICLES_SIZE; ++k) row[k] = c;
+    }
+}
+
+static void particles_start(demo_ctx_t *c)
+{
+    particles_t *p = &s_particles;
+    memset(p, 0, sizeof(*p));
+
+    /* One block for all lanes; internal RAM first, the update loop is load-bound. */
+    const size_t n = PARTICLES_MAX;
+    const size_t bytes = n * (4 * sizeof(int32_t) + 2 * sizeof(int16_t) + sizeof(uint16_t));
+    for (int r = 0; r < ARENA_REGION_COUNT; ++r) p->mark[r] = arena_mark((arena_region_t)r);
+    p->block = arena_alloc(ARENA_INTERNAL_DMA, bytes);
+    if (!p->block) p->block = arena_alloc(ARENA_PSRAM_DMA, bytes);
+    if (!p->block) {
+        ESP_LOGE(TAG, "no arena space for %u sprites", (unsigned)n);
+        memset(p, 0, sizeof(*p));
+        return;
+    }
+    uint8_t *q = p->block;
+    p->x  = (int32_t *)q;  q += n * sizeof(int32_t);
+    p->y  = (int32_t *)q;  q += n * sizeof(int32_t);
+    p->vx = (int32_t *)q;  q += n * sizeof(int32_t);
+    p->vy = (int32_t *)q;  q += n * sizeof(int32_t);
+    p->ox = (int16_t *)q;  q += n * sizeof(int16_t);
+    p->oy = (int16_t *)q;  q += n * sizeof(int16_t);
+    p->color = (uint16_t *)q;
+
+    p->rng   = 0x9E3779B9u;
+    p->count = PARTICLES_START;
+    spawn(p, 0, p->count, c->W, c->H);
+
+    memset(c->fb, 0, (size_t)c->W * c->H * sizeof(uint16_t));
+    (void)demo_present(c, 0, 0, c->W, c->H, c->fb);
+    c->state = p;
+}
+
+/*
+ * Collapse the damage to at most PARTICLES_MAX_BANDS full-width row bands.
+ * A full-width band is contiguous in fb, so it is presented in place: no
+ * packing copy, no scratch that the async transfer could still be reading.
+ * Each present costs a transfer round trip, so a few larger bands beat many
+ * tight rects. Returns the band count.
+ */
+static int dirty_bands(const dirty_rects_t *dr, int out[][2])
+{
+    int n = 0;
+    for (int i = 0; i < dr->n; ++i) {   // insertion sort by y0 (n <= DIRTY_RECTS_MAX)
+        int j = n++;
+        for (; j > 0 && out[j - 1][0] > dr->r[i].y0; --j) {
+            out[j][0] = out[j - 1][0];
+            out[j][1] = out[j - 1][1];
+        }
+        out[j][0] = dr->r[i].y0;
+        out[j][1] = dr->r[i].y1;
+    }
+
+    int m = 0;
+    for (int i = 0; i < n; ++i) {        // merge overlapping row ranges
+        if (m && out[i][0] <= out[m - 1][1]) {
+            if (out[i][1] > out[m - 1][1]) out[m - 1][1] = out[i][1];
+        } else {
+            out[m][0] = out[i][0];
+            out[m][1] = out[i][1];
+            ++m;
+        }
+    }
+
+    while (m > PARTICLES_MAX_BANDS) {     // close the smallest gap
+        int best = 0;
+        for (int i = 1; i < m - 1; ++i) {
+            if (out[i + 1][0] - out[i][1] < out[best + 1][0] - out[best][1]) best = i;
+        }
+        out[best][1] = out[best + 1][1];
+        for (int i = best + 1; i < m - 1; ++i) {
+            out[i][0] = out[i + 1][0];
+            out[i][1] = out[i + 1][1];
+        }
+        --m;
+    }
+    return m;
+}
+
+static int present_dirty(demo_ctx_t *c, const dirty_rects_t *dr)
+{
+    const int W = c->W;
+    int bands[DIRTY_RECTS_MAX][2];
+    const int n = dirty_bands(dr, bands);
+    for (int i = 0; i < n; ++i) {
+        (void)demo_present(c, 0, bands[i][0], W, bands[i][1], c->fb + (size_t)bands[i][0] * W);
+    }
+    return n;
+}
+
+static void end_stage(demo_ctx_t *c, particles_t *p)
+{
+    const uint32_t n       = p->stage_frames;
+    const uint32_t cpu     = (uint32_t)(p->stage_cpu_us / n);
+    const uint32_t present = (uint32_t)(p->stage_present_us / n);
+    const uint32_t frame   = cpu + present;
+    ESP_LOGI(TAG, "%4d sprites: update+draw %5u us, present %5u us (%u bands, %u px)/frame",
+             p->count, (unsigned)cpu, (unsigned)present,
+             (unsigned)(p->stage_presents / n), (unsigned)(p->stage_px / n));
+
+    if (!p->missed_at && frame > PARTICLES_BUDGET_US) {
+        p->missed_at = p->count;
+        ESP_LOGW(TAG, "60 fps missed at %d sprites (%u us/frame)", p->count, (unsigned)frame);
+    }
+
+    p->stage_frames = 0;
+    p->stage_cpu_us = p->stage_present_us = 0;
+    p->stage_px = p->stage_presents = 0;
+
+    if (p->count < PARTICLES_MAX) {
+        int next = p->count * 5 / 4;
+        if (next > PARTICLES_MAX) next = PARTICLES_MAX;
+        spawn(p, p->count, next, c->W, c->H);
+        p->count = next;
+    }
+}
+
+static bool particles_step(demo_ctx_t *c, uint64_t now_us)
+{
+    particles_t *p = (particles_t *)c->state;
+    if (!p || !demo_running(c, now_us)) return false;
+
+    const int W = c->W, H = c->H, n = p->count;
+    uint16_t *fb = c->fb;
+    const int32_t xmax = (int32_t)(W - PARTICLES_SIZE) << FX_SHIFT;
+    const int32_t ymax = (int32_t)(H - PARTICLES_SIZE) << FX_SHIFT;
+    const uint64_t t0 = timing_now_us();
+
+    /* Integrate: straight-line adds over contiguous lanes (auto-vectorizable). */
+    int32_t *restrict x = p->x, *restrict y = p->y;
+    int32_t *restrict vx = p->vx, *restrict vy = p->vy;
+    for (int i = 0; i < n; ++i) { x[i] += vx[i]; y[i] += vy[i]; }
+
+    /* Reflect: selects only, no data-dependent branches. */
+    for (int i = 0; i < n; ++i) {
+        const int out = (x[i] < 0) | (x[i] > xmax);
+        vx[i] = out ? -vx[i] : vx[i];
+        x[i]  = x[i] < 0 ? -x[i] : (x[i] > xmax ? 2 * xmax - x[i] : x[i]);
+    }
+    for (int i = 0; i < n; ++i) {
+        const int out = (y[i] < 0) | (y[i] > ymax);
+        vy[i] = out ? -vy[i] : vy[i];
+        y[i]  = y[i] < 0 ? -y[i] : (y[i] > ymax ? 2 * ymax - y[i] : y[i]);
+    }
+
+    /* Erase everything, then draw everything, so overlaps resolve in index order. */
+    dirty_rects_t dr;
+    dirty_rects_reset(&dr, PARTICLES_DIRTY_SLOP);
+    for (int i = 0; i < n; ++i) fill_sq(fb, W, p->ox[i], p->oy[i], 0x0000);
+    for (int i = 0; i < n; ++i) {
+        const int nx = x[i] >> FX_SHIFT, ny = y[i] >> FX_SHIFT;
+        fill_sq(fb, W, nx, ny, p->color[i]);
+        /* Old and new squares are within a few px: one rect covers both. */
+        const int x0 = nx < p->ox[i] ? nx : p->ox[i];
+        const int y0 = ny < p->oy[i] ? ny : p->oy[i];
+        const int x1 = (nx > p->ox[i] ? nx : p->ox[i]) + PARTICLES_SIZE;
+        const int y1 = (ny > p->oy[i] ? ny : p->oy[i]) + PARTICLES_SIZE;
+        dirty_rects_add(&dr, x0, y0, x1, y1);
+        p->ox[i] = (int16_t)nx;
+        p->oy[i] = (int16_t)ny;
+    }
+    dirty_rects_clip(&dr, W, H);
+    const uint64_t t1 = timing_now_us();
+
+    const uint64_t present_before = c->present_us;
+    const uint64_t px_before      = c->present_px;
+    const int bands = present_dirty(c, &dr);
+
+    p->stage_cpu_us     += t1 - t0;
+    p->stage_present_us += c->present_us - present_before;
+    p->stage_px         += (uint32_t)(c->present_px - px_before);
+    p->stage_presents   += (uint32_t)bands;
+    if (++p->stage_frames >= PARTICLES_STAGE_FRAMES) end_stage(c, p);
+    return true;
+}
+
+static void particles_stop(demo_ctx_t *c)
+{
+    particles_t *p = (particles_t *)c->state;
+    if (!p) return;
+    if (p->missed_at) {
+        ESP_LOGI(TAG, "sustains 60 fps below %d sprites", p->missed_at);
+    } else {
+        ESP_LOGI(TAG, "held 60 fps up to %d sprites", p->count);
+    }
+    for (int r = ARENA_REGION_COUNT - 1; r >= 0; --r) arena_reset_to((arena_region_t)r, p->mark[r]);
+    memset(p, 0, sizeof(*p));
+}
+
+const demo_desc_t demo_particles_desc = {
+    .name     = "Particles",
+    .frame_us = PARTICLES_BUDGET_US,
+    .start    = particles_start,
+    .step     = particles_step,
+    .stop     = particles_stop,
+};
+
+void demo_particles(display_handle_t d, uint16_t *fb, int seconds)
+{
+    demo_run_blocking(&demo_particles_desc, d, fb, seconds);
+}
@@ -0,0 +1,167 @@
+#include <math.h>
+#include <string.h>
+#include "esp_log.h"
+#include "demos/demos.h"
+#include "util/arena.h"
+#include "util/jobs.h"
+#include "util/timing.h"
+
+static const char *TAG = "demo_plasma";
+
+/* Split rows across cores via util/jobs (falls back to one core if not started). */
+#ifndef PLASMA_USE_JOBS
+#define PLASMA_USE_JOBS 1
+#endif
+
+#define PLASMA_SEG        256        // pixels per index/lookup pass (stack buffer)
+#define PLASMA_REPORT_US  2000000
+
+/*
+ * Four Q8.8 sine terms (±255 each) summed per pixel:
+ *   col[x] = sin(x·a + t1) + sin(x·b − t2)      per column, per frame
+ *   row[y] = sin(y·c + t3)                      per row, per frame
+ *   diag[x+y] = sin((x+y)·d + t4)               per diagonal, per frame
+ * so the per-pixel work is three adds, a shift and a palette lookup.
+ */
+typedef struct {
+    int16_t  sin_q8[256];     // Q8.8, one period
+    uint16_t pal[256];        // RGB565
+    int16_t *col, *row, *diag;
+    void    *block;
+    arena_mark_t mark;
+
+    uint8_t  pal_shift;
+    uint64_t report_at;
+    uint32_t frames;
+    uint64_t render_us, present_us;
+} plasma_t;
+
+static plasma_t s_plasma;
+
+static inline int16_t lsin(const plasma_t *p, uint32_t phase_q16)
+{
+    return p->sin_q8[(phase_q16 >> 8) & 0xFF];  // 256 entries per 1.0 turn in Q16.16 → top byte of fraction
+}
+
+static void plasma_rows(int y0, int y1, void *arg)
+{
+    demo_ctx_t *c = (demo_ctx_t *)arg;
+    const plasma_t *p = (const plasma_t *)c->state;
+    const int W = c->W;
+    const uint8_t shift = p->pal_shift;
+    uint8_t idx[PLASMA_SEG];
+
+    for (int y = y0; y < y1; ++y) {
+        uint16_t *out = c->fb + y * W;
+        const int16_t  r = p->row[y];
+        const int16_t *d = p->diag + y;
+        for (int x0 = 0; x0 < W; x0 += PLASMA_SEG) {
+            const int n = (W - x0) < PLASMA_SEG ? (W - x0) : PLASMA_SEG;
+            const int16_t *cx = p->col + x0;
+            const int16_t *dx = d + x0;
+            /* Pass 1: int16 adds, shift, narrow — straight-line, vectorizable. */
+            for (int i = 0; i < n; ++i) {
+                idx[i] = (uint8_t)(((cx[i] + r + dx[i] + 1020) >> 3) + shift);
+            }
+            /* Pass 2: palette lookup. */
+            for (int i = 0; i < n; ++i) out[x0 + i] = p->pal[idx[i]];
+        }
+    }
+}
+
+static void plasma_start(demo_ctx_t *c)
+{
+    plasma_t *p = &s_plasma;
+    memset(p, 0, sizeof(*p));
+
+    const size_t terms = (size_t)c->W + c->H + (c->W + c->H);
+    p->mark  = arena_mark(ARENA_INTERNAL_DMA);
+    p->block = arena_alloc(ARENA_INTERNAL_DMA, terms * sizeof(int16_t));
+    if (!p->block) {
+        ESP_LOGE(TAG, "no memory for %u-entry term tables", (unsigned)terms);
+        return;
+    }
+    p->col  = (int16_t *)p->block;
+    p->row  = p->col + c->W;
+    p->diag = p->row + c->H;
+
+    /* One-time float setup; everything per frame is integer. */
+    for (int i = 0; i < 256; ++i) {
+        const float a = (float)i * (2.0f * (float)M_PI / 256.0f);
+        p->sin_q8[i] = (int16_t)lrintf(255.0f * sinf(a));
+        const int rr = (int)(127.5f + 127.5f * sinf(a));
+        const int gg = (int)(127.5f + 127.5f * sinf(a + 2.094f));
+        const int bb = (int)(127.5f + 127.5f * sinf(a + 4.189f));
+        p->pal[i] = (uint16_t)(((rr & 0xF8) << 8) | ((gg & 0xFC) << 3) | (bb >> 3));
+    }
+    p->report_at = c->t_start_us + PLASMA_REPORT_US;
+    c->state = p;
+}
+
+static void plasma_terms(plasma_t *p, int W, int H, uint32_t t_ms)
+{
+    /* Phases in Q16.16 turns: spatial frequency per px, temporal per ms. */
+    const uint32_t t1 = t_ms * 40, t2 = t_ms * 27, t3 = t_ms * 33, t4 = t_ms * 19;
+    for (int x = 0; x < W; ++x) {
+        p->col[x] = (int16_t)(lsin(p, (uint32_t)x * 180 + t1) + lsin(p, (uint32_t)x * 77 - t2));
+    }
+    for (int y = 0; y < H; ++y) p->row[y] = lsin(p, (uint32_t)y * 120 + t3);
+    for (int k = 0; k < W + H; ++k) p->diag[k] = lsin(p, (uint32_t)k * 95 + t4);
+}
+
+static bool plasma_step(demo_ctx_t *c, uint64_t now_us)
+{
+    plasma_t *p = (plasma_t *)c->state;
+    if (!p || !demo_running(c, now_us)) return false;
+
+    const uint64_t t0 = timing_now_us();
+    const uint32_t t_ms = (uint32_t)((now_us - c->t_start_us) / 1000);
+    plasma_terms(p, c->W, c->H, t_ms);
+    p->pal_shift = (uint8_t)(t_ms >> 4);
+
+    if (PLASMA_USE_JOBS) {
+        parallel_for_rows(0, c->H, 0, plasma_rows, c);
+    } else {
+        plasma_rows(0, c->H, c);
+    }
+    const uint64_t t1 = timing_now_us();
+    (void)demo_present(c, 0, 0, c->W, c->H, c->fb);
+
+    p->render_us  += t1 - t0;
+    p->present_us += timing_now_us() - t1;
+    p->frames++;
+    if (now_us >= p->report_at) {
+        const uint32_t n = p->frames ? p->frames : 1;
+        const uint64_t span = now_us - (p->report_at - PLASMA_REPORT_US);
+        ESP_LOGI(TAG, "%u.%u fps  render %u us  present %u us  (%s)",
+                 (unsigned)((uint64_t)p->frames * 1000000ULL / span),
+                 (unsigned)((uint64_t)p->frames * 10000000ULL / span % 10),
+                 (unsigned)(p->render_us / n), (unsigned)(p->present_us / n),
+                 (PLASMA_USE_JOBS && jobs_ready()) ? "rows split across cores" : "single core");
+        p->frames = 0;
+        p->render_us = p->present_us = 0;
+        p->report_at = now_us + PLASMA_REPORT_US;
+    }
+    return true;
+}
+
+static void plasma_stop(demo_ctx_t *c)
+{
+    plasma_t *p = (plasma_t *)c->state;
+    if (!p || !p->block) return;
+    arena_reset_to(ARENA_INTERNAL_DMA, p->mark);
+    p->block = NULL;
+}
+
+const demo_desc_t demo_plasma_desc = {
+    .name     = "Plasma",
+    .frame_us = 16667,
+    .start    = plasma_start,
+    .step     = plasma_step,
+    .stop     = plasma_stop,
+};
+
+void demo_plasma(display_handle_t d, uint16_t *fb, int seconds)
+{
+    demo_run_blocking(&demo_plasma_desc, d, fb, seconds);
+}
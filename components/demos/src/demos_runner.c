@@ -0,0 +1,95 @@
+#include "demos/demos.h"
+#include "util/arena.h"
+#include "util/timing.h"
+#include "util/trace.h"
+
+/* Blocking runner cadence when a demo has no preference. */
+#define DEMO_DEFAULT_FRAME_US 16667
+/* Longest a step waits for the previous frame's transfers. */
+#define DEMO_IDLE_TIMEOUT_MS  100
+
+static const demo_desc_t *const kDemos[] = {
+    &demo_color_bars_desc,
+    &demo_vertical_gradient_desc,
+    &demo_bounce_desc,
+    &demo_checker_sleep_wake_desc,
+    &demo_particles_desc,
+    &demo_plasma_desc,
+    &demo_anim_desc,
+    &demo_slideshow_desc,
+};
+
+int demos_count(void)
+{
+    return (int)(sizeof(kDemos) / sizeof(kDemos[0]));
+}
+
+const demo_desc_t *demos_get(int index)
+{
+    return (index >= 0 && index < demos_count()) ? kDemos[index] : NULL;
+}
+
+esp_err_t demo_present(demo_ctx_t *c, int x0, int y0, int x1, int y1, const void *buf)
+{
+    const uint64_t t0 = timing_now_us();
+    const esp_err_t err = display_draw_bitmap(c->d, x0, y0, x1, y1, buf);
+    c->present_us += timing_now_us() - t0;
+    c->present_calls++;
+    c->present_px += (uint64_t)(x1 - x0) * (uint64_t)(y1 - y0);
+    return err;
+}
+
+void demo_begin(const demo_desc_t *desc, demo_ctx_t *c,
+                display_handle_t d, uint16_t *fb, int seconds)
+{
+    const uint64_t now = timing_now_us();
+    *c = (demo_ctx_t){
+        .d          = d,
+        .fb         = fb,
+        .W          = display_width(d),
+        .H          = display_height(d),
+        .t_start_us = now,
+        .t_end_us   = now + (uint64_t)seconds * 1000000ULL,
+    };
+    if (c->W <= 0 || c->H <= 0 || !fb) return;
+    arena_frame_begin(&c->scratch);
+    desc->start(c);
+}
+
+bool demo_step(const demo_desc_t *desc, demo_ctx_t *c, uint64_t now_us)
+{
+    if (c->W <= 0 || c->H <= 0 || !c->fb) return false;
+    /* Presents are async copies out of fb and frame scratch: let them land,
+     * then recycle only this demo's scratch before redrawing. */
+    (void)display_wait_idle(c->d, DEMO_IDLE_TIMEOUT_MS);
+    arena_frame_end(&c->scratch);
+    arena_frame_begin(&c->scratch);
+    TRACE_BEGIN(desc->name);
+    const bool more = desc->step(c, now_us);
+    TRACE_END(desc->name);
+    c->frame++;
+    return more;
+}
+
+void demo_end(const demo_desc_t *desc, demo_ctx_t *c)
+{
+    const bool started = c->W > 0 && c->H > 0 && c->fb;
+    /* The last presents may still be reading buffers that stop() frees: let them land first. */
+    if (started) (void)display_wait_idle(c->d, DEMO_IDLE_TIMEOUT_MS);
+    if (desc->stop) desc->stop(c);
+    c->state = NULL;
+    if (started) arena_frame_end(&c->scratch);
+}
+
+void demo_run_blocking(const demo_desc_t *desc, display_handle_t d, uint16_t *fb, int seconds)
+{
+    const uint32_t frame_us = desc->frame_us ? desc->frame_us : DEMO_DEFAULT_FRAME_US;
+
+    demo_ctx_t c;
+    demo_begin(desc, &c, d, fb, seconds);
+    uint64_t next = 0;
+    while (demo_step(desc, &c, timing_now_us())) {
+        timing_sleep_periodic_us(&next, frame_us);
+    }
+    demo_end(desc, &c);
+}
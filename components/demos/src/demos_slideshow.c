@@ -0,0 +1,105 @@
+#include "esp_log.h"
+#include "demos/demos.h"
+#include "image/slideshow.h"
+#include "util/timing.h"
+
+static const char *TAG = "demo_slideshow";
+
+/* Log pipeline stats every this many photos (and at the end). */
+#define SLIDESHOW_LOG_EVERY 10
+
+/* Unpaced, a step polls this often for the next photo, and gives up on the run after the wait. */
+#define SLIDESHOW_UNPACED_POLL_US 500
+#define SLIDESHOW_UNPACED_WAIT_MS 2000
+
+typedef struct {
+    slideshow_handle_t ss;
+    uint32_t           logged;
+} slideshow_state_t;
+
+static slideshow_state_t s_show;
+static const char       *s_dir;   // NULL: the "photos" partition
+
+static void log_stats(slideshow_handle_t ss)
+{
+    slideshow_stats_t st;
+    slideshow_get_stats(ss, &st);
+    ESP_LOGI(TAG, "%u shown, %u late, %u errors | read %u/%u us, decode %u/%u us (%u us/MPx), "
+             "present %u/%u us (last/max) | queued files %d, frames %d (min at due %d)",
+             (unsigned)st.shown, (unsigned)st.late, (unsigned)st.errors,
+             (unsigned)st.read_us, (unsigned)st.read_max_us,
+             (unsigned)st.decode_us, (unsigned)st.decode_max_us, (unsigned)st.decode_us_per_mpx,
+             (unsigned)st.present_us, (unsigned)st.present_max_us,
+             st.files_ready, st.frames_ready, st.frames_ready_min);
+}
+
+static void slideshow_start(demo_ctx_t *c)
+{
+    slideshow_state_t *s = &s_show;
+    *s = (slideshow_state_t){0};
+
+    slideshow_cfg_t cfg = SLIDESHOW_CFG_DEFAULT();
+    cfg.dir = s_dir;
+    const esp_err_t err = slideshow_open(&cfg, c->d, &s->ss);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "no slideshow in '%s': %s", s_dir ? s_dir : cfg.partition, esp_err_to_name(err));
+        return;
+    }
+    c->state = s;
+}
+
+static bool slideshow_step(demo_ctx_t *c, uint64_t now_us)
+{
+    slideshow_state_t *s = (slideshow_state_t *)c->state;
+    if (!s || !demo_running(c, now_us)) return false;
+
+    /* Unpaced (benchmark; set after start), photos go back to back and each
+     * step is one photo: wait for the decoder rather than return empty. */
+    if (c->unpaced) slideshow_set_dwell(s->ss, 0);
+    const uint64_t give_up_us = now_us + (uint64_t)SLIDESHOW_UNPACED_WAIT_MS * 1000;
+    for (;;) {
+        const uint64_t t0 = timing_now_us();
+        if (slideshow_poll(s->ss, now_us)) {
+            /* Account through the ctx, so the demo benchmark sees these presents. */
+            c->present_us += timing_now_us() - t0;
+            c->present_calls++;
+            c->present_px += (uint64_t)c->W * (uint64_t)c->H;
+            if (++s->logged % SLIDESHOW_LOG_EVERY == 0) log_stats(s->ss);
+            return true;
+        }
+        if (!c->unpaced) return true;
+        if (now_us >= give_up_us) {
+            ESP_LOGW(TAG, "no photo decoded in %d ms", SLIDESHOW_UNPACED_WAIT_MS);
+            return false;
+        }
+        (void)timing_sleep_until_abs_us(now_us + SLIDESHOW_UNPACED_POLL_US);
+        now_us = timing_now_us();
+    }
+}
+
+static void slideshow_stop(demo_ctx_t *c)
+{
+    slideshow_state_t *s = (slideshow_state_t *)c->state;
+    if (!s || !s->ss) return;
+    log_stats(s->ss);
+    slideshow_close(s->ss);
+    s->ss = NULL;
+}
+
+const demo_desc_t demo_slideshow_desc = {
+    .name     = "Slideshow",
+    .frame_us = 10000,   // poll; photos change on the slideshow's own schedule
+    .start    = slideshow_start,
+    .step     = slideshow_step,
+    .stop     = slideshow_stop,
+};
+
+void demo_slideshow_set_dir(const char *dir)
+{
+    s_dir = dir;
+}
+
+void demo_slideshow(display_handle_t d, uint16_t *fb, int seconds)
+{
+    demo_run_blocking(&demo_slideshow_desc, d, fb, seconds);
+}
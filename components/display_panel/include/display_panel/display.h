@@ -6,6 +6,7 @@ extern "C" {
 #include <stdbool.h>
 #include <stdint.h>
 #include "esp_err.h"
+#include "util/latency.h"
 
 /** Opaque display handle. */
 typedef struct display_handle_t_* display_handle_t;
@@ -25,12 +26,83 @@ int display_height(display_handle_t d);
 
 /**
  * Throttled draw wrapper around esp_lcd_panel_draw_bitmap().
+ * The copy into the panel framebuffer is asynchronous (DMA2D): buf is read
+ * after this returns, so it must stay untouched until display_wait_idle().
+ * Each call first waits for the previous transfer to finish.
  * Retries on ESP_ERR_INVALID_STATE (panel busy).
  */
 esp_err_t display_draw_bitmap(display_handle_t d,
                               int x0, int y0, int x1, int y1,
                               const void *buf);
 
+/**
+ * Block until every transfer submitted so far has finished reading its
+ * source buffer. ESP_ERR_TIMEOUT if that takes longer than timeout_ms.
+ */
+esp_err_t display_wait_idle(display_handle_t d, uint32_t timeout_ms);
+
+/**
+ * The panel's own scanout buffers (DPI, two frames), for callers that render
+ * in place: fbs[0..1] are width*height RGB565. ESP_ERR_NOT_SUPPORTED if the
+ * panel has none.
+ */
+esp_err_t display_get_frame_buffers(display_handle_t d, uint16_t *fbs[2]);
+
+/** Scanout buffer shown now (or from the next refresh, after display_flip()). */
+uint16_t *display_front_buffer(display_handle_t d);
+
+/**
+ * Make fb (one of display_get_frame_buffers()) the scanout buffer from the
+ * next refresh. No copy and no throttle. The previous front buffer is still
+ * being scanned until display_wait_flip() returns.
+ */
+esp_err_t display_flip(display_handle_t d, const uint16_t *fb);
+
+/** Block until the last flip is on screen and the other buffer is free to draw into. */
+esp_err_t display_wait_flip(display_handle_t d, uint32_t timeout_ms);
+
+/** Panel refresh rate from the video timing (Hz). */
+float display_refresh_hz(display_handle_t d);
+
+/**
+ * Touch-to-photon token: the next display_draw_bitmap() carries t_input_us
+ * (input sample time, timing_now_us() epoch); when its transfer completes,
+ * (completion - t_input_us) is added to the latency window.
+ */
+void display_mark_input(display_handle_t d, uint64_t t_input_us);
+
+/** Rolling touch-to-photon latency: min/p50/p95/max over the last window. */
+void display_latency_get(display_handle_t d, latency_summary_t *out);
+void display_latency_reset(display_handle_t d);
+
+/** Log the latency summary every N new samples (0 = off, default). */
+void display_latency_set_logging(display_handle_t d, uint32_t every_n);
+
+/**
+ * Optional present filter for callers that don't track damage.
+ * With tile_px 32 or 64, every full-frame display_draw_bitmap() hashes each
+ * tile_px×tile_px tile (util/tile_hash) and compares with the last present;
+ * only tile rows with a changed tile are sent, as full-width bands (contiguous
+ * in the caller's buffer, so no staging copy). Nearby bands merge; too many
+ * collapse into one span. Nothing changed = no transfer. Partial presents are
+ * passed through and mark the rows they cover as unknown; a display_flip()
+ * marks the whole frame unknown. 0 turns it off.
+ */
+esp_err_t display_set_present_filter(display_handle_t d, int tile_px);
+
+typedef struct {
+    int      tile_px;    // 0 = off
+    uint32_t frames;     // full-frame presents filtered
+    uint32_t skipped;    // ...that sent nothing
+    uint32_t bands;      // transfers issued for them
+    uint64_t px_in;      // pixels offered
+    uint64_t px_sent;    // pixels transferred
+    uint64_t hash_us;    // time spent hashing
+} display_filter_stats_t;
+
+void display_get_present_filter_stats(display_handle_t d, display_filter_stats_t *out);
+void display_reset_present_filter_stats(display_handle_t d);
+
 /** Turn panel on/off. */
 esp_err_t display_on(display_handle_t d, bool on);
 
@@ -1,18 +1,26 @@
 #include "display_panel/display.h"
 
 #include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "freertos/task.h"
+#include <string.h>
+#include "esp_attr.h"
 #include "esp_check.h"
 #include "esp_log.h"
 
 #include "board/board.h"
+#include "util/latency.h"
+#include "util/mem.h"
+#include "util/tile_hash.h"
+#include "util/trace.h"
 
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_vendor.h"
 #include "esp_lcd_dsi.h"
 #include "esp_lcd_panel_rgb.h"
-#include "esp_heap_caps.h"          // heap_caps_calloc()
+#include "esp_heap_caps.h"          // MALLOC_CAP_*
+#include "esp_timer.h"
 
 #include "esp_lcd_jd9365_10_1.h"    // JD9365 macros + vendor config
 
@@ -22,25 +30,191 @@ typedef struct display_handle_t_ {
     esp_lcd_panel_handle_t    panel;
     int                       width;
     int                       height;
+    float                     refresh_hz;
+
+    /* Scanout buffers (DPI FBs) and flips: the front index changes on display_flip(). */
+    uint16_t                 *fbs[2];
+    int                       front;
+    volatile uint32_t         refreshes;       // frames scanned out (on_refresh_done)
+    uint32_t                  flip_at;         // refreshes when the last flip was issued
+    volatile bool             flip_pending;
+    bool                      refresh_cb_ok;
+    SemaphoreHandle_t         done_sem;        // given on every completion / refresh (ISR)
+
+    /* Touch-to-photon: input token rides on the next draw until its transfer completes. */
+    portMUX_TYPE              lat_lock;
+    bool                      trans_cb_ok;     // on_color_trans_done registered
+    uint64_t                  pending_input_us;
+    uint32_t                  submitted;       // draws accepted by esp_lcd
+    uint32_t                  completed;       // transfers finished
+    uint32_t                  inflight_seq;    // draw carrying the token (0 = none)
+    uint64_t                  inflight_input_us;
+    uint64_t                  inflight_done_us;// completion time of inflight_seq (0 = pending)
+    uint64_t                  last_done_us;
+    latency_hist_t            lat;
+    uint32_t                  log_every;
+    uint32_t                  logged_at;
+
+    /* Present filter: tile hashes of the last full frame sent. */
+    int                       filt_tile;       // 0 = off
+    int                       filt_tx, filt_ty;
+    uint32_t                 *filt_hash;       // filt_tx * filt_ty
+    uint8_t                  *filt_valid;      // per tile row: hashes match the panel
+    uint8_t                  *filt_dirty;      // per tile row, scratch
+    display_filter_stats_t    filt_st;
 } display_handle_t_;
 
+/* Filtered bands closer than this many tile rows are sent as one. */
+#ifndef DISPLAY_FILTER_MERGE_ROWS
+#define DISPLAY_FILTER_MERGE_ROWS 1
+#endif
+
+/* More bands than this collapse into one span (each present pays the throttle delay). */
+#ifndef DISPLAY_FILTER_MAX_BANDS
+#define DISPLAY_FILTER_MAX_BANDS 3
+#endif
+
 static const char *TAG = "display_panel";
 
-/* Same throttling semantics as the working demo. */
-static esp_err_t draw_bitmap_throttled(esp_lcd_panel_handle_t panel,
+/* Longest a present waits for the previous transfer before going ahead anyway. */
+#ifndef DISPLAY_IDLE_TIMEOUT_MS
+#define DISPLAY_IDLE_TIMEOUT_MS 100
+#endif
+
+static esp_err_t wait_idle(display_handle_t_ *h, uint32_t timeout_ms);
+
+/*
+ * One transfer in flight at a time. With the completion callback this waits
+ * exactly as long as the previous copy needs; without it, fall back to the
+ * working demo's fixed 3-tick spacing.
+ */
+static esp_err_t draw_bitmap_throttled(display_handle_t_ *h,
                                        int x0, int y0, int x1, int y1,
                                        const void *buf)
 {
-    vTaskDelay(3);
+    if (!h->trans_cb_ok || wait_idle(h, DISPLAY_IDLE_TIMEOUT_MS) != ESP_OK) vTaskDelay(3);
     for (int tries = 0; tries < 20; ++tries) {
-        esp_err_t err = esp_lcd_panel_draw_bitmap(panel, x0, y0, x1, y1, buf);
+        /* Count the submit first: the completion can fire before draw_bitmap returns. */
+        portENTER_CRITICAL(&h->lat_lock);
+        h->submitted++;
+        portEXIT_CRITICAL(&h->lat_lock);
+        esp_err_t err = esp_lcd_panel_draw_bitmap(h->panel, x0, y0, x1, y1, buf);
         if (err == ESP_OK) return ESP_OK;
+        portENTER_CRITICAL(&h->lat_lock);
+        h->submitted--;
+        portEXIT_CRITICAL(&h->lat_lock);
         if (err == ESP_ERR_INVALID_STATE) { vTaskDelay(1); continue; }
         return err;
     }
     return ESP_ERR_TIMEOUT;
 }
 
+/*
+ * Move a completed token into the histogram. Task context only (the histogram
+ * code lives in flash); caller holds lat_lock.
+ */
+static void latency_settle_locked(display_handle_t_ *h)
+{
+    if (h->inflight_seq && h->inflight_done_us) {
+        const uint64_t dt = h->inflight_done_us - h->inflight_input_us;
+        latency_hist_add(&h->lat, dt > UINT32_MAX ? UINT32_MAX : (uint32_t)dt);
+        h->inflight_seq     = 0;
+        h->inflight_done_us = 0;
+    }
+}
+
+/*
+ * Runs from the DPI ISR, which stays live during flash operations: touch only
+ * the handle (internal RAM) and IRAM code. trace_emit() is IRAM_ATTR and its
+ * rings are internal .bss. The histogram update is left to task context.
+ */
+static bool IRAM_ATTR on_trans_done(esp_lcd_panel_handle_t panel,
+                                    esp_lcd_dpi_panel_event_data_t *edata, void *ctx)
+{
+    display_handle_t_ *h = (display_handle_t_ *)ctx;
+    TRACE_INSTANT("xfer_done");
+    /* _SAFE: a flip (draw from a panel FB) runs this callback from the caller's task. */
+    portENTER_CRITICAL_SAFE(&h->lat_lock);
+    const uint64_t now = (uint64_t)esp_timer_get_time();
+    h->completed++;
+    h->last_done_us = now;
+    if (h->inflight_seq && h->completed == h->inflight_seq) h->inflight_done_us = now;
+    const bool idle = h->completed == h->submitted;
+    portEXIT_CRITICAL_SAFE(&h->lat_lock);
+
+    BaseType_t woken = pdFALSE;
+    if (idle) xSemaphoreGiveFromISR(h->done_sem, &woken);
+    return woken == pdTRUE;
+}
+
+static bool IRAM_ATTR on_refresh_done(esp_lcd_panel_handle_t panel,
+                                      esp_lcd_dpi_panel_event_data_t *edata, void *ctx)
+{
+    display_handle_t_ *h = (display_handle_t_ *)ctx;
+    h->refreshes++;
+    BaseType_t woken = pdFALSE;
+    if (h->flip_pending) xSemaphoreGiveFromISR(h->done_sem, &woken);
+    return woken == pdTRUE;
+}
+
+/*
+ * Wait on done_sem until cond holds. The semaphore is shared by idle and flip
+ * waiters, so every waiter re-checks its own condition and passes the wakeup on.
+ */
+static esp_err_t wait_for(display_handle_t_ *h, bool (*cond)(display_handle_t_ *), uint32_t timeout_ms)
+{
+    const TickType_t t0 = xTaskGetTickCount();
+    const TickType_t limit = pdMS_TO_TICKS(timeout_ms) + 1;
+    while (!cond(h)) {
+        const TickType_t spent = xTaskGetTickCount() - t0;
+        if (spent >= limit) return ESP_ERR_TIMEOUT;
+        if (xSemaphoreTake(h->done_sem, limit - spent) == pdTRUE) xSemaphoreGive(h->done_sem);
+        if (!cond(h)) vTaskDelay(1);   // woken for the other kind of wait; let it run
+    }
+    return ESP_OK;
+}
+
+static bool is_idle(display_handle_t_ *h)
+{
+    portENTER_CRITICAL(&h->lat_lock);
+    const bool idle = h->completed == h->submitted;
+    portEXIT_CRITICAL(&h->lat_lock);
+    return idle;
+}
+
+static bool flip_landed(display_handle_t_ *h)
+{
+    portENTER_CRITICAL(&h->lat_lock);
+    const bool landed = !h->flip_pending || h->refreshes != h->flip_at;
+    if (landed) h->flip_pending = false;
+    portEXIT_CRITICAL(&h->lat_lock);
+    return landed;
+}
+
+static esp_err_t wait_idle(display_handle_t_ *h, uint32_t timeout_ms)
+{
+    if (!h->trans_cb_ok) return ESP_OK;   // completion is stamped at submit
+    return wait_for(h, is_idle, timeout_ms);
+}
+
+static void latency_maybe_log(display_handle_t_ *h)
+{
+    if (!h->log_every) return;
+    latency_summary_t s;
+    portENTER_CRITICAL(&h->lat_lock);
+    latency_settle_locked(h);
+    const uint32_t total = h->lat.total;
+    const bool due = (total - h->logged_at) >= h->log_every;
+    if (due) h->logged_at = total;
+    portEXIT_CRITICAL(&h->lat_lock);
+    if (!due) return;
+
+    display_latency_get(h, &s);
+    ESP_LOGI(TAG, "touch->photon (%u): min %u p50 %u p95 %u max %u us",
+             (unsigned)s.count, (unsigned)s.min_us, (unsigned)s.p50_us,
+             (unsigned)s.p95_us, (unsigned)s.max_us);
+}
+
 esp_err_t display_init(display_handle_t *out)
 {
     ESP_RETURN_ON_FALSE(out, ESP_ERR_INVALID_ARG, TAG, "null out");
@@ -110,22 +284,49 @@ esp_err_t display_init(display_handle_t *out)
     ESP_RETURN_ON_ERROR(esp_lcd_panel_init(panel), TAG, "panel init failed");
     ESP_RETURN_ON_ERROR(esp_lcd_panel_disp_on_off(panel, true), TAG, "panel on failed");
 
-    // --- Fill handle ---
-    display_handle_t_ *h = (display_handle_t_ *)heap_caps_calloc(1, sizeof(*h), MALLOC_CAP_DEFAULT);
+    // --- Fill handle (internal: the transfer-done ISR writes to it) ---
+    display_handle_t_ *h = (display_handle_t_ *)mem_calloc(MEM_TAG_DISPLAY, 1, sizeof(*h),
+                                                           MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
     ESP_RETURN_ON_FALSE(h, ESP_ERR_NO_MEM, TAG, "alloc handle failed");
     h->dsi_bus = dsi_bus;
     h->dbi_io  = dbi_io;
     h->panel   = panel;
     h->width   = H;
     h->height  = V;
+    portMUX_INITIALIZE(&h->lat_lock);
+    h->done_sem = xSemaphoreCreateBinary();
+    if (!h->done_sem) {
+        mem_free(MEM_TAG_DISPLAY, h);
+        ESP_LOGE(TAG, "alloc semaphore failed");
+        return ESP_ERR_NO_MEM;
+    }
+
+    const esp_lcd_video_timing_t *vt = &dpi_cfg.video_timing;
+    const int htotal = vt->h_size + vt->hsync_back_porch + vt->hsync_pulse_width + vt->hsync_front_porch;
+    const int vtotal = vt->v_size + vt->vsync_back_porch + vt->vsync_pulse_width + vt->vsync_front_porch;
+    h->refresh_hz = (float)dpi_cfg.dpi_clock_freq_mhz * 1e6f / ((float)htotal * (float)vtotal);
+
+    void *fb0 = NULL, *fb1 = NULL;
+    if (esp_lcd_dpi_panel_get_frame_buffer(panel, 2, &fb0, &fb1) == ESP_OK && fb0 && fb1) {
+        h->fbs[0] = fb0;
+        h->fbs[1] = fb1;
+    }
+
+    const esp_lcd_dpi_panel_event_callbacks_t cbs = {
+        .on_color_trans_done = on_trans_done,
+        .on_refresh_done     = on_refresh_done,
+    };
+    h->trans_cb_ok = (esp_lcd_dpi_panel_register_event_callbacks(panel, &cbs, h) == ESP_OK);
+    h->refresh_cb_ok = h->trans_cb_ok;
+    if (!h->trans_cb_ok) ESP_LOGW(TAG, "no transfer-done callback; latency measured at submit");
 
     *out = (display_handle_t)h;
     const int clk_mhz = dpi_cfg.dpi_clock_freq_mhz;
     const int lanes   = (int)vcfg.mipi_config.lane_num;
     const int fbs     = dpi_cfg.num_fbs;
 
-    ESP_LOGI(TAG, "JD9365 panel ready (%dx%d, RGB565, %dMHz, DMA2D, %d FBs, lanes=%d)",
-            H, V, clk_mhz, fbs, lanes);
+    ESP_LOGI(TAG, "JD9365 panel ready (%dx%d, RGB565, %dMHz, DMA2D, %d FBs, lanes=%d, %.1f Hz)",
+            H, V, clk_mhz, fbs, lanes, (double)h->refresh_hz);
     return ESP_OK;
 }
 
@@ -141,13 +342,303 @@ int display_height(display_handle_t d)
     return h ? h->height : 0;
 }
 
+/* One transfer plus its latency bookkeeping; token != 0 rides on this draw. */
+static esp_err_t present_region(display_handle_t_ *h, int x0, int y0, int x1, int y1,
+                                const void *buf, uint64_t token)
+{
+    TRACE_COUNTER("present_px", (x1 - x0) * (y1 - y0));
+    esp_err_t err = draw_bitmap_throttled(h, x0, y0, x1, y1, buf);
+    if (err != ESP_OK) return err;
+
+    portENTER_CRITICAL(&h->lat_lock);
+    if (!h->trans_cb_ok) {
+        h->completed    = h->submitted;
+        h->last_done_us = (uint64_t)esp_timer_get_time();
+    }
+    latency_settle_locked(h);      // an earlier token may have completed since
+    if (token) {
+        h->inflight_seq      = h->submitted;
+        h->inflight_input_us = token;
+        h->inflight_done_us  = (h->completed == h->submitted) ? h->last_done_us : 0;  // already done?
+    }
+    portEXIT_CRITICAL(&h->lat_lock);
+    return ESP_OK;
+}
+
+/* A pass-through present changed rows [y0,y1) behind the filter's back. */
+static void filter_invalidate(display_handle_t_ *h, int y0, int y1)
+{
+    const int t = h->filt_tile;
+    for (int r = (y0 > 0 ? y0 : 0) / t; r < h->filt_ty && r * t < y1; ++r) h->filt_valid[r] = 0;
+}
+
+/* Hash every tile; mark tile rows that differ from what the panel holds. */
+static int filter_scan(display_handle_t_ *h, const uint16_t *fb)
+{
+    const int W = h->width, H = h->height, t = h->filt_tile;
+    int changed = 0;
+    for (int r = 0; r < h->filt_ty; ++r) {
+        const int y0 = r * t;
+        const int th = (y0 + t <= H) ? t : H - y0;
+        uint32_t *hr = h->filt_hash + (size_t)r * h->filt_tx;
+        bool dirty = !h->filt_valid[r];
+        for (int c = 0; c < h->filt_tx; ++c) {
+            const int x0 = c * t;
+            const int tw = (x0 + t <= W) ? t : W - x0;
+            const uint32_t v = tile_hash565(fb + (size_t)y0 * W + x0, W, tw, th);
+            if (v != hr[c]) dirty = true;
+            hr[c] = v;
+        }
+        h->filt_dirty[r] = dirty;
+        h->filt_valid[r] = 1;
+        changed += dirty;
+    }
+    return changed;
+}
+
+/* Full frame through the filter: send only changed tile rows as full-width bands. */
+static esp_err_t present_filtered(display_handle_t_ *h, const uint16_t *fb, uint64_t token)
+{
+    const int W = h->width, H = h->height, t = h->filt_tile;
+    display_filter_stats_t *st = &h->filt_st;
+
+    const uint64_t t0 = (uint64_t)esp_timer_get_time();
+    const int changed = filter_scan(h, fb);
+    st->hash_us += (uint64_t)esp_timer_get_time() - t0;
+    st->frames++;
+    st->px_in += (uint64_t)W * (uint64_t)H;
+    if (!changed) {
+        st->skipped++;  // panel already shows this frame; any input token has no photon
+        return ESP_OK;
+    }
+
+    int band[DISPLAY_FILTER_MAX_BANDS + 1][2];
+    int nb = 0, first = -1, last = -1;
+    for (int r = 0; r < h->filt_ty; ++r) {
+        if (!h->filt_dirty[r]) continue;
+        if (first < 0) first = r;
+        if (nb && r - band[nb - 1][1] - 1 <= DISPLAY_FILTER_MERGE_ROWS) {
+            band[nb - 1][1] = r;
+        } else if (nb <= DISPLAY_FILTER_MAX_BANDS) {
+            band[nb][0] = band[nb][1] = r;
+            nb++;
+        }
+        last = r;
+    }
+    if (nb > DISPLAY_FILTER_MAX_BANDS) {
+        nb = 1;
+        band[0][0] = first;
+        band[0][1] = last;
+    }
+
+    for (int i = 0; i < nb; ++i) {
+        const int y0 = band[i][0] * t;
+        const int y1 = ((band[i][1] + 1) * t < H) ? (band[i][1] + 1) * t : H;
+        const esp_err_t err = present_region(h, 0, y0, W, y1, fb + (size_t)y0 * W,
+                                             i == nb - 1 ? token : 0);
+        if (err != ESP_OK) {
+            for (int r = 0; r < h->filt_ty; ++r) h->filt_valid[r] = 0;  // panel state unknown
+            return err;
+        }
+        st->bands++;
+        st->px_sent += (uint64_t)W * (uint64_t)(y1 - y0);
+    }
+    return ESP_OK;
+}
+
 esp_err_t display_draw_bitmap(display_handle_t d,
                               int x0, int y0, int x1, int y1,
                               const void *buf)
 {
     display_handle_t_ *h = (display_handle_t_ *)d;
     if (!h || !buf) return ESP_ERR_INVALID_ARG;
-    return draw_bitmap_throttled(h->panel, x0, y0, x1, y1, buf);
+
+    TRACE_SCOPE("present");
+
+    const uint64_t token = h->pending_input_us;
+    h->pending_input_us = 0;
+
+    esp_err_t err;
+    if (h->filt_tile && x0 == 0 && y0 == 0 && x1 == h->width && y1 == h->height) {
+        err = present_filtered(h, (const uint16_t *)buf, token);
+    } else {
+        if (h->filt_tile) filter_invalidate(h, y0, y1);
+        err = present_region(h, x0, y0, x1, y1, buf, token);
+    }
+    if (err != ESP_OK) return err;
+
+    latency_maybe_log(h);
+    return ESP_OK;
+}
+
+esp_err_t display_wait_idle(display_handle_t d, uint32_t timeout_ms)
+{
+    display_handle_t_ *h = (display_handle_t_ *)d;
+    ESP_RETURN_ON_FALSE(h, ESP_ERR_INVALID_ARG, TAG, "null handle");
+    return wait_idle(h, timeout_ms);
+}
+
+esp_err_t display_get_frame_buffers(display_handle_t d, uint16_t *fbs[2])
+{
+    display_handle_t_ *h = (display_handle_t_ *)d;
+    ESP_RETURN_ON_FALSE(h && fbs, ESP_ERR_INVALID_ARG, TAG, "bad args");
+    if (!h->fbs[0] || !h->refresh_cb_ok) return ESP_ERR_NOT_SUPPORTED;
+    fbs[0] = h->fbs[0];
+    fbs[1] = h->fbs[1];
+    return ESP_OK;
+}
+
+uint16_t *display_front_buffer(display_handle_t d)
+{
+    display_handle_t_ *h = (display_handle_t_ *)d;
+    return h ? h->fbs[h->front] : NULL;
+}
+
+esp_err_t display_flip(display_handle_t d, const uint16_t *fb)
+{
+    display_handle_t_ *h = (display_handle_t_ *)d;
+    ESP_RETURN_ON_FALSE(h && fb, ESP_ERR_INVALID_ARG, TAG, "bad args");
+    const int idx = (fb == h->fbs[0]) ? 0 : (fb == h->fbs[1]) ? 1 : -1;
+    ESP_RETURN_ON_FALSE(idx >= 0, ESP_ERR_INVALID_ARG, TAG, "not a panel frame buffer");
+
+    TRACE_SCOPE("flip");
+    const uint64_t token = h->pending_input_us;
+    h->pending_input_us = 0;
+
+    /* Our own FB: esp_lcd just retargets scanout at the next frame start, no DMA2D copy. */
+    portENTER_CRITICAL(&h->lat_lock);
+    h->flip_at      = h->refreshes;
+    h->flip_pending = true;
+    h->submitted++;
+    portEXIT_CRITICAL(&h->lat_lock);
+    esp_err_t err = esp_lcd_panel_draw_bitmap(h->panel, 0, 0, h->width, h->height, fb);
+    portENTER_CRITICAL(&h->lat_lock);
+    if (err != ESP_OK) {
+        h->submitted--;
+        h->flip_pending = false;
+    } else {
+        h->front = idx;
+        if (!h->trans_cb_ok) {
+            h->completed    = h->submitted;
+            h->last_done_us = (uint64_t)esp_timer_get_time();
+        }
+        latency_settle_locked(h);
+        if (token) {
+            h->inflight_seq      = h->submitted;
+            h->inflight_input_us = token;
+            h->inflight_done_us  = (h->completed == h->submitted) ? h->last_done_us : 0;
+        }
+    }
+    portEXIT_CRITICAL(&h->lat_lock);
+    ESP_RETURN_ON_ERROR(err, TAG, "flip failed");
+    /* Scanout moved to another buffer: the filter's hashes no longer describe the panel. */
+    if (h->filt_tile) filter_invalidate(h, 0, h->height);
+    latency_maybe_log(h);
+    return ESP_OK;
+}
+
+esp_err_t display_wait_flip(display_handle_t d, uint32_t timeout_ms)
+{
+    display_handle_t_ *h = (display_handle_t_ *)d;
+    ESP_RETURN_ON_FALSE(h, ESP_ERR_INVALID_ARG, TAG, "null handle");
+    ESP_RETURN_ON_FALSE(h->refresh_cb_ok, ESP_ERR_NOT_SUPPORTED, TAG, "no refresh callback");
+    return wait_for(h, flip_landed, timeout_ms);
+}
+
+float display_refresh_hz(display_handle_t d)
+{
+    display_handle_t_ *h = (display_handle_t_ *)d;
+    return h ? h->refresh_hz : 0.0f;
+}
+
+static void filter_free(display_handle_t_ *h)
+{
+    mem_free(MEM_TAG_DISPLAY, h->filt_hash);
+    mem_free(MEM_TAG_DISPLAY, h->filt_valid);
+    mem_free(MEM_TAG_DISPLAY, h->filt_dirty);
+    h->filt_hash  = NULL;
+    h->filt_valid = h->filt_dirty = NULL;
+    h->filt_tile  = 0;
+}
+
+esp_err_t display_set_present_filter(display_handle_t d, int tile_px)
+{
+    display_handle_t_ *h = (display_handle_t_ *)d;
+    ESP_RETURN_ON_FALSE(h, ESP_ERR_INVALID_ARG, TAG, "null handle");
+    ESP_RETURN_ON_FALSE(tile_px == 0 || tile_px == 32 || tile_px == 64, ESP_ERR_INVALID_ARG,
+                        TAG, "tile_px must be 0, 32 or 64");
+    if (tile_px == h->filt_tile) return ESP_OK;
+    filter_free(h);
+    h->filt_st = (display_filter_stats_t){0};
+    if (!tile_px) return ESP_OK;
+
+    const int tx = (h->width + tile_px - 1) / tile_px;
+    const int ty = (h->height + tile_px - 1) / tile_px;
+    h->filt_hash  = mem_calloc(MEM_TAG_DISPLAY, (size_t)tx * ty, sizeof(uint32_t), MALLOC_CAP_DEFAULT);
+    h->filt_valid = mem_calloc(MEM_TAG_DISPLAY, (size_t)ty, 1, MALLOC_CAP_DEFAULT);
+    h->filt_dirty = mem_calloc(MEM_TAG_DISPLAY, (size_t)ty, 1, MALLOC_CAP_DEFAULT);
+    if (!h->filt_hash || !h->filt_valid || !h->filt_dirty) {
+        filter_free(h);
+        return ESP_ERR_NO_MEM;
+    }
+    h->filt_tx   = tx;
+    h->filt_ty   = ty;
+    h->filt_tile = tile_px;  // every row starts invalid: the first frame goes out whole
+    h->filt_st.tile_px = tile_px;
+    ESP_LOGI(TAG, "present filter: %dx%d tiles of %d px", tx, ty, tile_px);
+    return ESP_OK;
+}
+
+void display_get_present_filter_stats(display_handle_t d, display_filter_stats_t *out)
+{
+    display_handle_t_ *h = (display_handle_t_ *)d;
+    if (!out) return;
+    if (!h) { memset(out, 0, sizeof(*out)); return; }
+    *out = h->filt_st;
+}
+
+void display_reset_present_filter_stats(display_handle_t d)
+{
+    display_handle_t_ *h = (display_handle_t_ *)d;
+    if (h) h->filt_st = (display_filter_stats_t){ .tile_px = h->filt_tile };
+}
+
+void display_mark_input(display_handle_t d, uint64_t t_input_us)
+{
+    display_handle_t_ *h = (display_handle_t_ *)d;
+    if (h && t_input_us) h->pending_input_us = t_input_us;
+}
+
+void display_latency_get(display_handle_t d, latency_summary_t *out)
+{
+    display_handle_t_ *h = (display_handle_t_ *)d;
+    if (!out) return;
+    if (!h) { memset(out, 0, sizeof(*out)); return; }
+
+    latency_hist_t snap;
+    portENTER_CRITICAL(&h->lat_lock);
+    latency_settle_locked(h);
+    snap = h->lat;
+    portEXIT_CRITICAL(&h->lat_lock);
+    latency_hist_summary(&snap, out);
+}
+
+void display_latency_reset(display_handle_t d)
+{
+    display_handle_t_ *h = (display_handle_t_ *)d;
+    if (!h) return;
+    portENTER_CRITICAL(&h->lat_lock);
+    latency_hist_reset(&h->lat);
+    h->inflight_seq     = 0;
+    h->inflight_done_us = 0;
+    h->logged_at    = 0;
+    portEXIT_CRITICAL(&h->lat_lock);
+}
+
+void display_latency_set_logging(display_handle_t d, uint32_t every_n)
+{
+    display_handle_t_ *h = (display_handle_t_ *)d;
+    if (h) h->log_every = every_n;
 }
 
 esp_err_t display_on(display_handle_t d, bool on)
@@ -0,0 +1,85 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "display_panel/display.h"
+
+/*
+ * Image-sequence container (little-endian), built by tools/mkseq.py:
+ *
+ *   header : "ISEQ" | u16 version | u16 width | u16 height | u16 frames | u32 frame_us
+ *   table  : frames × { u32 offset | u32 size | u8 kind | u8 pad[3] }   (offset from blob start)
+ *   frames :
+ *     RAW   : width×height RGB565, 4-byte aligned            (a keyframe; frame 0 must be RAW)
+ *     DELTA : u16 rect_count | u16 pad, then per rect:
+ *             u16 x | u16 y | u16 w | u16 h | u16 flags | u16 pad | u32 bytes | payload
+ *             flags & IMG_SEQ_RECT_RAW : payload is w×h RGB565, 4-byte aligned
+ *             otherwise payload is runs: u16 token; bit15 set → (token & 0x7FFF) copies
+ *             of the next u16, clear → token literal pixels follow. Runs may cross rows.
+ *             Each payload is padded to 4 bytes.
+ *
+ * Raw frames and raw rects are presented straight from the mapping; run-coded
+ * rects are expanded in row strips into the two halves of a small scratch
+ * buffer, one strip expanding while the other is copied out. No frame-sized
+ * buffer is ever allocated.
+ */
+#define IMG_SEQ_MAGIC        "ISEQ"
+#define IMG_SEQ_VERSION      1
+#define IMG_SEQ_HEADER_LEN   16
+#define IMG_SEQ_ENTRY_LEN    12
+#define IMG_SEQ_RECT_LEN     16
+
+#define IMG_SEQ_KIND_RAW     0
+#define IMG_SEQ_KIND_DELTA   1
+#define IMG_SEQ_RECT_RAW     0x0001
+
+/* Scratch for run-coded rects (pixels, both halves); rects wider than half fail to decode. */
+#ifndef IMG_SEQ_SCRATCH_PX
+#define IMG_SEQ_SCRATCH_PX   (16 * 1024)
+#endif
+
+typedef struct img_seq_t_ *img_seq_handle_t;
+
+typedef struct {
+    int      width, height;
+    int      frames;
+    uint32_t frame_us;
+} img_seq_info_t;
+
+typedef struct {
+    int      index;        // frame just presented
+    int      kind;         // IMG_SEQ_KIND_*
+    int      rects;        // presents issued
+    uint32_t px;           // pixels pushed
+    uint32_t zero_copy_px; // of which straight from the mapping
+} img_seq_frame_stats_t;
+
+/** Map a data partition by label and validate its header and frame table. */
+esp_err_t img_seq_open_partition(const char *label, img_seq_handle_t *out);
+
+/** Use an already-resident blob (embedded file, another mapping); not copied. */
+esp_err_t img_seq_open_mem(const void *data, size_t len, img_seq_handle_t *out);
+
+void img_seq_close(img_seq_handle_t h);
+
+void img_seq_get_info(img_seq_handle_t h, img_seq_info_t *out);
+
+/**
+ * Present the next frame with its top-left at (x, y), wrapping to frame 0
+ * after the last. Delta frames only touch their rects, so the panel must
+ * still show the previous frame.
+ */
+esp_err_t img_seq_present_next(img_seq_handle_t h, display_handle_t d, int x, int y,
+                               img_seq_frame_stats_t *stats);
+
+/** Restart from frame 0 on the next present. */
+void img_seq_rewind(img_seq_handle_t h);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,118 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "display_panel/display.h"
+#include "ui_gfx/color_conv.h"
+
+/*
+ * Streaming baseline JPEG decoder (software, portable C).
+ *
+ * Supports sequential Huffman JPEG (SOF0/SOF1, 8-bit), grayscale or YCbCr
+ * with 4:4:4, 4:2:2, 4:4:0 or 4:2:0 sampling, and restart intervals.
+ * Progressive and arithmetic-coded files fail with ESP_ERR_NOT_SUPPORTED.
+ *
+ * Output goes one MCU row at a time: each MCU is IDCT'd, optionally scaled by
+ * 1/2, 1/4 or 1/8, and converted straight to RGB565 with ordered dithering
+ * into a band buffer of out_w × MCU height. No image-sized buffer is ever
+ * allocated; peak memory is the handle (~7.5 KB, plus JPEG_DEC_IN_BUF when
+ * reader-fed) plus the band, or two bands for an asynchronous sink: one is
+ * decoded into while the sink still reads the other.
+ */
+
+/* Input buffer for reader-fed decodes (bytes, allocated with the handle). */
+#ifndef JPEG_DEC_IN_BUF
+#define JPEG_DEC_IN_BUF 4096
+#endif
+
+/* How long jpeg_sink_display_idle() waits for the panel to finish a band. */
+#ifndef JPEG_DEC_IDLE_TIMEOUT_MS
+#define JPEG_DEC_IDLE_TIMEOUT_MS 100
+#endif
+
+typedef struct jpeg_dec_t_ *jpeg_dec_handle_t;
+
+/* Fill buf with up to len bytes; returns bytes read, 0 at end of data, < 0 on error. */
+typedef int (*jpeg_read_fn_t)(void *ctx, uint8_t *buf, size_t len);
+
+/*
+ * Receive a decoded band (RGB565, stride w) for output rect (x, y, w, h). The
+ * sink may rewrite px in place (e.g. to pack a clipped band). A synchronous
+ * sink is done with px when it returns; an asynchronous one (on_idle set) may
+ * keep reading it until the next on_band call returns.
+ */
+typedef esp_err_t (*jpeg_band_fn_t)(void *ctx, int x, int y, int w, int h, uint16_t *px);
+
+/* Block until the sink has stopped reading every band it was given. */
+typedef esp_err_t (*jpeg_idle_fn_t)(void *ctx);
+
+typedef struct {
+    int width, height;       // source pixels
+    int components;          // 1 (gray) or 3 (YCbCr)
+    int mcu_w, mcu_h;        // 8 or 16
+    int restart_interval;    // MCUs, 0 = none
+} jpeg_info_t;
+
+typedef struct {
+    int            scale_shift;  // output is source >> scale_shift (0..3)
+    ui_dither_t    dither;       // ordered modes; DIFFUSION is treated as BAYER8
+    int            x, y;         // output origin passed to on_band (sets the dither phase)
+    int            band_mcu_rows;// MCU rows per band (0 = 1); more rows = fewer, larger bands
+    jpeg_band_fn_t on_band;
+    jpeg_idle_fn_t on_idle;      // NULL: on_band is synchronous; else called before the bands are freed
+    void          *ctx;
+} jpeg_out_t;
+
+typedef struct {
+    int      out_w, out_h;
+    int      bands;
+    uint32_t decode_us;      // entropy decode, IDCT, color conversion
+    uint32_t sink_us;        // inside on_band
+    uint32_t us_per_mpx;     // decode_us per source megapixel
+    size_t   peak_bytes;     // handle + input buffer + band buffer(s)
+} jpeg_dec_stats_t;
+
+/** Parse headers up to the first scan from a reader callback. */
+esp_err_t jpeg_dec_open(jpeg_read_fn_t read, void *ctx, jpeg_dec_handle_t *out);
+
+/** Same, from a resident buffer (mmapped partition, embedded file); not copied. */
+esp_err_t jpeg_dec_open_mem(const void *data, size_t len, jpeg_dec_handle_t *out);
+
+void jpeg_dec_close(jpeg_dec_handle_t h);
+
+void jpeg_dec_get_info(jpeg_dec_handle_t h, jpeg_info_t *out);
+
+/** Smallest scale_shift (0..3) at which the image fits max_w × max_h (3 if none does). */
+int jpeg_dec_fit_shift(const jpeg_info_t *info, int max_w, int max_h);
+
+/** Decode the image, emitting bands top to bottom. A handle decodes once. */
+esp_err_t jpeg_dec_run(jpeg_dec_handle_t h, const jpeg_out_t *out, jpeg_dec_stats_t *stats);
+
+/* ---- ready-made band sinks ---- */
+
+typedef struct {
+    uint16_t *fb;
+    int       w, h;           // framebuffer size; bands are clipped to it
+} jpeg_fb_sink_t;
+
+/** on_band for a jpeg_fb_sink_t: copy the band into the framebuffer. */
+esp_err_t jpeg_sink_fb(void *ctx, int x, int y, int w, int h, uint16_t *px);
+
+/*
+ * on_band with a display_handle_t as ctx: present each band, clipped to the
+ * panel, as one transfer. The transfer is asynchronous, so pair it with
+ * on_idle = jpeg_sink_display_idle.
+ */
+esp_err_t jpeg_sink_display(void *ctx, int x, int y, int w, int h, uint16_t *px);
+
+/** on_idle for jpeg_sink_display: wait for the last band's transfer. */
+esp_err_t jpeg_sink_display_idle(void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,113 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "display_panel/display.h"
+#include "ui_gfx/color_conv.h"
+
+/*
+ * Photo slideshow as a three-stage pipeline:
+ *
+ *   reader  : copies the next JPEG from the "photos" partition (or a directory)
+ *             into a file slot
+ *   decoder : (pinned, normally core 1) decodes it, fitted and centred, into a
+ *             full-screen frame slot
+ *   presenter: slideshow_poll() on the caller's task shows the next ready
+ *             frame when its time comes
+ *
+ * With two frame slots, photo N+1 is decoded while N is on screen, so the
+ * switch is a single present. A frame slot is recycled once the following
+ * present has been issued.
+ *
+ * Partition layout (little-endian), built by tools/mkphotos.py:
+ *
+ *   header : "PHOT" | u16 version | u16 count
+ *   table  : count × { u32 offset | u32 size }   (offset from partition start)
+ *   files  : baseline JPEGs, each 4-byte aligned
+ *
+ * With cfg.dir set, the photos are instead the *.jpg / *.jpeg files in that
+ * directory, in name order, read with stdio: a host folder, or a mounted VFS
+ * path (SD card, FAT) on the device. The list is taken once at open.
+ */
+#define SLIDESHOW_MAGIC       "PHOT"
+#define SLIDESHOW_VERSION     1
+#define SLIDESHOW_HEADER_LEN  8
+#define SLIDESHOW_ENTRY_LEN   8
+
+#define SLIDESHOW_MAX_SLOTS   4
+
+typedef struct slideshow_t_ *slideshow_handle_t;
+
+typedef struct {
+    const char *partition;     // data partition label
+    const char *dir;           // read photos from this directory instead (NULL = partition); kept, not copied
+    uint32_t    dwell_ms;      // time each photo stays up (0 = as fast as decoded)
+    int         frame_slots;   // decoded full-screen frames (2..SLIDESHOW_MAX_SLOTS)
+    int         file_slots;    // prefetched compressed files (1..SLIDESHOW_MAX_SLOTS)
+    ui_dither_t dither;
+    uint16_t    background;    // RGB565 letterbox color
+    int         decode_core;
+    int         task_prio;     // reader and decoder
+} slideshow_cfg_t;
+
+#define SLIDESHOW_CFG_DEFAULT() {       \
+    .partition   = "photos",            \
+    .dir         = NULL,                \
+    .dwell_ms    = 5000,                \
+    .frame_slots = 2,                   \
+    .file_slots  = 2,                   \
+    .dither      = UI_DITHER_BAYER8,    \
+    .background  = 0x0000,              \
+    .decode_core = 1,                   \
+    .task_prio   = 4,                   \
+}
+
+typedef struct {
+    int      photos;           // in the partition or directory
+    uint32_t shown;            // frames presented
+    uint32_t late;             // times a photo was due and its successor wasn't decoded yet
+    uint32_t errors;           // files skipped (read or decode failure)
+
+    /* Last and worst per-photo stage times. */
+    uint32_t read_us, read_max_us;
+    uint32_t decode_us, decode_max_us;       // including letterbox fill
+    uint32_t present_us, present_max_us;
+    uint32_t decode_us_per_mpx;              // last photo, per source megapixel
+
+    /* Queue depth now, and the lowest ready-frame depth seen at a due time. */
+    int      files_ready;
+    int      frames_ready;
+    int      frames_ready_min;
+} slideshow_stats_t;
+
+/**
+ * Validate the partition's table (or list the directory), allocate the slots
+ * and start the reader and decoder tasks.
+ */
+esp_err_t slideshow_open(const slideshow_cfg_t *cfg, display_handle_t d, slideshow_handle_t *out);
+
+/**
+ * Presenter step; call often from the UI task. Shows the next decoded photo
+ * once the current one has been up for dwell_ms (the first one as soon as it
+ * is ready). Returns true when it presented.
+ */
+bool slideshow_poll(slideshow_handle_t h, uint64_t now_us);
+
+/**
+ * Change dwell_ms from the presenter's task. The photo on screen is due
+ * dwell_ms after it went up, so shortening can make it due at once.
+ */
+void slideshow_set_dwell(slideshow_handle_t h, uint32_t dwell_ms);
+
+void slideshow_get_stats(slideshow_handle_t h, slideshow_stats_t *out);
+
+/** Stop both stages (waits for the current decode and the last present) and free everything. */
+void slideshow_close(slideshow_handle_t h);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,252 @@
+#include "image/img_seq.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "util/mem.h"
+
+static const char *TAG = "img_seq";
+
+typedef struct img_seq_t_ {
+    const uint8_t *base;
+    size_t         len;
+    bool           mapped;
+    esp_partition_mmap_handle_t mmap;
+    img_seq_info_t info;
+    int            next;
+    uint16_t      *scratch;   // two strip halves, lazily allocated on the first run-coded rect
+    int            half;      // half the next strip expands into
+    display_handle_t last_d;  // display the last present went to (close waits on it)
+} img_seq_t_;
+
+static inline uint16_t rd16(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static inline uint32_t rd32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* ---- run decoder (state carries across strips) ---- */
+typedef struct {
+    const uint8_t *p, *end;
+    uint32_t       left;
+    bool           fill;
+    uint16_t       value;
+} runs_t;
+
+static bool runs_emit(runs_t *r, uint16_t *out, uint32_t n)
+{
+    while (n) {
+        if (!r->left) {
+            if (r->end - r->p < 2) return false;
+            const uint16_t tok = rd16(r->p);
+            r->p += 2;
+            r->fill = (tok & 0x8000) != 0;
+            r->left = tok & 0x7FFF;
+            if (!r->left) return false;
+            if (r->fill) {
+                if (r->end - r->p < 2) return false;
+                r->value = rd16(r->p);
+                r->p += 2;
+            }
+        }
+        const uint32_t k = n < r->left ? n : r->left;
+        if (r->fill) {
+            for (uint32_t i = 0; i < k; ++i) out[i] = r->value;
+        } else {
+            if ((size_t)(r->end - r->p) < k * 2) return false;
+            memcpy(out, r->p, k * 2);
+            r->p += k * 2;
+        }
+        out += k; n -= k; r->left -= k;
+    }
+    return true;
+}
+
+static esp_err_t validate(img_seq_t_ *h)
+{
+    const uint8_t *b = h->base;
+    ESP_RETURN_ON_FALSE(h->len >= IMG_SEQ_HEADER_LEN && memcmp(b, IMG_SEQ_MAGIC, 4) == 0,
+                        ESP_ERR_INVALID_RESPONSE, TAG, "bad magic");
+    ESP_RETURN_ON_FALSE(rd16(b + 4) == IMG_SEQ_VERSION, ESP_ERR_INVALID_VERSION, TAG,
+                        "version %u", rd16(b + 4));
+    h->info = (img_seq_info_t){
+        .width = rd16(b + 6), .height = rd16(b + 8), .frames = rd16(b + 10), .frame_us = rd32(b + 12),
+    };
+    const img_seq_info_t *in = &h->info;
+    ESP_RETURN_ON_FALSE(in->width > 0 && in->height > 0 && in->frames > 0, ESP_ERR_INVALID_SIZE,
+                        TAG, "empty sequence");
+    ESP_RETURN_ON_FALSE(IMG_SEQ_HEADER_LEN + (size_t)in->frames * IMG_SEQ_ENTRY_LEN <= h->len,
+                        ESP_ERR_INVALID_SIZE, TAG, "truncated table");
+
+    const size_t raw_bytes = (size_t)in->width * in->height * sizeof(uint16_t);
+    for (int i = 0; i < in->frames; ++i) {
+        const uint8_t *e = b + IMG_SEQ_HEADER_LEN + (size_t)i * IMG_SEQ_ENTRY_LEN;
+        const uint32_t off = rd32(e), size = rd32(e + 4);
+        const uint8_t kind = e[8];
+        ESP_RETURN_ON_FALSE(off <= h->len && size <= h->len - off, ESP_ERR_INVALID_SIZE,
+                            TAG, "frame %d out of bounds", i);
+        ESP_RETURN_ON_FALSE(kind == IMG_SEQ_KIND_RAW || kind == IMG_SEQ_KIND_DELTA,
+                            ESP_ERR_INVALID_RESPONSE, TAG, "frame %d kind %u", i, kind);
+        if (kind == IMG_SEQ_KIND_RAW) {
+            ESP_RETURN_ON_FALSE(size == raw_bytes && (off & 3) == 0, ESP_ERR_INVALID_SIZE,
+                                TAG, "frame %d raw size/alignment", i);
+        }
+        ESP_RETURN_ON_FALSE(i != 0 || kind == IMG_SEQ_KIND_RAW, ESP_ERR_INVALID_RESPONSE,
+                            TAG, "frame 0 must be raw");
+    }
+    return ESP_OK;
+}
+
+esp_err_t img_seq_open_mem(const void *data, size_t len, img_seq_handle_t *out)
+{
+    ESP_RETURN_ON_FALSE(data && out, ESP_ERR_INVALID_ARG, TAG, "bad args");
+    img_seq_t_ *h = mem_calloc(MEM_TAG_IMAGE, 1, sizeof(*h), MALLOC_CAP_DEFAULT);
+    ESP_RETURN_ON_FALSE(h, ESP_ERR_NO_MEM, TAG, "no mem");
+    h->base = data;
+    h->len  = len;
+    const esp_err_t err = validate(h);
+    if (err != ESP_OK) {
+        mem_free(MEM_TAG_IMAGE, h);
+        return err;
+    }
+    *out = h;
+    return ESP_OK;
+}
+
+esp_err_t img_seq_open_partition(const char *label, img_seq_handle_t *out)
+{
+    ESP_RETURN_ON_FALSE(label && out, ESP_ERR_INVALID_ARG, TAG, "bad args");
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                           ESP_PARTITION_SUBTYPE_ANY, label);
+    ESP_RETURN_ON_FALSE(part, ESP_ERR_NOT_FOUND, TAG, "no partition '%s'", label);
+
+    const void *ptr = NULL;
+    esp_partition_mmap_handle_t mh;
+    ESP_RETURN_ON_ERROR(esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &ptr, &mh),
+                        TAG, "mmap '%s'", label);
+
+    esp_err_t err = img_seq_open_mem(ptr, part->size, out);
+    if (err != ESP_OK) {
+        esp_partition_munmap(mh);
+        return err;
+    }
+    (*out)->mapped = true;
+    (*out)->mmap   = mh;
+    ESP_LOGI(TAG, "'%s': %dx%d, %d frames @ %u us", label, (*out)->info.width,
+             (*out)->info.height, (*out)->info.frames, (unsigned)(*out)->info.frame_us);
+    return ESP_OK;
+}
+
+void img_seq_close(img_seq_handle_t h)
+{
+    if (!h) return;
+    /* The last strip or zero-copy rect may still be on its way to the panel. */
+    if (h->last_d) (void)display_wait_idle(h->last_d, 100);
+    if (h->mapped) esp_partition_munmap(h->mmap);
+    mem_free(MEM_TAG_IMAGE, h->scratch);
+    mem_free(MEM_TAG_IMAGE, h);
+}
+
+void img_seq_get_info(img_seq_handle_t h, img_seq_info_t *out)
+{
+    if (h && out) *out = h->info;
+}
+
+void img_seq_rewind(img_seq_handle_t h)
+{
+    if (h) h->next = 0;
+}
+
+/*
+ * Expand run-coded rows strip by strip, alternating between the two scratch
+ * halves. A present waits for the transfer before it, so at most one strip is
+ * in flight when the next is expanded, and it always reads the other half:
+ * expansion overlaps the copy and never overwrites pixels still being read.
+ */
+static esp_err_t present_runs(img_seq_t_ *h, display_handle_t d, int x, int y, int w, int rh,
+                              const uint8_t *payload, uint32_t bytes)
+{
+    const int half_px = IMG_SEQ_SCRATCH_PX / 2;
+    if (!h->scratch) {
+        static const uint32_t kCaps[] = { MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA, MALLOC_CAP_DEFAULT };
+        h->scratch = mem_alloc_prefer(MEM_TAG_IMAGE, 0, IMG_SEQ_SCRATCH_PX * sizeof(uint16_t), kCaps, 2);
+        ESP_RETURN_ON_FALSE(h->scratch, ESP_ERR_NO_MEM, TAG, "scratch");
+    }
+    ESP_RETURN_ON_FALSE(w <= half_px, ESP_ERR_INVALID_SIZE, TAG, "rect too wide");
+
+    runs_t r = { .p = payload, .end = payload + bytes };
+    const int strip = half_px / w;
+    for (int row = 0; row < rh; row += strip) {
+        const int n = (rh - row) < strip ? (rh - row) : strip;
+        uint16_t *buf = h->scratch + (size_t)h->half * half_px;
+        h->half ^= 1;
+        ESP_RETURN_ON_FALSE(runs_emit(&r, buf, (uint32_t)(w * n)), ESP_ERR_INVALID_SIZE,
+                            TAG, "runs truncated");
+        ESP_RETURN_ON_ERROR(display_draw_bitmap(d, x, y + row, x + w, y + row + n, buf),
+                            TAG, "present");
+    }
+    return ESP_OK;
+}
+
+static esp_err_t present_delta(img_seq_t_ *h, display_handle_t d, int ox, int oy,
+                               const uint8_t *f, uint32_t size, img_seq_frame_stats_t *st)
+{
+    ESP_RETURN_ON_FALSE(size >= 4, ESP_ERR_INVALID_SIZE, TAG, "delta header");
+    const int count = rd16(f);
+    const uint8_t *p = f + 4, *end = f + size;
+
+    for (int i = 0; i < count; ++i) {
+        ESP_RETURN_ON_FALSE(end - p >= IMG_SEQ_RECT_LEN, ESP_ERR_INVALID_SIZE, TAG, "rect %d", i);
+        const int x = rd16(p), y = rd16(p + 2), w = rd16(p + 4), rh = rd16(p + 6);
+        const uint16_t flags = rd16(p + 8);
+        const uint32_t bytes = rd32(p + 12);
+        p += IMG_SEQ_RECT_LEN;
+        ESP_RETURN_ON_FALSE(w > 0 && rh > 0 && x + w <= h->info.width && y + rh <= h->info.height &&
+                            bytes <= (uint32_t)(end - p), ESP_ERR_INVALID_SIZE, TAG, "rect %d bounds", i);
+
+        const uint32_t px = (uint32_t)w * (uint32_t)rh;
+        if (flags & IMG_SEQ_RECT_RAW) {
+            ESP_RETURN_ON_FALSE(bytes == px * 2, ESP_ERR_INVALID_SIZE, TAG, "rect %d raw size", i);
+            ESP_RETURN_ON_ERROR(display_draw_bitmap(d, ox + x, oy + y, ox + x + w, oy + y + rh, p),
+                                TAG, "present");
+            st->zero_copy_px += px;
+        } else {
+            ESP_RETURN_ON_ERROR(present_runs(h, d, ox + x, oy + y, w, rh, p, bytes), TAG, "rect %d", i);
+        }
+        st->rects++;
+        st->px += px;
+        p += (bytes + 3) & ~3u;
+        if (p > end) p = end;
+    }
+    return ESP_OK;
+}
+
+esp_err_t img_seq_present_next(img_seq_handle_t h, display_handle_t d, int x, int y,
+                               img_seq_frame_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(h && d, ESP_ERR_INVALID_ARG, TAG, "bad args");
+    img_seq_frame_stats_t st = { .index = h->next };
+    h->last_d = d;
+
+    const uint8_t *e = h->base + IMG_SEQ_HEADER_LEN + (size_t)h->next * IMG_SEQ_ENTRY_LEN;
+    const uint8_t *frame = h->base + rd32(e);
+    const uint32_t size  = rd32(e + 4);
+    st.kind = e[8];
+
+    esp_err_t err;
+    if (st.kind == IMG_SEQ_KIND_RAW) {
+        err = display_draw_bitmap(d, x, y, x + h->info.width, y + h->info.height, frame);
+        st.rects = 1;
+        st.px = st.zero_copy_px = (uint32_t)h->info.width * (uint32_t)h->info.height;
+    } else {
+        err = present_delta(h, d, x, y, frame, size, &st);
+    }
+
+    h->next = (h->next + 1) % h->info.frames;
+    if (stats) *stats = st;
+    return err;
+}
@@ -0,0 +1,724 @@
+#include "image/jpeg_dec.h"
+
+#include <string.h>
+
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "util/mem.h"
+#include "util/timing.h"
+
+static const char *TAG = "jpeg_dec";
+
+/* Codes up to this long decode with one table lookup. */
+#define HUFF_LOOK_BITS 9
+
+typedef struct {
+    uint8_t look_len[1 << HUFF_LOOK_BITS];   // 0: longer code, walk maxcode[]
+    uint8_t look_sym[1 << HUFF_LOOK_BITS];
+    int32_t maxcode[17];                     // by length; -1 = no codes of that length
+    int32_t delta[17];                       // vals index = code + delta[len]
+    uint8_t vals[256];
+    bool    present;
+} huff_t;
+
+typedef struct {
+    int id;
+    int h, v;          // sampling factors
+    int tq;            // quant table
+    int td, ta;        // DC / AC Huffman tables
+    int dc_pred;
+} comp_t;
+
+typedef struct jpeg_dec_t_ {
+    /* input: a resident buffer, or in_buf refilled from read() */
+    jpeg_read_fn_t read;
+    void          *rctx;
+    const uint8_t *p, *end;
+    uint8_t       *in_buf;
+
+    /* entropy bits, MSB-aligned; marker = first marker met inside scan data */
+    uint32_t acc;
+    int      nbits;
+    int      marker;
+
+    uint16_t qt[4][64];      // zigzag order, as stored
+    bool     qt_present[4];
+    huff_t   dc[2], ac[2];
+
+    jpeg_info_t info;
+    comp_t      comp[3];
+    int         ncomp;
+    int         hmax, vmax;
+    bool        decoded;
+
+    int32_t coef[64];
+    uint8_t blk[64];
+    uint8_t smp[3][16 * 16]; // one MCU per component, at output scale
+    uint8_t rgb[16 * 3];     // one MCU row of one MCU
+} jpeg_dec_t_;
+
+static const uint8_t kZigzag[64] = {
+     0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+static inline uint8_t clamp8(int v)
+{
+    return (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v);
+}
+
+/* ---- byte input ---- */
+
+static bool refill(jpeg_dec_t_ *d)
+{
+    if (!d->read) return false;
+    const int n = d->read(d->rctx, d->in_buf, JPEG_DEC_IN_BUF);
+    if (n <= 0) {
+        d->read = NULL;   // end of data (or a read error): no more calls
+        return false;
+    }
+    d->p   = d->in_buf;
+    d->end = d->in_buf + n;
+    return true;
+}
+
+/* Next byte, or -1 at end of data. */
+static inline int get_byte(jpeg_dec_t_ *d)
+{
+    if (d->p == d->end && !refill(d)) return -1;
+    return *d->p++;
+}
+
+static int get_u16(jpeg_dec_t_ *d)
+{
+    const int a = get_byte(d), b = get_byte(d);
+    return (a < 0 || b < 0) ? -1 : (a << 8) | b;
+}
+
+static bool skip(jpeg_dec_t_ *d, int n)
+{
+    while (n > 0) {
+        if (d->p == d->end && !refill(d)) return false;
+        const int k = (d->end - d->p) < n ? (int)(d->end - d->p) : n;
+        d->p += k;
+        n -= k;
+    }
+    return true;
+}
+
+/* Next marker code (skips fill bytes and anything before the 0xFF), -1 at end. */
+static int next_marker(jpeg_dec_t_ *d)
+{
+    int c;
+    do { c = get_byte(d); } while (c >= 0 && c != 0xFF);
+    while (c == 0xFF) c = get_byte(d);
+    return c;
+}
+
+/* ---- entropy-coded data ---- */
+
+/* Top up to at least 25 bits. Past a marker (or the end) zeros are fed in. */
+static inline void fill_bits(jpeg_dec_t_ *d)
+{
+    while (d->nbits <= 24) {
+        int b = 0;
+        if (!d->marker) {
+            b = get_byte(d);
+            if (b < 0) {
+                b = 0;
+                d->marker = 0xD9;   // truncated: behave as if EOI was met
+            } else if (b == 0xFF) {
+                int c = get_byte(d);
+                while (c == 0xFF) c = get_byte(d);
+                if (c == 0) {
+                    b = 0xFF;       // stuffed byte
+                } else {
+                    d->marker = c < 0 ? 0xD9 : c;
+                    b = 0;
+                }
+            }
+        }
+        d->acc |= (uint32_t)b << (24 - d->nbits);
+        d->nbits += 8;
+    }
+}
+
+static inline uint32_t get_bits(jpeg_dec_t_ *d, int n)
+{
+    if (!n) return 0;
+    fill_bits(d);
+    const uint32_t v = d->acc >> (32 - n);
+    d->acc <<= n;
+    d->nbits -= n;
+    return v;
+}
+
+/* Sign-extend an n-bit magnitude category value (JPEG F.2.2.1). */
+static inline int extend(uint32_t v, int n)
+{
+    return (v < (1u << (n - 1))) ? (int)v - (1 << n) + 1 : (int)v;
+}
+
+/* Decode one symbol; -1 on a code the table doesn't have. */
+static inline int huff_decode(jpeg_dec_t_ *d, const huff_t *t)
+{
+    fill_bits(d);
+    const uint32_t look = d->acc >> (32 - HUFF_LOOK_BITS);
+    int len = t->look_len[look];
+    if (len) {
+        d->acc <<= len;
+        d->nbits -= len;
+        return t->look_sym[look];
+    }
+    for (len = HUFF_LOOK_BITS + 1; len <= 16; ++len) {
+        const int32_t code = (int32_t)(d->acc >> (32 - len));
+        if (code <= t->maxcode[len]) {
+            d->acc <<= len;
+            d->nbits -= len;
+            return t->vals[code + t->delta[len]];
+        }
+    }
+    return -1;
+}
+
+static esp_err_t huff_build(huff_t *t, const uint8_t counts[16], const uint8_t *vals, int nvals)
+{
+    memset(t, 0, sizeof(*t));
+    memcpy(t->vals, vals, (size_t)nvals);
+    int code = 0, k = 0;
+    for (int len = 1; len <= 16; ++len) {
+        const int n = counts[len - 1];
+        ESP_RETURN_ON_FALSE(code + n <= (1 << len), ESP_ERR_INVALID_RESPONSE, TAG, "bad Huffman table");
+        t->delta[len]   = k - code;
+        t->maxcode[len] = n ? code + n - 1 : -1;
+        for (int i = 0; i < n; ++i, ++k, ++code) {
+            if (len > HUFF_LOOK_BITS) continue;
+            const int sh = HUFF_LOOK_BITS - len;
+            for (int j = 0; j < (1 << sh); ++j) {
+                t->look_len[(code << sh) | j] = (uint8_t)len;
+                t->look_sym[(code << sh) | j] = vals[k];
+            }
+        }
+        code <<= 1;
+    }
+    t->present = true;
+    return ESP_OK;
+}
+
+/* ---- headers ---- */
+
+static esp_err_t read_dqt(jpeg_dec_t_ *d, int len)
+{
+    while (len > 0) {
+        const int pt = get_byte(d);
+        const int prec = pt >> 4, id = pt & 15;
+        ESP_RETURN_ON_FALSE(pt >= 0 && id < 4 && prec <= 1, ESP_ERR_INVALID_RESPONSE, TAG, "DQT");
+        for (int k = 0; k < 64; ++k) {
+            const int v = prec ? get_u16(d) : get_byte(d);
+            ESP_RETURN_ON_FALSE(v >= 0, ESP_ERR_INVALID_SIZE, TAG, "DQT truncated");
+            d->qt[id][k] = (uint16_t)v;
+        }
+        d->qt_present[id] = true;
+        len -= 1 + 64 * (prec + 1);
+    }
+    ESP_RETURN_ON_FALSE(len == 0, ESP_ERR_INVALID_RESPONSE, TAG, "DQT length");
+    return ESP_OK;
+}
+
+static esp_err_t read_dht(jpeg_dec_t_ *d, int len)
+{
+    while (len > 0) {
+        const int ct = get_byte(d);
+        const int cls = ct >> 4, id = ct & 15;
+        ESP_RETURN_ON_FALSE(ct >= 0 && cls <= 1 && id <= 1, ESP_ERR_INVALID_RESPONSE, TAG, "DHT class/id");
+        uint8_t counts[16], vals[256];
+        int total = 0;
+        for (int i = 0; i < 16; ++i) {
+            const int c = get_byte(d);
+            ESP_RETURN_ON_FALSE(c >= 0, ESP_ERR_INVALID_SIZE, TAG, "DHT truncated");
+            counts[i] = (uint8_t)c;
+            total += c;
+        }
+        ESP_RETURN_ON_FALSE(total <= 256, ESP_ERR_INVALID_RESPONSE, TAG, "DHT %d symbols", total);
+        for (int i = 0; i < total; ++i) {
+            const int v = get_byte(d);
+            ESP_RETURN_ON_FALSE(v >= 0, ESP_ERR_INVALID_SIZE, TAG, "DHT truncated");
+            vals[i] = (uint8_t)v;
+        }
+        ESP_RETURN_ON_ERROR(huff_build(cls ? &d->ac[id] : &d->dc[id], counts, vals, total), TAG, "DHT");
+        len -= 17 + total;
+    }
+    ESP_RETURN_ON_FALSE(len == 0, ESP_ERR_INVALID_RESPONSE, TAG, "DHT length");
+    return ESP_OK;
+}
+
+static esp_err_t read_sof(jpeg_dec_t_ *d, int len)
+{
+    const int prec = get_byte(d), hgt = get_u16(d), wid = get_u16(d), n = get_byte(d);
+    ESP_RETURN_ON_FALSE(prec == 8, ESP_ERR_NOT_SUPPORTED, TAG, "%d-bit samples", prec);
+    ESP_RETURN_ON_FALSE(hgt > 0 && wid > 0, ESP_ERR_NOT_SUPPORTED, TAG, "size %dx%d", wid, hgt);
+    ESP_RETURN_ON_FALSE(n == 1 || n == 3, ESP_ERR_NOT_SUPPORTED, TAG, "%d components", n);
+    ESP_RETURN_ON_FALSE(len == 6 + 3 * n, ESP_ERR_INVALID_RESPONSE, TAG, "SOF length");
+
+    for (int i = 0; i < n; ++i) {
+        comp_t *c = &d->comp[i];
+        c->id = get_byte(d);
+        const int hv = get_byte(d);
+        c->tq = get_byte(d);
+        ESP_RETURN_ON_FALSE(c->id >= 0 && hv >= 0 && c->tq >= 0 && c->tq < 4, ESP_ERR_INVALID_RESPONSE,
+                            TAG, "SOF component %d", i);
+        c->h = hv >> 4;
+        c->v = hv & 15;
+    }
+    d->ncomp = n;
+    if (n == 1) {
+        d->comp[0].h = d->comp[0].v = 1;   // single component: one block per MCU whatever it says
+    } else {
+        /* Luma carries the max factors; chroma one block each (4:4:4, 4:2:2, 4:4:0, 4:2:0). */
+        const comp_t *c = d->comp;
+        ESP_RETURN_ON_FALSE(c[0].h >= 1 && c[0].h <= 2 && c[0].v >= 1 && c[0].v <= 2 &&
+                            c[1].h == 1 && c[1].v == 1 && c[2].h == 1 && c[2].v == 1,
+                            ESP_ERR_NOT_SUPPORTED, TAG, "sampling %dx%d,%dx%d,%dx%d",
+                            c[0].h, c[0].v, c[1].h, c[1].v, c[2].h, c[2].v);
+    }
+    d->hmax = d->comp[0].h;
+    d->vmax = d->comp[0].v;
+    d->info = (jpeg_info_t){
+        .width = wid, .height = hgt, .components = n,
+        .mcu_w = 8 * d->hmax, .mcu_h = 8 * d->vmax,
+        .restart_interval = d->info.restart_interval,
+    };
+    return ESP_OK;
+}
+
+static esp_err_t read_sos(jpeg_dec_t_ *d, int len)
+{
+    const int n = get_byte(d);
+    ESP_RETURN_ON_FALSE(n == d->ncomp, ESP_ERR_NOT_SUPPORTED, TAG, "non-interleaved scan");
+    ESP_RETURN_ON_FALSE(len == 4 + 2 * n, ESP_ERR_INVALID_RESPONSE, TAG, "SOS length");
+    for (int i = 0; i < n; ++i) {
+        const int id = get_byte(d), t = get_byte(d);
+        comp_t *c = NULL;
+        for (int j = 0; j < d->ncomp; ++j) {
+            if (d->comp[j].id == id) c = &d->comp[j];
+        }
+        ESP_RETURN_ON_FALSE(c && t >= 0, ESP_ERR_INVALID_RESPONSE, TAG, "SOS component %d", id);
+        c->td = t >> 4;
+        c->ta = t & 15;
+        ESP_RETURN_ON_FALSE(c->td <= 1 && c->ta <= 1 && d->dc[c->td].present && d->ac[c->ta].present,
+                            ESP_ERR_INVALID_RESPONSE, TAG, "missing Huffman table");
+        ESP_RETURN_ON_FALSE(d->qt_present[c->tq], ESP_ERR_INVALID_RESPONSE, TAG, "missing quant table");
+    }
+    const int ss = get_byte(d), se = get_byte(d), a = get_byte(d);
+    ESP_RETURN_ON_FALSE(ss == 0 && se == 63 && a == 0, ESP_ERR_NOT_SUPPORTED, TAG, "not a sequential scan");
+    return ESP_OK;
+}
+
+/* Walk markers up to the first scan; tables and frame header must come before it. */
+static esp_err_t parse_headers(jpeg_dec_t_ *d)
+{
+    ESP_RETURN_ON_FALSE(get_byte(d) == 0xFF && get_byte(d) == 0xD8, ESP_ERR_INVALID_RESPONSE,
+                        TAG, "not a JPEG");
+    bool sof = false;
+    for (;;) {
+        const int m = next_marker(d);
+        ESP_RETURN_ON_FALSE(m >= 0, ESP_ERR_INVALID_SIZE, TAG, "truncated before scan");
+        if (m == 0x01 || m == 0xD8 || (m >= 0xD0 && m <= 0xD7)) continue;   // no payload
+        ESP_RETURN_ON_FALSE(m != 0xD9, ESP_ERR_INVALID_RESPONSE, TAG, "no image data");
+
+        int len = get_u16(d);
+        ESP_RETURN_ON_FALSE(len >= 2, ESP_ERR_INVALID_SIZE, TAG, "marker %02X length", m);
+        len -= 2;
+        switch (m) {
+        case 0xDB: ESP_RETURN_ON_ERROR(read_dqt(d, len), TAG, "DQT"); break;
+        case 0xC4: ESP_RETURN_ON_ERROR(read_dht(d, len), TAG, "DHT"); break;
+        case 0xC0:
+        case 0xC1:
+            ESP_RETURN_ON_ERROR(read_sof(d, len), TAG, "SOF");
+            sof = true;
+            break;
+        case 0xDD:
+            ESP_RETURN_ON_FALSE(len == 2, ESP_ERR_INVALID_RESPONSE, TAG, "DRI length");
+            d->info.restart_interval = get_u16(d);
+            break;
+        case 0xDA:
+            ESP_RETURN_ON_FALSE(sof, ESP_ERR_INVALID_RESPONSE, TAG, "scan before frame header");
+            return read_sos(d, len);
+        default:
+            /* SOF2..SOF15 other than DHT/JPG/DAC: progressive, lossless, arithmetic. */
+            ESP_RETURN_ON_FALSE(!(m >= 0xC2 && m <= 0xCF && m != 0xC4 && m != 0xC8 && m != 0xCC),
+                                ESP_ERR_NOT_SUPPORTED, TAG, "SOF%d", m - 0xC0);
+            ESP_RETURN_ON_FALSE(skip(d, len), ESP_ERR_INVALID_SIZE, TAG, "truncated marker %02X", m);
+            break;
+        }
+    }
+}
+
+/* ---- blocks ---- */
+
+/* Huffman-decode and dequantize one block into d->coef (natural order). */
+static bool decode_block(jpeg_dec_t_ *d, comp_t *c, bool dc_only)
+{
+    int32_t *coef = d->coef;
+    const uint16_t *q = d->qt[c->tq];
+    memset(coef, 0, sizeof(d->coef));
+
+    const int t = huff_decode(d, &d->dc[c->td]);
+    if (t < 0 || t > 11) return false;
+    if (t) c->dc_pred += extend(get_bits(d, t), t);
+    coef[0] = c->dc_pred * q[0];
+
+    const huff_t *ac = &d->ac[c->ta];
+    for (int k = 1; k < 64;) {
+        const int rs = huff_decode(d, ac);
+        if (rs < 0) return false;
+        const int r = rs >> 4, s = rs & 15;
+        if (!s) {
+            if (r != 15) break;   // EOB
+            k += 16;              // ZRL
+            continue;
+        }
+        k += r;
+        if (k > 63) return false;
+        const int v = extend(get_bits(d, s), s);
+        if (!dc_only) coef[kZigzag[k]] = v * q[k];
+        ++k;
+    }
+    return true;
+}
+
+/*
+ * Integer 8×8 IDCT (the Loeffler–Ligtenberg–Moschytz factorisation used by
+ * the libjpeg "islow" path), constants scaled by 2^12.
+ */
+#define FIX(x) ((int32_t)((x) * 4096 + 0.5))
+
+#define IDCT_1D(s0, s1, s2, s3, s4, s5, s6, s7)                                   \
+    int32_t t0, t1, t2, t3, p1, p2, p3, p4, p5, x0, x1, x2, x3;                     \
+    p2 = (s2); p3 = (s6);                                                           \
+    p1 = (p2 + p3) * FIX(0.5411961);                                                \
+    t2 = p1 + p3 * FIX(-1.847759065);                                               \
+    t3 = p1 + p2 * FIX(0.765366865);                                                \
+    p2 = (s0); p3 = (s4);                                                           \
+    t0 = (p2 + p3) * 4096;                                                          \
+    t1 = (p2 - p3) * 4096;                                                          \
+    x0 = t0 + t3; x3 = t0 - t3;                                                     \
+    x1 = t1 + t2; x2 = t1 - t2;                                                     \
+    t0 = (s7); t1 = (s5); t2 = (s3); t3 = (s1);                                     \
+    p3 = t0 + t2; p4 = t1 + t3; p1 = t0 + t3; p2 = t1 + t2;                         \
+    p5 = (p3 + p4) * FIX(1.175875602);                                              \
+    t0 *= FIX(0.298631336); t1 *= FIX(2.053119869);                                 \
+    t2 *= FIX(3.072711026); t3 *= FIX(1.501321110);                                 \
+    p1 = p5 + p1 * FIX(-0.899976223);                                               \
+    p2 = p5 + p2 * FIX(-2.562915447);                                               \
+    p3 *= FIX(-1.961570560);                                                        \
+    p4 *= FIX(-0.390180644);                                                        \
+    t3 += p1 + p4; t2 += p2 + p3; t1 += p2 + p4; t0 += p1 + p3;
+
+static void idct8x8(const int32_t *in, uint8_t *out)
+{
+    int32_t tmp[64];
+
+    /* Columns; keep 2 extra bits. Columns with only a DC term are a fill. */
+    for (int i = 0; i < 8; ++i) {
+        const int32_t *s = in + i;
+        int32_t *v = tmp + i;
+        if (!(s[8] | s[16] | s[24] | s[32] | s[40] | s[48] | s[56])) {
+            const int32_t dc = s[0] * 4;
+            for (int k = 0; k < 64; k += 8) v[k] = dc;
+            continue;
+        }
+        IDCT_1D(s[0], s[8], s[16], s[24], s[32], s[40], s[48], s[56])
+        x0 += 512; x1 += 512; x2 += 512; x3 += 512;
+        v[0]  = (x0 + t3) >> 10;  v[56] = (x0 - t3) >> 10;
+        v[8]  = (x1 + t2) >> 10;  v[48] = (x1 - t2) >> 10;
+        v[16] = (x2 + t1) >> 10;  v[40] = (x2 - t1) >> 10;
+        v[24] = (x3 + t0) >> 10;  v[32] = (x3 - t0) >> 10;
+    }
+
+    /* Rows; remove 2^12 · 2^2 · 8 with rounding and the +128 level shift. */
+    for (int i = 0; i < 8; ++i) {
+        const int32_t *v = tmp + i * 8;
+        uint8_t *o = out + i * 8;
+        IDCT_1D(v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7])
+        const int32_t bias = 65536 + (128 << 17);
+        x0 += bias; x1 += bias; x2 += bias; x3 += bias;
+        o[0] = clamp8((x0 + t3) >> 17);  o[7] = clamp8((x0 - t3) >> 17);
+        o[1] = clamp8((x1 + t2) >> 17);  o[6] = clamp8((x1 - t2) >> 17);
+        o[2] = clamp8((x2 + t1) >> 17);  o[5] = clamp8((x2 - t1) >> 17);
+        o[3] = clamp8((x3 + t0) >> 17);  o[4] = clamp8((x3 - t0) >> 17);
+    }
+}
+
+/* Store an 8×8 block at 1/2^shift scale (box average) into dst. */
+static void put_block(const uint8_t *blk, uint8_t *dst, int stride, int shift)
+{
+    if (!shift) {
+        for (int y = 0; y < 8; ++y) memcpy(dst + y * stride, blk + y * 8, 8);
+        return;
+    }
+    const int n = 8 >> shift, f = 1 << shift, round = 1 << (2 * shift - 1);
+    for (int y = 0; y < n; ++y) {
+        for (int x = 0; x < n; ++x) {
+            int sum = 0;
+            for (int j = 0; j < f; ++j) {
+                const uint8_t *s = blk + (y * f + j) * 8 + x * f;
+                for (int i = 0; i < f; ++i) sum += s[i];
+            }
+            dst[y * stride + x] = (uint8_t)((sum + round) >> (2 * shift));
+        }
+    }
+}
+
+/* Decode one MCU into d->smp (per component, at output scale). */
+static bool decode_mcu(jpeg_dec_t_ *d, int shift)
+{
+    const int bs = 8 >> shift;
+    for (int ci = 0; ci < d->ncomp; ++ci) {
+        comp_t *c = &d->comp[ci];
+        const int stride = c->h * bs;
+        for (int by = 0; by < c->v; ++by) {
+            for (int bx = 0; bx < c->h; ++bx) {
+                if (!decode_block(d, c, shift == 3)) return false;
+                uint8_t *dst = d->smp[ci] + by * bs * stride + bx * bs;
+                if (shift == 3) {
+                    *dst = clamp8(128 + ((d->coef[0] + 4) >> 3));   // 1/8 scale: the DC term is the block mean
+                } else {
+                    idct8x8(d->coef, d->blk);
+                    put_block(d->blk, dst, stride, shift);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/*
+ * Color-convert the top-left n_w × n_h of the current MCU into the band at
+ * (bx, by); (ax, ay) is its absolute output position for the dither phase.
+ * Chroma is upsampled by replication.
+ */
+static void mcu_to_band(jpeg_dec_t_ *d, uint16_t *band, int band_w, int bx, int by,
+                        int n_w, int n_h, int ax, int ay, int shift, ui_dither_t dither)
+{
+    const int ys = (8 * d->hmax) >> shift, cs = 8 >> shift;
+    const int hs = d->hmax - 1, vs = d->vmax - 1;
+    for (int y = 0; y < n_h; ++y) {
+        const uint8_t *Y = d->smp[0] + y * ys;
+        uint8_t *o = d->rgb;
+        if (d->ncomp == 1) {
+            for (int x = 0; x < n_w; ++x, o += 3) o[0] = o[1] = o[2] = Y[x];
+        } else {
+            const uint8_t *cb = d->smp[1] + (y >> vs) * cs, *cr = d->smp[2] + (y >> vs) * cs;
+            for (int x = 0; x < n_w; ++x, o += 3) {
+                /* BT.601 full range, 16.16 fixed point. */
+                const int l = (Y[x] << 16) + 32768, u = cb[x >> hs] - 128, v = cr[x >> hs] - 128;
+                o[0] = clamp8((l + 91881 * v) >> 16);
+                o[1] = clamp8((l - 22554 * u - 46802 * v) >> 16);
+                o[2] = clamp8((l + 116130 * u) >> 16);
+            }
+        }
+        ui_rgb888_row_to_565(band + (size_t)(by + y) * band_w + bx, d->rgb, n_w, ax, ay + y, dither);
+    }
+}
+
+/* Resync on the RSTn marker due after every restart_interval MCUs. */
+static esp_err_t restart(jpeg_dec_t_ *d)
+{
+    d->acc   = 0;
+    d->nbits = 0;
+    while (!d->marker) d->marker = next_marker(d);   // 0: a stuffed 0xFF00, keep looking
+    ESP_RETURN_ON_FALSE(d->marker >= 0xD0 && d->marker <= 0xD7, ESP_ERR_INVALID_RESPONSE, TAG,
+                        "expected RST, got %02X", d->marker);
+    d->marker = 0;
+    for (int i = 0; i < d->ncomp; ++i) d->comp[i].dc_pred = 0;
+    return ESP_OK;
+}
+
+/* ---- public ---- */
+
+static esp_err_t open_common(jpeg_dec_t_ *d, jpeg_dec_handle_t *out)
+{
+    const esp_err_t err = parse_headers(d);
+    if (err != ESP_OK) {
+        jpeg_dec_close(d);
+        return err;
+    }
+    *out = d;
+    return ESP_OK;
+}
+
+esp_err_t jpeg_dec_open(jpeg_read_fn_t read, void *ctx, jpeg_dec_handle_t *out)
+{
+    ESP_RETURN_ON_FALSE(read && out, ESP_ERR_INVALID_ARG, TAG, "bad args");
+    jpeg_dec_t_ *d = mem_calloc(MEM_TAG_IMAGE, 1, sizeof(*d), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ESP_RETURN_ON_FALSE(d, ESP_ERR_NO_MEM, TAG, "no mem");
+    d->in_buf = mem_malloc(MEM_TAG_IMAGE, JPEG_DEC_IN_BUF, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!d->in_buf) {
+        mem_free(MEM_TAG_IMAGE, d);
+        return ESP_ERR_NO_MEM;
+    }
+    d->read = read;
+    d->rctx = ctx;
+    d->p = d->end = d->in_buf;
+    return open_common(d, out);
+}
+
+esp_err_t jpeg_dec_open_mem(const void *data, size_t len, jpeg_dec_handle_t *out)
+{
+    ESP_RETURN_ON_FALSE(data && out, ESP_ERR_INVALID_ARG, TAG, "bad args");
+    jpeg_dec_t_ *d = mem_calloc(MEM_TAG_IMAGE, 1, sizeof(*d), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ESP_RETURN_ON_FALSE(d, ESP_ERR_NO_MEM, TAG, "no mem");
+    d->p   = data;
+    d->end = d->p + len;
+    return open_common(d, out);
+}
+
+void jpeg_dec_close(jpeg_dec_handle_t h)
+{
+    if (!h) return;
+    mem_free(MEM_TAG_IMAGE, h->in_buf);
+    mem_free(MEM_TAG_IMAGE, h);
+}
+
+void jpeg_dec_get_info(jpeg_dec_handle_t h, jpeg_info_t *out)
+{
+    if (h && out) *out = h->info;
+}
+
+int jpeg_dec_fit_shift(const jpeg_info_t *info, int max_w, int max_h)
+{
+    if (!info) return 0;
+    int s = 0;
+    while (s < 3 && (((info->width + (1 << s) - 1) >> s) > max_w || ((info->height + (1 << s) - 1) >> s) > max_h)) {
+        ++s;
+    }
+    return s;
+}
+
+esp_err_t jpeg_dec_run(jpeg_dec_handle_t h, const jpeg_out_t *out, jpeg_dec_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(h && out && out->on_band && out->scale_shift >= 0 && out->scale_shift <= 3,
+                        ESP_ERR_INVALID_ARG, TAG, "bad args");
+    ESP_RETURN_ON_FALSE(!h->decoded, ESP_ERR_INVALID_STATE, TAG, "already decoded");
+    h->decoded = true;
+
+    const uint64_t t_start = timing_now_us();
+    const int s = out->scale_shift;
+    const jpeg_info_t *in = &h->info;
+    const int ow = (in->width + (1 << s) - 1) >> s, oh = (in->height + (1 << s) - 1) >> s;
+    const int mw = in->mcu_w >> s, mh = in->mcu_h >> s;
+    const int mcus_x = (in->width + in->mcu_w - 1) / in->mcu_w;
+    const int mcus_y = (in->height + in->mcu_h - 1) / in->mcu_h;
+    const int rows_per_band = out->band_mcu_rows > 0 ? out->band_mcu_rows : 1;
+    const size_t band_bytes = (size_t)ow * mh * rows_per_band * sizeof(uint16_t);
+
+    /* An asynchronous sink may still be reading the last band: decode into the other half. */
+    const int nbands = out->on_idle ? 2 : 1;
+    const size_t band_px = band_bytes / sizeof(uint16_t);
+    static const uint32_t kCaps[] = { MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA, MALLOC_CAP_DEFAULT };
+    uint16_t *bands = mem_alloc_prefer(MEM_TAG_IMAGE, 4, band_bytes * nbands, kCaps, 2);
+    ESP_RETURN_ON_FALSE(bands, ESP_ERR_NO_MEM, TAG, "band %u bytes", (unsigned)(band_bytes * nbands));
+    uint16_t *band = bands;
+
+    jpeg_dec_stats_t st = { .out_w = ow, .out_h = oh, .peak_bytes = sizeof(*h) + band_bytes * nbands };
+    if (h->in_buf) st.peak_bytes += JPEG_DEC_IN_BUF;
+
+    esp_err_t err = ESP_OK;
+    uint64_t sink_us = 0;
+    int band_y = 0;
+    uint32_t mcu = 0;
+    for (int my = 0; my < mcus_y && err == ESP_OK; ++my) {
+        const int oy = my * mh, by = oy - band_y;
+        const int n_h = (oh - oy) < mh ? (oh - oy) : mh;
+        for (int mx = 0; mx < mcus_x; ++mx, ++mcu) {
+            if (in->restart_interval && mcu && mcu % (uint32_t)in->restart_interval == 0) {
+                err = restart(h);
+                if (err != ESP_OK) break;
+            }
+            if (!decode_mcu(h, s)) {
+                ESP_LOGE(TAG, "bad entropy data at MCU %d,%d", mx, my);
+                err = ESP_ERR_INVALID_RESPONSE;
+                break;
+            }
+            const int ox = mx * mw;
+            const int n_w = (ow - ox) < mw ? (ow - ox) : mw;
+            mcu_to_band(h, band, ow, ox, by, n_w, n_h, out->x + ox, out->y + oy, s, out->dither);
+        }
+        if (err != ESP_OK) break;
+
+        const int rows = by + n_h;
+        if (my == mcus_y - 1 || rows == mh * rows_per_band) {
+            const uint64_t t0 = timing_now_us();
+            err = out->on_band(out->ctx, out->x, out->y + band_y, ow, rows, band);
+            sink_us += timing_now_us() - t0;
+            st.bands++;
+            band_y += rows;
+            band = bands + (st.bands % nbands) * band_px;
+        }
+    }
+    if (out->on_idle) {
+        const uint64_t t0 = timing_now_us();
+        const esp_err_t e = out->on_idle(out->ctx);
+        sink_us += timing_now_us() - t0;
+        if (err == ESP_OK) err = e;
+    }
+    mem_free(MEM_TAG_IMAGE, bands);
+
+    const uint64_t total = timing_now_us() - t_start;
+    st.sink_us    = (uint32_t)sink_us;
+    st.decode_us  = (uint32_t)(total - sink_us);
+    st.us_per_mpx = (uint32_t)((uint64_t)st.decode_us * 1000000u / ((uint64_t)in->width * in->height));
+    if (err == ESP_OK) {
+        ESP_LOGI(TAG, "%dx%d -> %dx%d: %u us decode (%u us/MPx), %u us sink, %d bands, peak %u B",
+                 in->width, in->height, ow, oh, (unsigned)st.decode_us, (unsigned)st.us_per_mpx,
+                 (unsigned)st.sink_us, st.bands, (unsigned)st.peak_bytes);
+    }
+    if (stats) *stats = st;
+    return err;
+}
+
+/* ---- sinks ---- */
+
+esp_err_t jpeg_sink_fb(void *ctx, int x, int y, int w, int h, uint16_t *px)
+{
+    const jpeg_fb_sink_t *s = (const jpeg_fb_sink_t *)ctx;
+    ESP_RETURN_ON_FALSE(s && s->fb && px, ESP_ERR_INVALID_ARG, TAG, "bad args");
+    const int x0 = x < 0 ? 0 : x, x1 = (x + w) > s->w ? s->w : x + w;
+    const int y0 = y < 0 ? 0 : y, y1 = (y + h) > s->h ? s->h : y + h;
+    for (int yy = y0; yy < y1 && x0 < x1; ++yy) {
+        memcpy(s->fb + (size_t)yy * s->w + x0, px + (size_t)(yy - y) * w + (x0 - x),
+               (size_t)(x1 - x0) * sizeof(uint16_t));
+    }
+    return ESP_OK;
+}
+
+esp_err_t jpeg_sink_display(void *ctx, int x, int y, int w, int h, uint16_t *px)
+{
+    display_handle_t d = (display_handle_t)ctx;
+    ESP_RETURN_ON_FALSE(d && px, ESP_ERR_INVALID_ARG, TAG, "bad args");
+    const int W = display_width(d), H = display_height(d);
+    const int x0 = x < 0 ? 0 : x, x1 = (x + w) > W ? W : x + w;
+    const int y0 = y < 0 ? 0 : y, y1 = (y + h) > H ? H : y + h;
+    // Nothing to draw still has to release the previous band before it is decoded into again.
+    if (x0 >= x1 || y0 >= y1) return jpeg_sink_display_idle(ctx);
+
+    uint16_t *src = px + (size_t)(y0 - y) * w + (x0 - x);
+    const int cw = x1 - x0;
+    if (cw != w) {
+        /* Clipped sideways: pack the visible columns to stride cw so the band goes in one transfer. */
+        for (int r = 0; r < y1 - y0; ++r) {
+            memmove(px + (size_t)r * cw, src + (size_t)r * w, (size_t)cw * sizeof(uint16_t));
+        }
+        src = px;
+    }
+    return display_draw_bitmap(d, x0, y0, x1, y1, src);   // waits for the previous band first
+}
+
+esp_err_t jpeg_sink_display_idle(void *ctx)
+{
+    return display_wait_idle((display_handle_t)ctx, JPEG_DEC_IDLE_TIMEOUT_MS);
+}
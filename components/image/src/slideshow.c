@@ -0,0 +1,436 @@
+#include "image/slideshow.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "image/jpeg_dec.h"
+#include "ui_gfx/ui_kernels.h"
+#include "util/mem.h"
+#include "util/timing.h"
+
+static const char *TAG = "slideshow";
+
+#ifndef SLIDESHOW_READER_STACK
+#define SLIDESHOW_READER_STACK  3072
+#endif
+
+#ifndef SLIDESHOW_DECODER_STACK
+#define SLIDESHOW_DECODER_STACK 6144
+#endif
+
+/* Longest "<dir>/<file>" path for a directory source. */
+#ifndef SLIDESHOW_PATH_MAX
+#define SLIDESHOW_PATH_MAX      256
+#endif
+
+/* Blocking waits wake this often to notice slideshow_close(). */
+#define SLIDESHOW_WAIT_TICKS    pdMS_TO_TICKS(50)
+
+typedef struct {
+    uint32_t off, size;  // off: into the partition, or (directory) into names
+} entry_t;
+
+/* Passed through the ready queues; free queues carry bare slot indices. */
+typedef struct {
+    int      slot;
+    int      index;      // photo
+    uint32_t len;        // file bytes (file queue only)
+} msg_t;
+
+typedef struct slideshow_t_ {
+    slideshow_cfg_t        cfg;
+    display_handle_t       d;
+    int                    W, H;
+    const esp_partition_t *part;                      // NULL for a directory source
+    char                  *names;                     // directory: NUL-separated file names
+    entry_t               *entries;
+    int                    photos;
+    uint32_t               max_file;
+
+    uint8_t               *file[SLIDESHOW_MAX_SLOTS];
+    uint16_t              *frame[SLIDESHOW_MAX_SLOTS];
+
+    QueueHandle_t          file_free, file_ready;     // reader → decoder
+    QueueHandle_t          frame_free, frame_ready;   // decoder → presenter
+    SemaphoreHandle_t      done;                      // given by each task as it exits
+    int                    tasks;
+    volatile bool          stop;
+
+    /* presenter (caller's task) */
+    int                    shown_slot;                // -1 before the first present
+    bool                   started;
+    bool                   late_now;                  // current due time already counted late
+    uint64_t               due_us;
+
+    /* Each field is written by one stage only; readers may see a torn snapshot. */
+    slideshow_stats_t      st;
+} slideshow_t_;
+
+/* ---- decode one file into a frame slot ---- */
+
+static esp_err_t decode_into(slideshow_t_ *h, const uint8_t *jpg, uint32_t len, uint16_t *frame,
+                             uint32_t *us_per_mpx)
+{
+    jpeg_dec_handle_t j;
+    ESP_RETURN_ON_ERROR(jpeg_dec_open_mem(jpg, len, &j), TAG, "open");
+    jpeg_info_t in;
+    jpeg_dec_get_info(j, &in);
+
+    /* Largest power-of-two reduction that fits, centred; the rest is letterbox. */
+    const int s  = jpeg_dec_fit_shift(&in, h->W, h->H);
+    const int ow = (in.width + (1 << s) - 1) >> s, oh = (in.height + (1 << s) - 1) >> s;
+    if (ow < h->W || oh < h->H) ui_clear565(frame, h->W, h->H, h->cfg.background);
+
+    jpeg_fb_sink_t sink = { .fb = frame, .w = h->W, .h = h->H };
+    const jpeg_out_t out = {
+        .scale_shift = s,
+        .dither      = h->cfg.dither,
+        .x           = (h->W - ow) / 2,
+        .y           = (h->H - oh) / 2,
+        .on_band     = jpeg_sink_fb,
+        .ctx         = &sink,
+    };
+    jpeg_dec_stats_t st;
+    const esp_err_t err = jpeg_dec_run(j, &out, &st);
+    jpeg_dec_close(j);
+    *us_per_mpx = st.us_per_mpx;
+    return err;
+}
+
+/* ---- stages ---- */
+
+static inline void note_max(uint32_t *last, uint32_t *max, uint64_t us)
+{
+    *last = (uint32_t)us;
+    if (*last > *max) *max = *last;
+}
+
+static esp_err_t read_photo(const slideshow_t_ *h, const entry_t *e, uint8_t *dst)
+{
+    if (h->part) return esp_partition_read(h->part, e->off, dst, e->size);
+
+    char path[SLIDESHOW_PATH_MAX];
+    snprintf(path, sizeof(path), "%s/%s", h->cfg.dir, h->names + e->off);
+    FILE *f = fopen(path, "rb");
+    if (!f) return ESP_ERR_NOT_FOUND;
+    const size_t got = fread(dst, 1, e->size, f);
+    fclose(f);
+    return got == e->size ? ESP_OK : ESP_ERR_INVALID_SIZE;   // shrank since open
+}
+
+/* Copy photos in order (wrapping) into free file slots. */
+static void reader_task(void *arg)
+{
+    slideshow_t_ *h = (slideshow_t_ *)arg;
+    int next = 0;
+    while (!h->stop) {
+        int slot;
+        if (xQueueReceive(h->file_free, &slot, SLIDESHOW_WAIT_TICKS) != pdTRUE) continue;
+
+        const entry_t *e = &h->entries[next];
+        const uint64_t t0 = timing_now_us();
+        const esp_err_t err = read_photo(h, e, h->file[slot]);
+        note_max(&h->st.read_us, &h->st.read_max_us, timing_now_us() - t0);
+
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "read photo %d: %s", next, esp_err_to_name(err));
+            h->st.errors++;
+            xQueueSend(h->file_free, &slot, 0);
+            vTaskDelay(SLIDESHOW_WAIT_TICKS);   // don't spin on a failing flash read
+        } else {
+            const msg_t m = { .slot = slot, .index = next, .len = e->size };
+            xQueueSend(h->file_ready, &m, portMAX_DELAY);   // holds every slot: never blocks
+        }
+        next = (next + 1) % h->photos;
+    }
+    xSemaphoreGive(h->done);
+    vTaskDelete(NULL);
+}
+
+/* Decode each read file into a free frame slot; bad files are skipped. */
+static void decoder_task(void *arg)
+{
+    slideshow_t_ *h = (slideshow_t_ *)arg;
+    while (!h->stop) {
+        msg_t f;
+        if (xQueueReceive(h->file_ready, &f, SLIDESHOW_WAIT_TICKS) != pdTRUE) continue;
+        int slot = -1;
+        while (!h->stop && xQueueReceive(h->frame_free, &slot, SLIDESHOW_WAIT_TICKS) != pdTRUE) {}
+        if (h->stop) break;
+
+        uint32_t us_per_mpx = 0;
+        const uint64_t t0 = timing_now_us();
+        const esp_err_t err = decode_into(h, h->file[f.slot], f.len, h->frame[slot], &us_per_mpx);
+        note_max(&h->st.decode_us, &h->st.decode_max_us, timing_now_us() - t0);
+        xQueueSend(h->file_free, &f.slot, 0);
+
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "decode photo %d: %s", f.index, esp_err_to_name(err));
+            h->st.errors++;
+            xQueueSend(h->frame_free, &slot, 0);
+            continue;
+        }
+        h->st.decode_us_per_mpx = us_per_mpx;
+        const msg_t m = { .slot = slot, .index = f.index };
+        xQueueSend(h->frame_ready, &m, portMAX_DELAY);
+    }
+    xSemaphoreGive(h->done);
+    vTaskDelete(NULL);
+}
+
+/* ---- presenter ---- */
+
+bool slideshow_poll(slideshow_handle_t h, uint64_t now_us)
+{
+    if (!h || (h->started && now_us < h->due_us)) return false;
+
+    const int ready = (int)uxQueueMessagesWaiting(h->frame_ready);
+    if (h->started && !h->late_now && ready < h->st.frames_ready_min) h->st.frames_ready_min = ready;
+
+    msg_t m;
+    if (xQueueReceive(h->frame_ready, &m, 0) != pdTRUE) {
+        if (h->started && !h->late_now) {
+            h->st.late++;
+            h->late_now = true;
+        }
+        return false;
+    }
+
+    const uint64_t t0 = timing_now_us();
+    const esp_err_t err = display_draw_bitmap(h->d, 0, 0, h->W, h->H, h->frame[m.slot]);
+    note_max(&h->st.present_us, &h->st.present_max_us, timing_now_us() - t0);
+    if (err != ESP_OK) ESP_LOGW(TAG, "present photo %d: %s", m.index, esp_err_to_name(err));
+
+    /* The previous frame's present was issued before this one, so its slot is free now. */
+    if (h->shown_slot >= 0) xQueueSend(h->frame_free, &h->shown_slot, 0);
+    h->shown_slot = m.slot;
+    h->st.shown++;
+
+    /* On time: keep the cadence. Late: give this photo its full dwell. */
+    const uint64_t dwell = (uint64_t)h->cfg.dwell_ms * 1000;
+    h->due_us   = (h->started && !h->late_now) ? h->due_us + dwell : now_us + dwell;
+    h->started  = true;
+    h->late_now = false;
+    return true;
+}
+
+void slideshow_set_dwell(slideshow_handle_t h, uint32_t dwell_ms)
+{
+    if (!h) return;
+    if (h->started) h->due_us = h->due_us - (uint64_t)h->cfg.dwell_ms * 1000 + (uint64_t)dwell_ms * 1000;
+    h->cfg.dwell_ms = dwell_ms;
+}
+
+void slideshow_get_stats(slideshow_handle_t h, slideshow_stats_t *out)
+{
+    if (!h || !out) return;
+    *out = h->st;
+    out->files_ready  = (int)uxQueueMessagesWaiting(h->file_ready);
+    out->frames_ready = (int)uxQueueMessagesWaiting(h->frame_ready);
+}
+
+/* ---- open / close ---- */
+
+static void free_all(slideshow_t_ *h)
+{
+    for (int i = 0; i < SLIDESHOW_MAX_SLOTS; ++i) {
+        mem_free(MEM_TAG_IMAGE, h->file[i]);
+        mem_free(MEM_TAG_IMAGE, h->frame[i]);
+    }
+    if (h->file_free)   vQueueDelete(h->file_free);
+    if (h->file_ready)  vQueueDelete(h->file_ready);
+    if (h->frame_free)  vQueueDelete(h->frame_free);
+    if (h->frame_ready) vQueueDelete(h->frame_ready);
+    if (h->done)        vSemaphoreDelete(h->done);
+    mem_free(MEM_TAG_IMAGE, h->entries);
+    mem_free(MEM_TAG_IMAGE, h->names);
+    mem_free(MEM_TAG_IMAGE, h);
+}
+
+static esp_err_t read_table(slideshow_t_ *h)
+{
+    uint8_t hdr[SLIDESHOW_HEADER_LEN];
+    ESP_RETURN_ON_ERROR(esp_partition_read(h->part, 0, hdr, sizeof(hdr)), TAG, "read header");
+    ESP_RETURN_ON_FALSE(memcmp(hdr, SLIDESHOW_MAGIC, 4) == 0, ESP_ERR_INVALID_RESPONSE, TAG, "bad magic");
+    const int version = hdr[4] | (hdr[5] << 8);
+    ESP_RETURN_ON_FALSE(version == SLIDESHOW_VERSION, ESP_ERR_INVALID_VERSION, TAG, "version %d", version);
+    h->photos = hdr[6] | (hdr[7] << 8);
+    ESP_RETURN_ON_FALSE(h->photos > 0, ESP_ERR_INVALID_SIZE, TAG, "no photos");
+
+    const size_t bytes = (size_t)h->photos * SLIDESHOW_ENTRY_LEN;
+    ESP_RETURN_ON_FALSE(SLIDESHOW_HEADER_LEN + bytes <= h->part->size, ESP_ERR_INVALID_SIZE, TAG, "truncated table");
+    h->entries = mem_malloc(MEM_TAG_IMAGE, bytes, MALLOC_CAP_DEFAULT);
+    ESP_RETURN_ON_FALSE(h->entries, ESP_ERR_NO_MEM, TAG, "table");
+    ESP_RETURN_ON_ERROR(esp_partition_read(h->part, SLIDESHOW_HEADER_LEN, h->entries, bytes), TAG, "read table");
+
+    for (int i = 0; i < h->photos; ++i) {
+        const uint8_t *e = (const uint8_t *)&h->entries[i];
+        const uint32_t off  = e[0] | (e[1] << 8) | (e[2] << 16) | ((uint32_t)e[3] << 24);
+        const uint32_t size = e[4] | (e[5] << 8) | (e[6] << 16) | ((uint32_t)e[7] << 24);
+        ESP_RETURN_ON_FALSE(size > 0 && off <= h->part->size && size <= h->part->size - off,
+                            ESP_ERR_INVALID_SIZE, TAG, "photo %d out of bounds", i);
+        h->entries[i] = (entry_t){ .off = off, .size = size };
+        if (size > h->max_file) h->max_file = size;
+    }
+    return ESP_OK;
+}
+
+static bool is_jpeg_name(const char *name)
+{
+    const char *dot = strrchr(name, '.');
+    return dot && dot != name && (strcasecmp(dot, ".jpg") == 0 || strcasecmp(dot, ".jpeg") == 0);
+}
+
+/* Size of dir/name if it is a non-empty regular file and the path fits, else 0. */
+static uint32_t photo_size(const char *dir, const char *name)
+{
+    char path[SLIDESHOW_PATH_MAX];
+    struct stat sb;
+    if (snprintf(path, sizeof(path), "%s/%s", dir, name) >= (int)sizeof(path)) return 0;
+    if (stat(path, &sb) != 0 || !S_ISREG(sb.st_mode)) return 0;
+    if (sb.st_size <= 0 || (uint64_t)sb.st_size > UINT32_MAX) return 0;
+    return (uint32_t)sb.st_size;
+}
+
+/*
+ * List the directory's JPEGs: one pass to size the tables, one to fill them
+ * (anything that appears in between is ignored), then sort by name.
+ */
+static esp_err_t read_dir(slideshow_t_ *h)
+{
+    const char *dir = h->cfg.dir;
+    DIR *dp = opendir(dir);
+    ESP_RETURN_ON_FALSE(dp, ESP_ERR_NOT_FOUND, TAG, "can't open '%s'", dir);
+
+    int count = 0;
+    size_t name_bytes = 0;
+    for (struct dirent *de; (de = readdir(dp)) != NULL;) {
+        if (!is_jpeg_name(de->d_name) || !photo_size(dir, de->d_name)) continue;
+        count++;
+        name_bytes += strlen(de->d_name) + 1;
+    }
+    esp_err_t ret = ESP_OK;
+    ESP_GOTO_ON_FALSE(count > 0, ESP_ERR_INVALID_SIZE, done, TAG, "no photos");
+    h->entries = mem_malloc(MEM_TAG_IMAGE, (size_t)count * sizeof(entry_t), MALLOC_CAP_DEFAULT);
+    h->names   = mem_malloc(MEM_TAG_IMAGE, name_bytes, MALLOC_CAP_DEFAULT);
+    ESP_GOTO_ON_FALSE(h->entries && h->names, ESP_ERR_NO_MEM, done, TAG, "table");
+
+    rewinddir(dp);
+    size_t used = 0;
+    for (struct dirent *de; h->photos < count && (de = readdir(dp)) != NULL;) {
+        const size_t len = strlen(de->d_name) + 1;
+        const uint32_t size = is_jpeg_name(de->d_name) ? photo_size(dir, de->d_name) : 0;
+        if (!size || used + len > name_bytes) continue;
+        memcpy(h->names + used, de->d_name, len);
+        h->entries[h->photos++] = (entry_t){ .off = (uint32_t)used, .size = size };
+        used += len;
+        if (size > h->max_file) h->max_file = size;
+    }
+    ESP_GOTO_ON_FALSE(h->photos > 0, ESP_ERR_INVALID_SIZE, done, TAG, "no photos");
+
+    for (int i = 1; i < h->photos; ++i) {   // insertion sort: short lists, listed once
+        const entry_t e = h->entries[i];
+        int j = i;
+        for (; j > 0 && strcmp(h->names + h->entries[j - 1].off, h->names + e.off) > 0; --j) {
+            h->entries[j] = h->entries[j - 1];
+        }
+        h->entries[j] = e;
+    }
+done:
+    closedir(dp);
+    return ret;
+}
+
+esp_err_t slideshow_open(const slideshow_cfg_t *cfg, display_handle_t d, slideshow_handle_t *out)
+{
+    ESP_RETURN_ON_FALSE(cfg && d && out && (cfg->partition || cfg->dir), ESP_ERR_INVALID_ARG, TAG, "bad args");
+    ESP_RETURN_ON_FALSE(cfg->frame_slots >= 2 && cfg->frame_slots <= SLIDESHOW_MAX_SLOTS &&
+                        cfg->file_slots >= 1 && cfg->file_slots <= SLIDESHOW_MAX_SLOTS,
+                        ESP_ERR_INVALID_ARG, TAG, "slot counts");
+
+    esp_err_t ret = ESP_OK;  // required for ESP_GOTO_ON_*
+    slideshow_t_ *h = mem_calloc(MEM_TAG_IMAGE, 1, sizeof(*h), MALLOC_CAP_DEFAULT);
+    ESP_RETURN_ON_FALSE(h, ESP_ERR_NO_MEM, TAG, "no mem");
+    h->cfg        = *cfg;
+    h->d          = d;
+    h->W          = display_width(d);
+    h->H          = display_height(d);
+    h->shown_slot = -1;
+    h->st.frames_ready_min = cfg->frame_slots;
+
+    const char *source = cfg->dir ? cfg->dir : cfg->partition;
+    if (cfg->dir) {
+        ESP_GOTO_ON_ERROR(read_dir(h), err, TAG, "'%s'", source);
+    } else {
+        h->part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, cfg->partition);
+        ESP_GOTO_ON_FALSE(h->part, ESP_ERR_NOT_FOUND, err, TAG, "no partition '%s'", cfg->partition);
+        ESP_GOTO_ON_ERROR(read_table(h), err, TAG, "'%s'", source);
+    }
+    h->st.photos = h->photos;
+
+    /* Compressed files and frames live in PSRAM; frames DMA-capable for the panel copy. */
+    static const uint32_t kFileCaps[]  = { MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT };
+    static const uint32_t kFrameCaps[] = { MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA, MALLOC_CAP_SPIRAM };
+    const size_t frame_bytes = (size_t)h->W * h->H * sizeof(uint16_t);
+    for (int i = 0; i < cfg->file_slots; ++i) {
+        h->file[i] = mem_alloc_prefer(MEM_TAG_IMAGE, 0, h->max_file, kFileCaps, 2);
+        ESP_GOTO_ON_FALSE(h->file[i], ESP_ERR_NO_MEM, err, TAG, "file slot (%u B)", (unsigned)h->max_file);
+    }
+    for (int i = 0; i < cfg->frame_slots; ++i) {
+        h->frame[i] = mem_alloc_prefer(MEM_TAG_IMAGE, 0, frame_bytes, kFrameCaps, 2);
+        ESP_GOTO_ON_FALSE(h->frame[i], ESP_ERR_NO_MEM, err, TAG, "frame slot");
+    }
+
+    h->file_free   = xQueueCreate(cfg->file_slots, sizeof(int));
+    h->file_ready  = xQueueCreate(cfg->file_slots, sizeof(msg_t));
+    h->frame_free  = xQueueCreate(cfg->frame_slots, sizeof(int));
+    h->frame_ready = xQueueCreate(cfg->frame_slots, sizeof(msg_t));
+    h->done        = xSemaphoreCreateCounting(2, 0);
+    ESP_GOTO_ON_FALSE(h->file_free && h->file_ready && h->frame_free && h->frame_ready && h->done,
+                      ESP_ERR_NO_MEM, err, TAG, "queues");
+    for (int i = 0; i < cfg->file_slots; ++i)  xQueueSend(h->file_free, &i, 0);
+    for (int i = 0; i < cfg->frame_slots; ++i) xQueueSend(h->frame_free, &i, 0);
+
+    ESP_GOTO_ON_FALSE(xTaskCreatePinnedToCore(decoder_task, "ss_decode", SLIDESHOW_DECODER_STACK, h,
+                                              cfg->task_prio, NULL, cfg->decode_core) == pdPASS,
+                      ESP_ERR_NO_MEM, err, TAG, "decoder task");
+    h->tasks++;
+    if (xTaskCreatePinnedToCore(reader_task, "ss_read", SLIDESHOW_READER_STACK, h,
+                                cfg->task_prio, NULL, tskNO_AFFINITY) != pdPASS) {
+        slideshow_close(h);
+        ESP_LOGE(TAG, "reader task");
+        return ESP_ERR_NO_MEM;
+    }
+    h->tasks++;
+
+    ESP_LOGI(TAG, "'%s': %d photos, largest %u B; %d file / %d frame slots, decode on core %d",
+             source, h->photos, (unsigned)h->max_file, cfg->file_slots, cfg->frame_slots,
+             cfg->decode_core);
+    *out = h;
+    return ESP_OK;
+
+err:
+    free_all(h);
+    return ret;
+}
+
+void slideshow_close(slideshow_handle_t h)
+{
+    if (!h) return;
+    h->stop = true;
+    for (int i = 0; i < h->tasks; ++i) xSemaphoreTake(h->done, portMAX_DELAY);
+    /* The last present may still be copying out of a frame slot. */
+    (void)display_wait_idle(h->d, JPEG_DEC_IDLE_TIMEOUT_MS);
+    free_all(h);
+}
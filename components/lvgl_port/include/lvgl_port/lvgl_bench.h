@@ -0,0 +1,21 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "display_panel/display.h"
+
+/**
+ * Toolkit comparison on the launcher grid.
+ * Renders the ui_gfx menu (menu_draw + full present) and an LVGL screen with
+ * the same tiles, labels and swatches, each `frames` times, and logs average
+ * render and present time per frame for: full redraw (both), and a one-tile
+ * highlight change (LVGL invalidates only that tile; the ui_gfx menu presents
+ * the full frame). Needs lvgl_port_init() first; leaves LVGL paused.
+ */
+void lvgl_bench_run(display_handle_t d, uint16_t *fb, int frames);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,83 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "lvgl.h"
+#include "display_panel/display.h"
+#include "touch_gt9xx/touch_gt9xx.h"
+
+/**
+ * LVGL 8 on top of display_panel and touch_gt9xx.
+ *
+ * Flushes go through display_panel, so panel throttling and touch-to-photon
+ * accounting behave exactly as for ui_gfx. Two render modes:
+ *  - PARTIAL: two W×buf_lines bands in internal DMA RAM; each band is
+ *    presented with display_draw_bitmap() as soon as LVGL finishes it while
+ *    the other is drawn.
+ *  - DIRECT:  LVGL renders in place into the panel's two scanout buffers
+ *    (display_get_frame_buffers(), no extra frame); each refresh is flipped
+ *    on screen, then its dirty rows are copied to the other buffer. Needs a
+ *    panel with frame buffers (ESP_ERR_NOT_SUPPORTED otherwise).
+ * The tick comes from a periodic esp_timer; lv_timer_handler() runs on its own
+ * pinned task. Any LVGL call from another task must hold lvgl_port_lock().
+ */
+typedef enum {
+    LVGL_PORT_PARTIAL = 0,
+    LVGL_PORT_DIRECT,
+} lvgl_port_mode_t;
+
+typedef struct {
+    lvgl_port_mode_t mode;
+    int              buf_lines;      // PARTIAL: band height
+    uint32_t         tick_ms;        // lv_tick_inc() period
+    int              task_core;      // handler task affinity
+    uint32_t         task_priority;
+    uint32_t         task_stack;
+    uint32_t         max_sleep_ms;   // cap on handler idle between timer runs
+    touch_handle_t   touch;          // optional pointer input (NULL = none)
+} lvgl_port_cfg_t;
+
+/* Core 1: core 0 already carries esp_timer and the touch/menu loop. */
+#define LVGL_PORT_CFG_DEFAULT() {       \
+    .mode          = LVGL_PORT_PARTIAL, \
+    .buf_lines     = 80,                \
+    .tick_ms       = 2,                 \
+    .task_core     = 1,                 \
+    .task_priority = 4,                 \
+    .task_stack    = 8192,              \
+    .max_sleep_ms  = 20,                \
+    .touch         = NULL,              \
+}
+
+typedef struct {
+    uint32_t refreshes;   // completed screen refreshes (last flush of a frame)
+    uint32_t flushes;
+    uint64_t flush_us;    // time presenting (draw_bitmap; DIRECT: flip, wait and row sync)
+    uint64_t flush_px;
+} lvgl_port_stats_t;
+
+/** Initialise LVGL, register display (and touch), start tick + handler. Once per boot. */
+esp_err_t lvgl_port_init(display_handle_t d, const lvgl_port_cfg_t *cfg);
+
+/** Take the LVGL lock (recursive). timeout_ms 0 waits forever. */
+bool lvgl_port_lock(uint32_t timeout_ms);
+void lvgl_port_unlock(void);
+
+/**
+ * Stop (or resume) running LVGL timers and reading touch, e.g. while the
+ * ui_gfx menu owns the panel and the touch controller.
+ */
+void lvgl_port_pause(bool paused);
+
+lv_disp_t *lvgl_port_disp(void);
+
+void lvgl_port_get_stats(lvgl_port_stats_t *out);
+void lvgl_port_reset_stats(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
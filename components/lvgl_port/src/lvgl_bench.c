@@ -0,0 +1,164 @@
+#include "lvgl_port/lvgl_bench.h"
+#include "lvgl_port/lvgl_port.h"
+
+#include "esp_log.h"
+#include "ui_menu/menu.h"
+#include "ui_menu/menu_registry.h"
+#include "util/timing.h"
+
+static const char *TAG = "lvgl_bench";
+
+/* Mirrors ui_menu's grid (MENU_ROWS_VISIBLE and palette in menu.c). */
+#define GRID_ROWS_VISIBLE 2
+#define RGB565(r,g,b)     (uint16_t)((((r)&0x1F)<<11) | (((g)&0x3F)<<5) | ((b)&0x1F))
+#define C_BG              RGB565(0x02,0x04,0x02)
+#define C_TILE            RGB565(0x06,0x0C,0x08)
+#define C_TILE_HI         RGB565(0x08,0x12,0x0C)
+#define C_FRAME           RGB565(0x0F,0x1F,0x0F)
+#define C_TEXT            RGB565(0x1F,0x3F,0x1F)
+
+typedef struct {
+    uint64_t render_us, present_us;
+    int      frames;
+} tally_t;
+
+static inline lv_color_t c565(uint16_t v)
+{
+    lv_color_t c;
+    c.full = v;
+    return c;
+}
+
+static inline int clampi(int v, int lo, int hi) { return v < lo ? lo : (v > hi ? hi : v); }
+
+static void report(const char *what, const tally_t *t)
+{
+    const int n = t->frames ? t->frames : 1;
+    ESP_LOGI(TAG, "%-20s render %6u us  present %6u us  (avg of %d)", what,
+             (unsigned)(t->render_us / n), (unsigned)(t->present_us / n), t->frames);
+}
+
+/* ---- ui_gfx: the real menu path ---- */
+static void run_ui_gfx(display_handle_t d, uint16_t *fb, int frames, tally_t *t)
+{
+    const int W = display_width(d), H = display_height(d);
+    menu_draw(d, fb);  // cold: fills the tile cache
+    *t = (tally_t){0};
+    for (int i = 0; i < frames; ++i) {
+        const uint64_t t0 = timing_now_us();
+        menu_draw(d, fb);
+        const uint64_t t1 = timing_now_us();
+        (void)display_draw_bitmap(d, 0, 0, W, H, fb);
+        t->render_us  += t1 - t0;
+        t->present_us += timing_now_us() - t1;
+        t->frames++;
+    }
+}
+
+/* ---- LVGL: same grid as plain objects (theme styles removed) ---- */
+static lv_obj_t *box(lv_obj_t *parent, int x, int y, int w, int h, uint16_t bg, int border)
+{
+    lv_obj_t *o = lv_obj_create(parent);
+    lv_obj_remove_style_all(o);
+    lv_obj_clear_flag(o, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_pos(o, x, y);
+    lv_obj_set_size(o, w, h);
+    lv_obj_set_style_bg_opa(o, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(o, c565(bg), 0);
+    if (border) {
+        lv_obj_set_style_border_width(o, border, 0);
+        lv_obj_set_style_border_color(o, c565(C_FRAME), 0);
+    }
+    return o;
+}
+
+static lv_obj_t *build_grid(int W, int H, lv_obj_t **first_tile)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_remove_style_all(scr);
+    lv_obj_clear_flag(scr, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(scr, c565(C_BG), 0);
+    lv_obj_set_style_border_width(scr, 1, 0);
+    lv_obj_set_style_border_color(scr, c565(C_FRAME), 0);
+
+    const int gutter = (W < 480) ? 8 : 16;
+    const int colw   = (W - gutter * 3) / 2;
+    const int rowh   = (H - gutter * (GRID_ROWS_VISIBLE + 1)) / GRID_ROWS_VISIBLE;
+    const int count  = menu_tile_count();
+
+    *first_tile = NULL;
+    for (int i = 0; i < count; ++i) {
+        const int x0 = gutter + (i & 1) * (gutter + colw);
+        const int y0 = gutter + (i >> 1) * (rowh + gutter);
+        if (y0 >= H) break;
+        const menu_entry_t *e = menu_entry_at(i);
+
+        lv_obj_t *tile = box(scr, x0, y0, colw + 1, rowh + 1, C_TILE, 1);
+        if (!*first_tile) *first_tile = tile;
+
+        const int size = clampi(colw / 6, 8, 64);
+        if (e && e->accent) {
+            box(tile, (colw + 1) / 2 - size / 2, (rowh + 1) / 2 - size - 12, size, size, e->accent, 0);
+        }
+        lv_obj_t *label = lv_label_create(tile);
+        lv_label_set_text_static(label, e ? e->name : "");
+        lv_obj_set_style_text_color(label, c565(C_TEXT), 0);
+        lv_obj_align(label, LV_ALIGN_CENTER, 0, 0);
+    }
+    return scr;
+}
+
+static void refresh_timed(lv_disp_t *disp, tally_t *t)
+{
+    lvgl_port_stats_t st;
+    lvgl_port_reset_stats();
+    const uint64_t t0 = timing_now_us();
+    lv_refr_now(disp);
+    const uint64_t dt = timing_now_us() - t0;
+    lvgl_port_get_stats(&st);
+    t->present_us += st.flush_us;
+    t->render_us  += dt - st.flush_us;
+    t->frames++;
+}
+
+void lvgl_bench_run(display_handle_t d, uint16_t *fb, int frames)
+{
+    lv_disp_t *disp = lvgl_port_disp();
+    if (!disp || !fb || frames <= 0) {
+        ESP_LOGW(TAG, "skipped: %s", disp ? "bad args" : "lvgl_port not initialised");
+        return;
+    }
+    const int W = display_width(d), H = display_height(d);
+
+    tally_t gfx;
+    run_ui_gfx(d, fb, frames, &gfx);
+
+    tally_t full = {0}, one = {0};
+    lvgl_port_pause(false);
+    lvgl_port_lock(0);
+    lv_obj_t *tile = NULL;
+    lv_obj_t *old = lv_scr_act();
+    lv_obj_t *scr = build_grid(W, H, &tile);
+    lv_scr_load(scr);
+    lv_refr_now(disp);  // cold: layout, glyph cache
+
+    for (int i = 0; i < frames; ++i) {
+        lv_obj_invalidate(scr);
+        refresh_timed(disp, &full);
+    }
+    for (int i = 0; tile && i < frames; ++i) {
+        lv_obj_set_style_bg_color(tile, c565((i & 1) ? C_TILE : C_TILE_HI), 0);
+        refresh_timed(disp, &one);
+    }
+
+    lv_scr_load(old);
+    lv_obj_del(scr);
+    lvgl_port_unlock();
+    lvgl_port_pause(true);
+
+    report("ui_gfx full", &gfx);
+    report("lvgl full", &full);
+    report("lvgl one tile", &one);
+    ESP_LOGI(TAG, "ui_gfx presents the full frame for a tile change (render cost as above)");
+}
@@ -0,0 +1,271 @@
+#include "lvgl_port/lvgl_port.h"
+
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "util/mem.h"
+#include "util/timing.h"
+
+static const char *TAG = "lvgl_port";
+
+/* DIRECT: longest a refresh waits for its flip to reach the screen. */
+#ifndef LVGL_PORT_FLIP_TIMEOUT_MS
+#define LVGL_PORT_FLIP_TIMEOUT_MS 100
+#endif
+
+#if LV_COLOR_DEPTH != 16 || LV_COLOR_16_SWAP
+#error "lvgl_port flushes lv_color_t buffers as native RGB565: set LV_COLOR_DEPTH 16, no swap"
+#endif
+
+typedef struct {
+    display_handle_t   d;
+    touch_handle_t     touch;
+    lvgl_port_mode_t   mode;
+    uint32_t           max_sleep_ms;
+    int                W, H;
+
+    lv_disp_draw_buf_t draw_buf;
+    lv_disp_drv_t      disp_drv;
+    lv_disp_t         *disp;
+    lv_indev_drv_t     indev_drv;
+
+    SemaphoreHandle_t  lock;
+    esp_timer_handle_t tick;
+    TaskHandle_t       task;
+    volatile bool      paused;
+
+    uint16_t          *fbs[2];               // DIRECT: the panel's scanout buffers
+    int                dirty_y0, dirty_y1;   // DIRECT: row span of this refresh (inclusive)
+    uint16_t           last_x, last_y;
+    lvgl_port_stats_t  st;
+} port_t;
+
+static port_t s_port;
+static bool   s_ready;
+
+/* ---- display ---- */
+static void count_flush(port_t *p, uint64_t t0, int x0, int y0, int x1, int y1)
+{
+    p->st.flush_us += timing_now_us() - t0;
+    p->st.flush_px += (uint64_t)(x1 - x0) * (uint64_t)(y1 - y0);
+    p->st.flushes++;
+}
+
+static void present(port_t *p, int x0, int y0, int x1, int y1, const void *px)
+{
+    const uint64_t t0 = timing_now_us();
+    (void)display_draw_bitmap(p->d, x0, y0, x1, y1, px);
+    count_flush(p, t0, x0, y0, x1, y1);
+}
+
+/*
+ * PARTIAL: px is a packed band for area; present it directly. The next
+ * display_draw_bitmap() waits for this transfer, so LVGL drawing into the
+ * other band never races the copy.
+ */
+static void flush_partial(lv_disp_drv_t *drv, const lv_area_t *a, lv_color_t *px)
+{
+    port_t *p = (port_t *)drv->user_data;
+    present(p, a->x1, a->y1, a->x2 + 1, a->y2 + 1, px);
+    if (lv_disp_flush_is_last(drv)) p->st.refreshes++;
+    lv_disp_flush_ready(drv);
+}
+
+/*
+ * DIRECT: LVGL draws straight into the panel's back frame buffer (px is the
+ * whole frame). The last flush of a refresh flips it to the front and waits
+ * until that is on screen, so the old front is free again; then only the rows
+ * this refresh touched are copied across, leaving both buffers identical for
+ * LVGL to keep updating in place. flush_ready comes after all of that.
+ */
+static void flush_direct(lv_disp_drv_t *drv, const lv_area_t *a, lv_color_t *px)
+{
+    port_t *p = (port_t *)drv->user_data;
+    if (a->y1 < p->dirty_y0) p->dirty_y0 = a->y1;
+    if (a->y2 > p->dirty_y1) p->dirty_y1 = a->y2;
+
+    if (lv_disp_flush_is_last(drv)) {
+        if (p->dirty_y0 <= p->dirty_y1) {
+            const uint64_t t0 = timing_now_us();
+            uint16_t *front = (uint16_t *)px;
+            uint16_t *back  = (front == p->fbs[0]) ? p->fbs[1] : p->fbs[0];
+            if (display_flip(p->d, front) == ESP_OK &&
+                display_wait_flip(p->d, LVGL_PORT_FLIP_TIMEOUT_MS) != ESP_OK) {
+                ESP_LOGW(TAG, "flip not on screen after %d ms", LVGL_PORT_FLIP_TIMEOUT_MS);
+            }
+            const size_t off = (size_t)p->dirty_y0 * (size_t)p->W;
+            memcpy(back + off, front + off,
+                   (size_t)(p->dirty_y1 - p->dirty_y0 + 1) * (size_t)p->W * sizeof(uint16_t));
+            count_flush(p, t0, 0, p->dirty_y0, p->W, p->dirty_y1 + 1);
+        }
+        p->dirty_y0 = p->H;
+        p->dirty_y1 = -1;
+        p->st.refreshes++;
+    }
+    lv_disp_flush_ready(drv);
+}
+
+/* ---- touch ---- */
+static void touch_read(lv_indev_drv_t *drv, lv_indev_data_t *data)
+{
+    port_t *p = (port_t *)drv->user_data;
+    uint16_t x = 0, y = 0;
+    if (!p->paused && touch_gt9xx_read_first(p->touch, &x, &y)) {
+        p->last_x = x;
+        p->last_y = y;
+        data->state = LV_INDEV_STATE_PRESSED;
+        display_mark_input(p->d, touch_gt9xx_last_sample_us(p->touch));
+    } else {
+        data->state = LV_INDEV_STATE_RELEASED;
+    }
+    data->point.x = (lv_coord_t)p->last_x;
+    data->point.y = (lv_coord_t)p->last_y;
+}
+
+/* ---- tick + handler ---- */
+static void tick_cb(void *arg)
+{
+    lv_tick_inc((uint32_t)(uintptr_t)arg);
+}
+
+static void handler_task(void *arg)
+{
+    port_t *p = (port_t *)arg;
+    for (;;) {
+        uint32_t sleep_ms = p->max_sleep_ms;
+        if (!p->paused && lvgl_port_lock(0)) {
+            sleep_ms = lv_timer_handler();
+            lvgl_port_unlock();
+        }
+        if (sleep_ms > p->max_sleep_ms) sleep_ms = p->max_sleep_ms;
+        const TickType_t ticks = pdMS_TO_TICKS(sleep_ms);
+        vTaskDelay(ticks ? ticks : 1);
+    }
+}
+
+static esp_err_t alloc_buffers(port_t *p, int buf_lines)
+{
+    if (p->mode == LVGL_PORT_DIRECT) {
+        ESP_RETURN_ON_ERROR(display_get_frame_buffers(p->d, p->fbs), TAG, "direct mode needs panel frame buffers");
+        // LVGL starts in buf1: make that the one not being scanned out.
+        const bool fb0_front = display_front_buffer(p->d) == p->fbs[0];
+        uint16_t *first  = fb0_front ? p->fbs[1] : p->fbs[0];
+        uint16_t *second = fb0_front ? p->fbs[0] : p->fbs[1];
+        lv_disp_draw_buf_init(&p->draw_buf, first, second, (uint32_t)p->W * (uint32_t)p->H);
+        return ESP_OK;
+    }
+
+    ESP_RETURN_ON_FALSE(buf_lines > 0, ESP_ERR_INVALID_ARG, TAG, "buf_lines");
+    if (buf_lines > p->H) buf_lines = p->H;
+    const uint32_t px    = (uint32_t)p->W * (uint32_t)buf_lines;
+    const uint32_t caps  = MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA;
+    void *a = mem_malloc(MEM_TAG_LVGL, px * sizeof(lv_color_t), caps);
+    void *b = mem_malloc(MEM_TAG_LVGL, px * sizeof(lv_color_t), caps);
+    if (!a || !b) {
+        mem_free(MEM_TAG_LVGL, a);
+        mem_free(MEM_TAG_LVGL, b);
+        ESP_LOGE(TAG, "no internal DMA RAM for 2x%d lines", buf_lines);
+        return ESP_ERR_NO_MEM;
+    }
+    lv_disp_draw_buf_init(&p->draw_buf, a, b, px);
+    return ESP_OK;
+}
+
+esp_err_t lvgl_port_init(display_handle_t d, const lvgl_port_cfg_t *cfg)
+{
+    ESP_RETURN_ON_FALSE(d, ESP_ERR_INVALID_ARG, TAG, "no display");
+    ESP_RETURN_ON_FALSE(!s_ready, ESP_ERR_INVALID_STATE, TAG, "already initialised");
+    const lvgl_port_cfg_t def = LVGL_PORT_CFG_DEFAULT();
+    if (!cfg) cfg = &def;
+
+    port_t *p = &s_port;
+    *p = (port_t){
+        .d            = d,
+        .touch        = cfg->touch,
+        .mode         = cfg->mode,
+        .max_sleep_ms = cfg->max_sleep_ms ? cfg->max_sleep_ms : 20,
+        .W            = display_width(d),
+        .H            = display_height(d),
+    };
+    p->dirty_y0 = p->H;
+    p->dirty_y1 = -1;
+
+    p->lock = xSemaphoreCreateRecursiveMutex();
+    ESP_RETURN_ON_FALSE(p->lock, ESP_ERR_NO_MEM, TAG, "lock");
+
+    lv_init();
+    ESP_RETURN_ON_ERROR(alloc_buffers(p, cfg->buf_lines), TAG, "buffers");
+
+    lv_disp_drv_init(&p->disp_drv);
+    p->disp_drv.hor_res     = (lv_coord_t)p->W;
+    p->disp_drv.ver_res     = (lv_coord_t)p->H;
+    p->disp_drv.draw_buf    = &p->draw_buf;
+    p->disp_drv.flush_cb    = (p->mode == LVGL_PORT_DIRECT) ? flush_direct : flush_partial;
+    p->disp_drv.direct_mode = (p->mode == LVGL_PORT_DIRECT);
+    p->disp_drv.user_data   = p;
+    p->disp = lv_disp_drv_register(&p->disp_drv);
+    ESP_RETURN_ON_FALSE(p->disp, ESP_FAIL, TAG, "display register");
+
+    if (p->touch) {
+        lv_indev_drv_init(&p->indev_drv);
+        p->indev_drv.type      = LV_INDEV_TYPE_POINTER;
+        p->indev_drv.read_cb   = touch_read;
+        p->indev_drv.user_data = p;
+        ESP_RETURN_ON_FALSE(lv_indev_drv_register(&p->indev_drv), ESP_FAIL, TAG, "indev register");
+    }
+
+    const uint32_t tick_ms = cfg->tick_ms ? cfg->tick_ms : 2;
+    const esp_timer_create_args_t targs = {
+        .callback = tick_cb,
+        .arg      = (void *)(uintptr_t)tick_ms,
+        .name     = "lv_tick",
+    };
+    ESP_RETURN_ON_ERROR(esp_timer_create(&targs, &p->tick), TAG, "tick timer");
+    ESP_RETURN_ON_ERROR(esp_timer_start_periodic(p->tick, (uint64_t)tick_ms * 1000ULL), TAG, "tick start");
+
+    ESP_RETURN_ON_FALSE(xTaskCreatePinnedToCore(handler_task, "lvgl", cfg->task_stack, p,
+                                                cfg->task_priority, &p->task, cfg->task_core) == pdPASS,
+                        ESP_ERR_NO_MEM, TAG, "handler task");
+
+    s_ready = true;
+    ESP_LOGI(TAG, "%dx%d, %s, touch %s, handler on core %d", p->W, p->H,
+             p->mode == LVGL_PORT_DIRECT ? "direct" : "partial", p->touch ? "on" : "off", cfg->task_core);
+    return ESP_OK;
+}
+
+bool lvgl_port_lock(uint32_t timeout_ms)
+{
+    if (!s_port.lock) return false;
+    const TickType_t ticks = timeout_ms ? pdMS_TO_TICKS(timeout_ms) : portMAX_DELAY;
+    return xSemaphoreTakeRecursive(s_port.lock, ticks) == pdTRUE;
+}
+
+void lvgl_port_unlock(void)
+{
+    if (s_port.lock) xSemaphoreGiveRecursive(s_port.lock);
+}
+
+void lvgl_port_pause(bool paused)
+{
+    s_port.paused = paused;
+}
+
+lv_disp_t *lvgl_port_disp(void)
+{
+    return s_ready ? s_port.disp : NULL;
+}
+
+void lvgl_port_get_stats(lvgl_port_stats_t *out)
+{
+    if (out) *out = s_port.st;
+}
+
+void lvgl_port_reset_stats(void)
+{
+    s_port.st = (lvgl_port_stats_t){0};
+}
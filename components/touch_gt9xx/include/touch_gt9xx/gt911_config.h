@@ -0,0 +1,87 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/* GT911 configuration area: 184 bytes at 0x8047..0x80FE, then checksum + fresh flag. */
+#define GT911_CFG_REG_START     0x8047
+#define GT911_CFG_LEN           184
+#define GT911_CFG_REG_CHECKSUM  0x80FF
+#define GT911_CFG_REG_FRESH     0x8100
+
+/* Field offsets inside the block (datasheet names in comments). */
+#define GT911_CFG_OFF_VERSION     0x00  // Config_Version
+#define GT911_CFG_OFF_X_MAX       0x01  // X_Output_Max L,H
+#define GT911_CFG_OFF_Y_MAX       0x03  // Y_Output_Max L,H
+#define GT911_CFG_OFF_TOUCH_NUM   0x05  // Touch_Number [3:0], 1..5
+#define GT911_CFG_OFF_TOUCH_LEVEL 0x0C  // Screen_Touch_Level
+#define GT911_CFG_OFF_LEAVE_LEVEL 0x0D  // Screen_Leave_Level
+#define GT911_CFG_OFF_REFRESH     0x0F  // Refresh_Rate [3:0], period = 5 + N ms
+
+/** Raw copy of the configuration block. */
+typedef struct {
+    uint8_t raw[GT911_CFG_LEN];
+} gt911_config_t;
+
+/**
+ * Register access used by the config manager. The touch driver supplies an
+ * I2C-backed instance; anything else (e.g. a simulated register file) works too.
+ * Writes of any length must be accepted (auto-increment addressing).
+ */
+typedef struct {
+    esp_err_t (*read)(void *ctx, uint16_t reg, void *buf, size_t len);
+    esp_err_t (*write)(void *ctx, uint16_t reg, const void *buf, size_t len);
+    void *ctx;
+} gt911_regio_t;
+
+/**
+ * Fields to change. Any negative value means "keep what the module has".
+ */
+typedef struct {
+    int refresh_ms;    // report period, 5..20 ms
+    int max_points;    // 1..5
+    int touch_level;   // press threshold, 1..255
+    int leave_level;   // release threshold, 1..255
+} gt911_config_patch_t;
+
+/** Patch that leaves every field untouched. */
+#define GT911_CONFIG_PATCH_KEEP() { .refresh_ms = -1, .max_points = -1, \
+                                    .touch_level = -1, .leave_level = -1 }
+
+/** Two's-complement checksum of the block, as expected at 0x80FF. */
+uint8_t gt911_config_checksum(const gt911_config_t *cfg);
+
+/**
+ * Read the block plus its checksum byte.
+ * @return ESP_OK, ESP_ERR_INVALID_CRC if the stored checksum does not match,
+ *         or the register read error.
+ */
+esp_err_t gt911_config_read(const gt911_regio_t *io, gt911_config_t *cfg);
+
+/**
+ * Apply a patch in place.
+ * @return ESP_ERR_INVALID_ARG if a requested value is out of range (cfg unchanged).
+ */
+esp_err_t gt911_config_apply_patch(gt911_config_t *cfg, const gt911_config_patch_t *patch);
+
+/**
+ * Write the block, its checksum and the Config_Fresh flag, but only when it
+ * differs from what the device currently holds.
+ *
+ * @param[out] written  Optional; true if a write was issued.
+ */
+esp_err_t gt911_config_write_if_changed(const gt911_regio_t *io, const gt911_config_t *cfg,
+                                        bool *written);
+
+/** Decoded views of the fields we patch. */
+int gt911_config_refresh_ms(const gt911_config_t *cfg);
+int gt911_config_max_points(const gt911_config_t *cfg);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
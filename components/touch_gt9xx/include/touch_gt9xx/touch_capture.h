@@ -0,0 +1,65 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/*
+ * Compact touch capture format (little-endian):
+ *
+ *   header  : "TCAP" | u8 version | u8 flags | u16 reserved | u32 sample_count
+ *   record  : varint dt_us | u8 state | [u16 x | u16 y]   (coords only when pressed)
+ *
+ * dt_us is relative to the previous record (the first one to capture start).
+ * A press is a run of pressed records; a single released record ends it.
+ */
+#define TOUCH_CAPTURE_MAGIC        "TCAP"
+#define TOUCH_CAPTURE_VERSION      1
+#define TOUCH_CAPTURE_HEADER_LEN   12
+#define TOUCH_CAPTURE_RECORD_MAX   9   // 4-byte varint + state + x + y
+
+typedef struct {
+    uint64_t t_us;      // since capture start
+    uint16_t x, y;
+    bool     pressed;
+} touch_sample_t;
+
+typedef struct {
+    uint8_t *buf;
+    size_t   cap;
+    size_t   len;
+    uint32_t count;
+    uint64_t t_prev;
+    bool     overflow;  // set once a record did not fit; later appends are dropped
+} touch_capture_writer_t;
+
+typedef struct {
+    const uint8_t *buf;
+    size_t   len;
+    size_t   pos;
+    uint32_t remaining;
+    uint64_t t;
+} touch_capture_reader_t;
+
+/** Start a capture in buf (writes the header). Returns ESP_ERR_INVALID_SIZE if cap is too small. */
+esp_err_t touch_capture_writer_init(touch_capture_writer_t *w, uint8_t *buf, size_t cap);
+
+/** Append one sample; samples must be in time order. Returns false if the buffer is full. */
+bool touch_capture_append(touch_capture_writer_t *w, const touch_sample_t *s);
+
+/** Patch the sample count into the header. Returns total bytes used. */
+size_t touch_capture_finish(touch_capture_writer_t *w);
+
+/** Validate the header and prepare to iterate. */
+esp_err_t touch_capture_reader_init(touch_capture_reader_t *r, const uint8_t *buf, size_t len);
+
+/** Next sample; false at end (or on a truncated record). */
+bool touch_capture_next(touch_capture_reader_t *r, touch_sample_t *out);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -6,6 +6,8 @@ extern "C" {
 #include <stdbool.h>
 #include <stdint.h>
 #include "esp_err.h"
+#include "touch_gt9xx/gt911_config.h"
+#include "touch_gt9xx/touch_capture.h"
 
 /** Opaque touch handle */
 typedef struct touch_handle_t_* touch_handle_t;
@@ -24,11 +26,18 @@ esp_err_t touch_gt9xx_init(touch_handle_t *out);
 /**
  * Read the first touch point (P0), if present.
  * On success, acknowledges (clears) the touch status register.
+ * Replay handles serve the capture instead; an active recorder logs the result.
  *
  * @return true if a point was read; false otherwise
  */
 bool touch_gt9xx_read_first(touch_handle_t t, uint16_t *x, uint16_t *y);
 
+/**
+ * Time (µs, esp_timer epoch) at which the last point returned by read_first()
+ * finished its I2C read. Pair with display_mark_input() for touch-to-photon.
+ */
+uint64_t touch_gt9xx_last_sample_us(touch_handle_t t);
+
 /**
  * Optional: fetch device info. Any argument may be NULL.
  * pid[4] is copied raw (no terminator).
@@ -36,6 +45,37 @@ bool touch_gt9xx_read_first(touch_handle_t t, uint16_t *x, uint16_t *y);
 esp_err_t touch_gt9xx_dump_info(touch_handle_t t, char pid[4],
                                 uint16_t *fwver, uint16_t *xmax, uint16_t *ymax);
 
+/**
+ * Patch the GT911 configuration block (report rate, point count, thresholds).
+ * Reads and verifies the block, applies the patch, and writes it back with
+ * Config_Fresh only if a byte actually changed.
+ *
+ * @param[out] changed  Optional; true if the device config was rewritten.
+ * @return ESP_OK on success; ESP_ERR_INVALID_CRC if the stored block is corrupt.
+ */
+esp_err_t touch_gt9xx_configure(touch_handle_t t, const gt911_config_patch_t *patch, bool *changed);
+
+/**
+ * Record every read_first() result into buf (touch_capture format):
+ * pressed samples plus the release that ends each press.
+ */
+esp_err_t touch_gt9xx_record_start(touch_handle_t t, uint8_t *buf, size_t cap);
+
+/** Stop recording; returns capture size in bytes (0 if not recording). */
+size_t touch_gt9xx_record_stop(touch_handle_t t);
+
+/**
+ * Open a replay source: a handle without hardware whose read_first() plays
+ * back a capture against the wall clock, starting at the first read.
+ * Polling gaps longer than TOUCH_REPLAY_STALL_US do not advance the capture,
+ * so sessions stay in step with a UI that blocks (e.g. while a demo runs).
+ * data must outlive the handle. Config/info calls return ESP_ERR_NOT_SUPPORTED.
+ */
+esp_err_t touch_gt9xx_open_replay(const uint8_t *data, size_t len, touch_handle_t *out);
+
+/** True once a replay handle has played its last sample and is released. */
+bool touch_gt9xx_replay_done(touch_handle_t t);
+
 /** Graceful shutdown: remove device and delete bus. Safe to call once. */
 void touch_gt9xx_deinit(touch_handle_t t);
 
@@ -0,0 +1,69 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Alpha-beta touch predictor.
+ * Feed timestamped samples of one contact; ask where it will be at a future
+ * time (e.g. when the frame being rendered reaches the panel).
+ */
+typedef struct {
+    float    alpha;           // position gain, 0..1
+    float    beta;            // velocity gain, 0..1 (keep well below alpha)
+    float    jitter_px;       // residuals below this are treated as sensor noise
+    uint32_t max_horizon_us;  // clamp on how far ahead we extrapolate
+    uint32_t reset_gap_us;    // a gap this long starts a new stroke
+} touch_predict_cfg_t;
+
+#define TOUCH_PREDICT_CFG_DEFAULT() { .alpha = 0.6f, .beta = 0.15f, .jitter_px = 1.5f, \
+                                      .max_horizon_us = 50000, .reset_gap_us = 100000 }
+
+/** Prediction error, measured when a real sample lands past a queried target time. */
+typedef struct {
+    uint32_t samples;       // samples fed
+    uint32_t scored;        // predictions compared against reality
+    float    mean_err_px;
+    float    max_err_px;
+    float    last_err_px;
+} touch_predict_stats_t;
+
+typedef struct {
+    touch_predict_cfg_t cfg;
+    bool     active;
+    float    x, y;          // filtered position
+    float    vx, vy;        // px per µs
+    uint64_t t_last_us;
+    float    raw_x, raw_y;  // last raw sample (for scoring)
+    /* outstanding prediction waiting to be scored */
+    bool     pending;
+    uint64_t pend_t_us;
+    float    pend_x, pend_y;
+    double   err_sum;
+    touch_predict_stats_t stats;
+} touch_predict_t;
+
+/** Reset state and stats. cfg may be NULL for defaults. */
+void touch_predict_init(touch_predict_t *p, const touch_predict_cfg_t *cfg);
+
+/** Contact lifted: the next sample starts a fresh stroke (stats are kept). */
+void touch_predict_release(touch_predict_t *p);
+
+/** Feed one sample taken at t_us (same epoch as timing_now_us()). */
+void touch_predict_update(touch_predict_t *p, uint16_t x, uint16_t y, uint64_t t_us);
+
+/**
+ * Predicted contact position at target_us (e.g. expected display time).
+ * @return false if no stroke is active (x/y untouched).
+ */
+bool touch_predict_at(touch_predict_t *p, uint64_t target_us, int *x, int *y);
+
+/** Copy out current error statistics. */
+void touch_predict_get_stats(const touch_predict_t *p, touch_predict_stats_t *out);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
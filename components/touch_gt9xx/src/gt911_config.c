@@ -0,0 +1,100 @@
+#include "touch_gt9xx/gt911_config.h"
+
+#include <string.h>
+#include "esp_check.h"
+
+static const char *TAG = "gt911_config";
+
+/* Refresh_Rate low nibble encodes (period - 5) ms. */
+#define GT911_REFRESH_MIN_MS   5
+#define GT911_REFRESH_MAX_MS   20
+#define GT911_POINTS_MAX       5
+
+uint8_t gt911_config_checksum(const gt911_config_t *cfg)
+{
+    uint8_t sum = 0;
+    for (size_t i = 0; i < GT911_CFG_LEN; ++i) sum += cfg->raw[i];
+    return (uint8_t)(~sum + 1);
+}
+
+esp_err_t gt911_config_read(const gt911_regio_t *io, gt911_config_t *cfg)
+{
+    ESP_RETURN_ON_FALSE(io && io->read && cfg, ESP_ERR_INVALID_ARG, TAG, "null arg");
+
+    uint8_t buf[GT911_CFG_LEN + 1];
+    ESP_RETURN_ON_ERROR(io->read(io->ctx, GT911_CFG_REG_START, buf, sizeof(buf)), TAG, "read cfg");
+    memcpy(cfg->raw, buf, GT911_CFG_LEN);
+
+    const uint8_t want = gt911_config_checksum(cfg);
+    if (buf[GT911_CFG_LEN] != want) {
+        ESP_LOGW(TAG, "checksum mismatch (stored 0x%02X, computed 0x%02X)",
+                 buf[GT911_CFG_LEN], want);
+        return ESP_ERR_INVALID_CRC;
+    }
+    return ESP_OK;
+}
+
+esp_err_t gt911_config_apply_patch(gt911_config_t *cfg, const gt911_config_patch_t *patch)
+{
+    ESP_RETURN_ON_FALSE(cfg && patch, ESP_ERR_INVALID_ARG, TAG, "null arg");
+
+    /* Validate everything first so a bad patch leaves cfg untouched. */
+    if (patch->refresh_ms >= 0 &&
+        (patch->refresh_ms < GT911_REFRESH_MIN_MS || patch->refresh_ms > GT911_REFRESH_MAX_MS)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (patch->max_points >= 0 && (patch->max_points < 1 || patch->max_points > GT911_POINTS_MAX)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (patch->touch_level > 255 || patch->leave_level > 255 ||
+        patch->touch_level == 0 || patch->leave_level == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint8_t *r = cfg->raw;
+    if (patch->refresh_ms >= 0) {
+        r[GT911_CFG_OFF_REFRESH] = (uint8_t)((r[GT911_CFG_OFF_REFRESH] & 0xF0) |
+                                             (patch->refresh_ms - GT911_REFRESH_MIN_MS));
+    }
+    if (patch->max_points >= 0) {
+        r[GT911_CFG_OFF_TOUCH_NUM] = (uint8_t)((r[GT911_CFG_OFF_TOUCH_NUM] & 0xF0) |
+                                               patch->max_points);
+    }
+    if (patch->touch_level > 0) r[GT911_CFG_OFF_TOUCH_LEVEL] = (uint8_t)patch->touch_level;
+    if (patch->leave_level > 0) r[GT911_CFG_OFF_LEAVE_LEVEL] = (uint8_t)patch->leave_level;
+    return ESP_OK;
+}
+
+esp_err_t gt911_config_write_if_changed(const gt911_regio_t *io, const gt911_config_t *cfg,
+                                        bool *written)
+{
+    ESP_RETURN_ON_FALSE(io && io->read && io->write && cfg, ESP_ERR_INVALID_ARG, TAG, "null arg");
+    if (written) *written = false;
+
+    /* Compare against the live block; a corrupt one is always rewritten. */
+    gt911_config_t cur;
+    const esp_err_t err = gt911_config_read(io, &cur);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_CRC) return err;
+    if (err == ESP_OK && memcmp(cur.raw, cfg->raw, GT911_CFG_LEN) == 0) return ESP_OK;
+
+    ESP_RETURN_ON_ERROR(io->write(io->ctx, GT911_CFG_REG_START, cfg->raw, GT911_CFG_LEN),
+                        TAG, "write cfg");
+
+    /* Checksum and Config_Fresh are adjacent: one write commits the block. */
+    const uint8_t tail[2] = { gt911_config_checksum(cfg), 0x01 };
+    ESP_RETURN_ON_ERROR(io->write(io->ctx, GT911_CFG_REG_CHECKSUM, tail, sizeof(tail)),
+                        TAG, "write checksum");
+
+    if (written) *written = true;
+    return ESP_OK;
+}
+
+int gt911_config_refresh_ms(const gt911_config_t *cfg)
+{
+    return GT911_REFRESH_MIN_MS + (cfg->raw[GT911_CFG_OFF_REFRESH] & 0x0F);
+}
+
+int gt911_config_max_points(const gt911_config_t *cfg)
+{
+    return cfg->raw[GT911_CFG_OFF_TOUCH_NUM] & 0x0F;
+}
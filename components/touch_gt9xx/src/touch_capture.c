@@ -0,0 +1,114 @@
+#include "touch_gt9xx/touch_capture.h"
+
+#include <string.h>
+
+static void put_u32le(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t get_u32le(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+esp_err_t touch_capture_writer_init(touch_capture_writer_t *w, uint8_t *buf, size_t cap)
+{
+    if (!w || !buf) return ESP_ERR_INVALID_ARG;
+    if (cap < TOUCH_CAPTURE_HEADER_LEN) return ESP_ERR_INVALID_SIZE;
+
+    memset(w, 0, sizeof(*w));
+    w->buf = buf;
+    w->cap = cap;
+
+    memcpy(buf, TOUCH_CAPTURE_MAGIC, 4);
+    buf[4] = TOUCH_CAPTURE_VERSION;
+    buf[5] = 0;                  // flags
+    buf[6] = 0; buf[7] = 0;      // reserved
+    put_u32le(&buf[8], 0);       // count, patched by finish()
+    w->len = TOUCH_CAPTURE_HEADER_LEN;
+    return ESP_OK;
+}
+
+bool touch_capture_append(touch_capture_writer_t *w, const touch_sample_t *s)
+{
+    if (!w || !s || w->overflow) return false;
+
+    uint8_t rec[TOUCH_CAPTURE_RECORD_MAX + 1];
+    size_t  n = 0;
+
+    /* Deltas beyond ~268 s are clamped; captures are meant to be short sessions. */
+    uint64_t dt64 = (s->t_us > w->t_prev) ? (s->t_us - w->t_prev) : 0;
+    uint32_t dt   = (dt64 > 0x0FFFFFFFu) ? 0x0FFFFFFFu : (uint32_t)dt64;
+    do {
+        uint8_t b = dt & 0x7F;
+        dt >>= 7;
+        rec[n++] = dt ? (uint8_t)(b | 0x80) : b;
+    } while (dt);
+
+    rec[n++] = s->pressed ? 1 : 0;
+    if (s->pressed) {
+        rec[n++] = (uint8_t)s->x; rec[n++] = (uint8_t)(s->x >> 8);
+        rec[n++] = (uint8_t)s->y; rec[n++] = (uint8_t)(s->y >> 8);
+    }
+
+    if (w->len + n > w->cap) {
+        w->overflow = true;
+        return false;
+    }
+    memcpy(&w->buf[w->len], rec, n);
+    w->len += n;
+    w->count++;
+    w->t_prev = w->t_prev + dt64;
+    return true;
+}
+
+size_t touch_capture_finish(touch_capture_writer_t *w)
+{
+    if (!w || !w->buf) return 0;
+    put_u32le(&w->buf[8], w->count);
+    return w->len;
+}
+
+esp_err_t touch_capture_reader_init(touch_capture_reader_t *r, const uint8_t *buf, size_t len)
+{
+    if (!r || !buf) return ESP_ERR_INVALID_ARG;
+    if (len < TOUCH_CAPTURE_HEADER_LEN) return ESP_ERR_INVALID_SIZE;
+    if (memcmp(buf, TOUCH_CAPTURE_MAGIC, 4) != 0) return ESP_ERR_INVALID_ARG;
+    if (buf[4] != TOUCH_CAPTURE_VERSION) return ESP_ERR_INVALID_VERSION;
+
+    memset(r, 0, sizeof(*r));
+    r->buf       = buf;
+    r->len       = len;
+    r->pos       = TOUCH_CAPTURE_HEADER_LEN;
+    r->remaining = get_u32le(&buf[8]);
+    return ESP_OK;
+}
+
+bool touch_capture_next(touch_capture_reader_t *r, touch_sample_t *out)
+{
+    if (!r || !r->remaining) return false;
+
+    uint32_t dt = 0;
+    for (int shift = 0; ; shift += 7) {
+        if (r->pos >= r->len || shift > 21) return false;
+        const uint8_t b = r->buf[r->pos++];
+        dt |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) break;
+    }
+    if (r->pos >= r->len) return false;
+
+    touch_sample_t s = { .t_us = r->t + dt, .pressed = (r->buf[r->pos++] & 1) != 0 };
+    if (s.pressed) {
+        if (r->pos + 4 > r->len) return false;
+        const uint8_t *p = &r->buf[r->pos];
+        s.x = (uint16_t)(p[0] | (p[1] << 8));
+        s.y = (uint16_t)(p[2] | (p[3] << 8));
+        r->pos += 4;
+    }
+
+    r->t = s.t_us;
+    r->remaining--;
+    if (out) *out = s;
+    return true;
+}
@@ -6,8 +6,12 @@
 #include "esp_check.h"
 #include "esp_log.h"
 #include "esp_idf_version.h"      // for ESP_IDF_VERSION* macros
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
 
 #include "board/board.h"
+#include "util/mem.h"
+#include "util/trace.h"
 #include "driver/i2c_master.h"
 #include "i2c_bus.h"              // helper wrapper used by your main
 
@@ -21,11 +25,34 @@ static const char *TAG = "touch_gt9xx";
 #define GT_REG_FWVER       0x8144   // 2 bytes
 #define GT_REG_XY_MAX      0x8048   // X L,H, Y L,H
 
+/* Replay: polling gaps longer than this (app busy, e.g. in a demo) don't advance the capture. */
+#ifndef TOUCH_REPLAY_STALL_US
+#define TOUCH_REPLAY_STALL_US  250000
+#endif
+
 typedef struct touch_handle_t_ {
     i2c_bus_handle_t        bus_outer;
     i2c_master_bus_handle_t bus_raw;
-    i2c_master_dev_handle_t dev;
+    i2c_master_dev_handle_t dev;       // NULL for replay handles
     uint16_t xmax, ymax;
+    uint64_t last_sample_us;           // I2C completion time of the last P0 read
+
+    /* Recorder (live handles) */
+    bool                    recording;
+    bool                    rec_pressed;
+    uint64_t                rec_t0;
+    touch_capture_writer_t  rec;
+
+    /* Replay source (serves read_first instead of I2C) */
+    bool                    replay;
+    bool                    rp_started;
+    bool                    rp_done;
+    bool                    rp_have_next;
+    uint64_t                rp_t0;
+    uint64_t                rp_last_poll;
+    touch_capture_reader_t  rp;
+    touch_sample_t          rp_cur;
+    touch_sample_t          rp_next;
 } touch_handle_t_;
 
 /* ---- low-level helpers on modern i2c_master_* ---- */
@@ -46,6 +73,25 @@ static esp_err_t gt_reg_write(i2c_master_dev_handle_t dev, uint16_t reg, const v
     return i2c_master_transmit(dev, tmp, 2 + len, 20);
 }
 
+/* ---- gt911_regio_t adapters (config block writes exceed one 16-byte frame) ---- */
+static esp_err_t gt_io_read(void *ctx, uint16_t reg, void *buf, size_t len)
+{
+    return gt_reg_read((i2c_master_dev_handle_t)ctx, reg, buf, len);
+}
+
+static esp_err_t gt_io_write(void *ctx, uint16_t reg, const void *buf, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)buf;
+    while (len) {
+        const size_t n = (len > 16) ? 16 : len;
+        ESP_RETURN_ON_ERROR(gt_reg_write((i2c_master_dev_handle_t)ctx, reg, p, n), TAG, "tx chunk");
+        reg += (uint16_t)n;
+        p   += n;
+        len -= n;
+    }
+    return ESP_OK;
+}
+
 /* ---- public API ---- */
 esp_err_t touch_gt9xx_init(touch_handle_t *out)
 {
@@ -58,7 +104,7 @@ esp_err_t touch_gt9xx_init(touch_handle_t *out)
     const uint8_t  addr = board_touch_i2c_address();
     const uint32_t hz   = board_touch_safe_scl_hz();
 
-    touch_handle_t_ *h = calloc(1, sizeof(*h));
+    touch_handle_t_ *h = mem_calloc(MEM_TAG_TOUCH, 1, sizeof(*h), MALLOC_CAP_DEFAULT);
     if (!h) { ret = ESP_ERR_NO_MEM; goto err; }
 
     // Outer bus (matches your working example)
@@ -111,16 +157,13 @@ err:
     if (h) {
         if (h->dev)       (void)i2c_master_bus_rm_device(h->dev);
         if (h->bus_outer) (void)i2c_bus_delete(h->bus_outer);
-        free(h);
+        mem_free(MEM_TAG_TOUCH, h);
     }
     return ret;
 }
 
-bool touch_gt9xx_read_first(touch_handle_t t, uint16_t *x, uint16_t *y)
+static bool read_first_i2c(touch_handle_t_ *h, uint16_t *x, uint16_t *y)
 {
-    touch_handle_t_ *h = (touch_handle_t_ *)t;
-    if (!h) return false;
-
     uint8_t status = 0;
     if (gt_reg_read(h->dev, GT_REG_STATUS, &status, 1) != ESP_OK) return false;
 
@@ -133,20 +176,132 @@ bool touch_gt9xx_read_first(touch_handle_t t, uint16_t *x, uint16_t *y)
 
     uint8_t p0[8] = {0};
     if (gt_reg_read(h->dev, GT_REG_POINT1, p0, sizeof(p0)) != ESP_OK) return false;
+    h->last_sample_us = (uint64_t)esp_timer_get_time();
 
-    if (x) *x = (uint16_t)((p0[1] << 8) | p0[0]);
-    if (y) *y = (uint16_t)((p0[3] << 8) | p0[2]);
+    *x = (uint16_t)((p0[1] << 8) | p0[0]);
+    *y = (uint16_t)((p0[3] << 8) | p0[2]);
 
     uint8_t zero = 0;
     (void)gt_reg_write(h->dev, GT_REG_STATUS, &zero, 1);  // ACK/clear
     return true;
 }
 
+/* Keep pressed samples plus the first release after each press. */
+static void record_sample(touch_handle_t_ *h, bool pressed, uint16_t x, uint16_t y)
+{
+    if (!pressed && !h->rec_pressed) return;
+    const touch_sample_t s = {
+        .t_us    = (uint64_t)esp_timer_get_time() - h->rec_t0,
+        .x       = x,
+        .y       = y,
+        .pressed = pressed,
+    };
+    (void)touch_capture_append(&h->rec, &s);
+    h->rec_pressed = pressed;
+}
+
+static bool read_first_replay(touch_handle_t_ *h, uint16_t *x, uint16_t *y)
+{
+    const uint64_t now = (uint64_t)esp_timer_get_time();
+    if (!h->rp_started) {
+        h->rp_started   = true;
+        h->rp_t0        = now;
+        h->rp_last_poll = now;
+    }
+
+    const uint64_t gap = now - h->rp_last_poll;
+    if (gap > TOUCH_REPLAY_STALL_US) h->rp_t0 += gap - TOUCH_REPLAY_STALL_US;
+    h->rp_last_poll = now;
+
+    const uint64_t t = now - h->rp_t0;
+    while (h->rp_have_next && h->rp_next.t_us <= t) {
+        h->rp_cur       = h->rp_next;
+        h->rp_have_next = touch_capture_next(&h->rp, &h->rp_next);
+    }
+    if (!h->rp_have_next && !h->rp_cur.pressed) h->rp_done = true;
+
+    if (!h->rp_cur.pressed) return false;
+    h->last_sample_us = now;
+    *x = h->rp_cur.x;
+    *y = h->rp_cur.y;
+    return true;
+}
+
+bool touch_gt9xx_read_first(touch_handle_t t, uint16_t *x, uint16_t *y)
+{
+    touch_handle_t_ *h = (touch_handle_t_ *)t;
+    if (!h) return false;
+    TRACE_SCOPE("touch_read");
+
+    uint16_t px = 0, py = 0;
+    const bool pressed = h->replay ? read_first_replay(h, &px, &py)
+                                   : read_first_i2c(h, &px, &py);
+    if (h->recording) record_sample(h, pressed, px, py);
+    if (!pressed) return false;
+
+    if (x) *x = px;
+    if (y) *y = py;
+    return true;
+}
+
+uint64_t touch_gt9xx_last_sample_us(touch_handle_t t)
+{
+    touch_handle_t_ *h = (touch_handle_t_ *)t;
+    return h ? h->last_sample_us : 0;
+}
+
+esp_err_t touch_gt9xx_record_start(touch_handle_t t, uint8_t *buf, size_t cap)
+{
+    touch_handle_t_ *h = (touch_handle_t_ *)t;
+    ESP_RETURN_ON_FALSE(h && buf, ESP_ERR_INVALID_ARG, TAG, "null arg");
+    ESP_RETURN_ON_ERROR(touch_capture_writer_init(&h->rec, buf, cap), TAG, "capture buffer");
+    h->rec_t0      = (uint64_t)esp_timer_get_time();
+    h->rec_pressed = false;
+    h->recording   = true;
+    return ESP_OK;
+}
+
+size_t touch_gt9xx_record_stop(touch_handle_t t)
+{
+    touch_handle_t_ *h = (touch_handle_t_ *)t;
+    if (!h || !h->recording) return 0;
+    h->recording = false;
+    if (h->rec.overflow) ESP_LOGW(TAG, "capture buffer full; later samples dropped");
+    return touch_capture_finish(&h->rec);
+}
+
+esp_err_t touch_gt9xx_open_replay(const uint8_t *data, size_t len, touch_handle_t *out)
+{
+    ESP_RETURN_ON_FALSE(data && out, ESP_ERR_INVALID_ARG, TAG, "null arg");
+
+    touch_handle_t_ *h = mem_calloc(MEM_TAG_TOUCH, 1, sizeof(*h), MALLOC_CAP_DEFAULT);
+    ESP_RETURN_ON_FALSE(h, ESP_ERR_NO_MEM, TAG, "alloc handle failed");
+
+    esp_err_t err = touch_capture_reader_init(&h->rp, data, len);
+    if (err != ESP_OK) {
+        mem_free(MEM_TAG_TOUCH, h);
+        ESP_LOGE(TAG, "bad capture: %s", esp_err_to_name(err));
+        return err;
+    }
+    h->replay       = true;
+    h->rp_have_next = touch_capture_next(&h->rp, &h->rp_next);
+
+    *out = (touch_handle_t)h;
+    return ESP_OK;
+}
+
+bool touch_gt9xx_replay_done(touch_handle_t t)
+{
+    touch_handle_t_ *h = (touch_handle_t_ *)t;
+    return h && h->replay && h->rp_done;
+}
+
 esp_err_t touch_gt9xx_dump_info(touch_handle_t t, char pid[4], uint16_t *fwver,
                                 uint16_t *xmax, uint16_t *ymax)
 {
     touch_handle_t_ *h = (touch_handle_t_ *)t;
     ESP_RETURN_ON_FALSE(h, ESP_ERR_INVALID_ARG, TAG, "null handle");
+    ESP_RETURN_ON_FALSE(h->dev, ESP_ERR_NOT_SUPPORTED, TAG, "replay handle");
 
     char lpid[4] = {0}; uint8_t fw[2] = {0}; uint8_t xy[4] = {0};
     ESP_RETURN_ON_ERROR(gt_reg_read(h->dev, GT_REG_PID,   lpid, sizeof(lpid)), TAG, "pid");
@@ -160,6 +315,33 @@ esp_err_t touch_gt9xx_dump_info(touch_handle_t t, char pid[4], uint16_t *fwver,
     return ESP_OK;
 }
 
+esp_err_t touch_gt9xx_configure(touch_handle_t t, const gt911_config_patch_t *patch, bool *changed)
+{
+    touch_handle_t_ *h = (touch_handle_t_ *)t;
+    ESP_RETURN_ON_FALSE(h && patch, ESP_ERR_INVALID_ARG, TAG, "null arg");
+    ESP_RETURN_ON_FALSE(h->dev, ESP_ERR_NOT_SUPPORTED, TAG, "replay handle");
+    if (changed) *changed = false;
+
+    const gt911_regio_t io = { .read = gt_io_read, .write = gt_io_write, .ctx = h->dev };
+
+    gt911_config_t cfg;
+    ESP_RETURN_ON_ERROR(gt911_config_read(&io, &cfg), TAG, "cfg read");
+    ESP_RETURN_ON_ERROR(gt911_config_apply_patch(&cfg, patch), TAG, "cfg patch");
+
+    bool written = false;
+    ESP_RETURN_ON_ERROR(gt911_config_write_if_changed(&io, &cfg, &written), TAG, "cfg write");
+    if (written) {
+        // Controller reloads the block after Config_Fresh; give it time before polling.
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+
+    ESP_LOGI(TAG, "GT911 cfg v0x%02X: refresh=%d ms points=%d (%s)",
+             cfg.raw[GT911_CFG_OFF_VERSION], gt911_config_refresh_ms(&cfg),
+             gt911_config_max_points(&cfg), written ? "updated" : "unchanged");
+    if (changed) *changed = written;
+    return ESP_OK;
+}
+
 void touch_gt9xx_deinit(touch_handle_t t)
 {
     touch_handle_t_ *h = (touch_handle_t_ *)t;
@@ -168,5 +350,5 @@ void touch_gt9xx_deinit(touch_handle_t t)
     if (h->dev)       (void)i2c_master_bus_rm_device(h->dev);
     if (h->bus_outer) (void)i2c_bus_delete(h->bus_outer);
     memset(h, 0, sizeof(*h));
-    free(h);
+    mem_free(MEM_TAG_TOUCH, h);
 }
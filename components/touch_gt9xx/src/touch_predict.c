@@ -0,0 +1,117 @@
+#include "touch_gt9xx/touch_predict.h"
+
+#include <math.h>
+#include <string.h>
+
+void touch_predict_init(touch_predict_t *p, const touch_predict_cfg_t *cfg)
+{
+    if (!p) return;
+    memset(p, 0, sizeof(*p));
+    if (cfg) {
+        p->cfg = *cfg;
+    } else {
+        p->cfg = (touch_predict_cfg_t)TOUCH_PREDICT_CFG_DEFAULT();
+    }
+}
+
+void touch_predict_release(touch_predict_t *p)
+{
+    if (!p) return;
+    p->active  = false;
+    p->pending = false;
+}
+
+/* Score an outstanding prediction once a sample brackets its target time. */
+static void score_pending(touch_predict_t *p, float mx, float my, uint64_t t_us)
+{
+    if (!p->pending || t_us < p->pend_t_us) return;
+
+    /* Actual position at the target: interpolate between the bracketing samples. */
+    float ax = mx, ay = my;
+    const uint64_t span = t_us - p->t_last_us;
+    if (span > 0 && p->pend_t_us > p->t_last_us) {
+        const float f = (float)(p->pend_t_us - p->t_last_us) / (float)span;
+        ax = p->raw_x + (mx - p->raw_x) * f;
+        ay = p->raw_y + (my - p->raw_y) * f;
+    }
+
+    const float err = hypotf(p->pend_x - ax, p->pend_y - ay);
+    touch_predict_stats_t *s = &p->stats;
+    s->scored++;
+    s->last_err_px = err;
+    if (err > s->max_err_px) s->max_err_px = err;
+    p->err_sum += err;
+    s->mean_err_px = (float)(p->err_sum / s->scored);
+    p->pending = false;
+}
+
+void touch_predict_update(touch_predict_t *p, uint16_t x, uint16_t y, uint64_t t_us)
+{
+    if (!p) return;
+    const float mx = (float)x, my = (float)y;
+    p->stats.samples++;
+
+    if (!p->active || t_us <= p->t_last_us ||
+        (t_us - p->t_last_us) > p->cfg.reset_gap_us) {
+        p->active  = true;
+        p->pending = false;
+        p->x = mx;  p->y = my;
+        p->vx = 0;  p->vy = 0;
+        p->raw_x = mx; p->raw_y = my;
+        p->t_last_us = t_us;
+        return;
+    }
+
+    score_pending(p, mx, my, t_us);
+
+    const float dt = (float)(t_us - p->t_last_us);
+    const float px = p->x + p->vx * dt;
+    const float py = p->y + p->vy * dt;
+    float rx = mx - px;
+    float ry = my - py;
+
+    /* Jitter suppression: small residuals on a resting finger are noise, not motion. */
+    if (fabsf(rx) < p->cfg.jitter_px && fabsf(ry) < p->cfg.jitter_px) {
+        rx *= 0.25f;
+        ry *= 0.25f;
+        p->vx *= 0.5f;
+        p->vy *= 0.5f;
+    }
+
+    p->x  = px + p->cfg.alpha * rx;
+    p->y  = py + p->cfg.alpha * ry;
+    p->vx += p->cfg.beta * rx / dt;
+    p->vy += p->cfg.beta * ry / dt;
+
+    p->raw_x = mx; p->raw_y = my;
+    p->t_last_us = t_us;
+}
+
+bool touch_predict_at(touch_predict_t *p, uint64_t target_us, int *x, int *y)
+{
+    if (!p || !p->active) return false;
+
+    uint64_t ahead = (target_us > p->t_last_us) ? (target_us - p->t_last_us) : 0;
+    if (ahead > p->cfg.max_horizon_us) ahead = p->cfg.max_horizon_us;
+
+    float fx = p->x + p->vx * (float)ahead;
+    float fy = p->y + p->vy * (float)ahead;
+    if (fx < 0) fx = 0;
+    if (fy < 0) fy = 0;
+
+    /* Remember the latest query so the next real sample can grade it. */
+    p->pending   = true;
+    p->pend_t_us = p->t_last_us + ahead;
+    p->pend_x    = fx;
+    p->pend_y    = fy;
+
+    if (x) *x = (int)lroundf(fx);
+    if (y) *y = (int)lroundf(fy);
+    return true;
+}
+
+void touch_predict_get_stats(const touch_predict_t *p, touch_predict_stats_t *out)
+{
+    if (!p || !out) return;
+    *out = p->stats;
+}
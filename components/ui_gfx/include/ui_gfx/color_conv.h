@@ -0,0 +1,79 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * 24/32-bit → RGB565 conversion with optional dithering.
+ *
+ * Ordered modes index their threshold matrix by absolute position (x, y), so
+ * bands or tiles converted separately (decoder MCU rows, partial redraws)
+ * join without seams. RGB888 is bytes R,G,B in memory; ARGB8888 is a native
+ * uint32_t 0xAARRGGBB, alpha ignored. With CONFIG_UI_GFX_COLOR_PIE (ESP32-P4,
+ * experimental, off by default) the ordered rows run on the PIE vector unit
+ * instead of the portable loop.
+ */
+typedef enum {
+    UI_DITHER_NONE = 0,     // round to nearest
+    UI_DITHER_BAYER4,       // 4×4 ordered
+    UI_DITHER_BAYER8,       // 8×8 ordered
+    UI_DITHER_DIFFUSION,    // serpentine Floyd–Steinberg; rows must go top to bottom
+} ui_dither_t;
+
+/* Pack 8-bit channels, rounding to nearest. */
+static inline uint16_t ui_rgb565(uint8_t r, uint8_t g, uint8_t b)
+{
+    const uint32_t r5 = ((uint32_t)r * 31u + 127u) / 255u;
+    const uint32_t g6 = ((uint32_t)g * 63u + 127u) / 255u;
+    const uint32_t b5 = ((uint32_t)b * 31u + 127u) / 255u;
+    return (uint16_t)((r5 << 11) | (g6 << 5) | b5);
+}
+
+/*
+ * Convert one row of n pixels whose first pixel sits at (x, y).
+ * Ordered modes only; UI_DITHER_DIFFUSION is treated as BAYER8 here (use
+ * ui_diffuse_* for streamed diffusion).
+ */
+void ui_rgb888_row_to_565(uint16_t *dst, const uint8_t *rgb, int n, int x, int y, ui_dither_t mode);
+void ui_argb8888_row_to_565(uint16_t *dst, const uint32_t *argb, int n, int x, int y, ui_dither_t mode);
+
+/*
+ * Convert a w×h image into dst (stride in pixels). src_stride is in bytes for
+ * RGB888 and in pixels for ARGB8888. Ordered modes are split across cores for
+ * large images. Returns false only if diffusion scratch can't be allocated.
+ */
+bool ui_rgb888_to_565(uint16_t *dst, int dst_stride, const uint8_t *src, int src_stride,
+                      int w, int h, ui_dither_t mode);
+bool ui_argb8888_to_565(uint16_t *dst, int dst_stride, const uint32_t *src, int src_stride,
+                        int w, int h, ui_dither_t mode);
+
+/*
+ * Streamed error diffusion for producers that emit rows in order (decoders,
+ * offline conversion). Carries two error rows of w pixels between calls.
+ */
+typedef struct {
+    int      w;
+    int      row;           // rows converted so far (sets the scan direction)
+    int16_t *cur, *next;    // (w + 2) × 3 channel errors each
+} ui_diffuse_t;
+
+bool ui_diffuse_begin(ui_diffuse_t *s, int w);
+void ui_diffuse_rgb888_row(ui_diffuse_t *s, uint16_t *dst, const uint8_t *rgb);
+void ui_diffuse_argb8888_row(ui_diffuse_t *s, uint16_t *dst, const uint32_t *argb);
+void ui_diffuse_end(ui_diffuse_t *s);
+
+/*
+ * Linear gradient from rgb_from to rgb_to (0xRRGGBB) over rect [x0..x1] ×
+ * [y0..y1] (inclusive, clipped; the ramp spans the unclipped rect), top to
+ * bottom when vertical, else left to right. The ramp is interpolated at
+ * 8.8 precision before quantizing. UI_DITHER_DIFFUSION is treated as BAYER8.
+ */
+void ui_gradient_fill565(uint16_t *fb, int w, int h, int x0, int y0, int x1, int y1,
+                         uint32_t rgb_from, uint32_t rgb_to, bool vertical, ui_dither_t mode);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
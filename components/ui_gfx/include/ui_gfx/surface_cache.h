@@ -0,0 +1,73 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Render-to-texture cache: off-screen RGB565 surfaces keyed by (widget id, state).
+ * A miss hands back an allocated surface for the caller to render once; later
+ * hits are a single blit. Bounded by entry count and by two byte budgets:
+ * small surfaces use internal RAM while it has room, everything else lives in
+ * PSRAM. Least-recently-used surfaces are evicted only when neither pool can
+ * take a new one.
+ */
+
+/** Off-screen surface (stride == w). */
+typedef struct {
+    uint16_t *px;
+    int       w, h;
+} ui_surface_t;
+
+typedef struct {
+    size_t internal_budget;       // bytes of internal RAM the cache may hold
+    size_t psram_budget;          // bytes of PSRAM the cache may hold
+    size_t internal_max_surface;  // surfaces larger than this go straight to PSRAM
+    int    max_entries;
+} ui_surface_cache_cfg_t;
+
+#define UI_SURFACE_CACHE_CFG_DEFAULT() { .internal_budget = 64 * 1024,          \
+                                         .psram_budget = 4 * 1024 * 1024,       \
+                                         .internal_max_surface = 16 * 1024,     \
+                                         .max_entries = 64 }
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t alloc_failures;
+    int      entries;
+    size_t   internal_bytes, internal_peak;
+    size_t   psram_bytes,    psram_peak;
+} ui_surface_cache_stats_t;
+
+/** Opaque cache handle. */
+typedef struct ui_surface_cache_t_* ui_surface_cache_t;
+
+/** Create a cache (cfg NULL for defaults). Returns NULL on allocation failure. */
+ui_surface_cache_t ui_surface_cache_create(const ui_surface_cache_cfg_t *cfg);
+void ui_surface_cache_destroy(ui_surface_cache_t c);
+
+/**
+ * Find the w×h surface for (id, state). On a miss one is allocated (evicting
+ * as needed) and *fresh is set: the caller must render it before use.
+ * The pointer stays valid until the next get/invalidate/clear on this cache.
+ * @return NULL if the surface cannot be placed within budget.
+ */
+const ui_surface_t *ui_surface_cache_get(ui_surface_cache_t c, uint32_t id, uint32_t state,
+                                         int w, int h, bool *fresh);
+
+/** Drop every state of one widget (e.g. its label changed). */
+void ui_surface_cache_invalidate(ui_surface_cache_t c, uint32_t id);
+
+/** Drop everything (e.g. layout changed). */
+void ui_surface_cache_clear(ui_surface_cache_t c);
+
+void ui_surface_cache_get_stats(ui_surface_cache_t c, ui_surface_cache_stats_t *out);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -19,6 +19,9 @@ void ui_draw_vline565(uint16_t *fb, int w, int h, int x, int y0, int y1, uint16_
 /* Fill rectangle [x0..x1] × [y0..y1], inclusive, with clipping. */
 void ui_fill_rect565(uint16_t *fb, int w, int h, int x0, int y0, int x1, int y1, uint16_t rgb565);
 
+/* Copy an sw×sh RGB565 image (stride sw) to (x,y), with clipping. */
+void ui_blit565(uint16_t *fb, int w, int h, int x, int y, const uint16_t *src, int sw, int sh);
+
 /* Draw one 5×7 character at (x,y). If bg==UI_GFX_BG_TRANSPARENT, background is preserved. */
 void ui_draw_char5x7(uint16_t *fb, int w, int h, int x, int y, char c, uint16_t fg, uint32_t bg);
 
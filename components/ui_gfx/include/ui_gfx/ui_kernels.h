@@ -0,0 +1,40 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Whole-buffer kernels (RGB565, stride w). Large calls are split across cores
+ * like ui_fill_rect565(). Pattern fill and copy are row memcpys already; only
+ * clear has a CONFIG_UI_GFX_FIXED_GEOMETRY variant.
+ */
+
+/*
+ * Fill the whole w×h buffer with one color. With CONFIG_UI_GFX_FIXED_GEOMETRY,
+ * a w×h matching the configured panel and a word-aligned fb take an unrolled
+ * word loop; anything else takes the generic loop.
+ */
+void ui_clear565(uint16_t *fb, int w, int h, uint16_t rgb565);
+
+/*
+ * Tile the whole buffer with a tw×th pattern (stride tw), anchored at (0,0);
+ * the last column of tiles is cut at w (checkerboards, or a row template
+ * with th == 1 and tw == w).
+ */
+void ui_pattern_fill565(uint16_t *fb, int w, int h, const uint16_t *tile, int tw, int th);
+
+/* Copy rect [x0..x1] × [y0..y1] (inclusive, clipped) between two w×h buffers. */
+void ui_copy_rect565(uint16_t *dst, const uint16_t *src, int w, int h, int x0, int y0, int x1, int y1);
+
+/* True when this build has a fixed-geometry clear for w×h. */
+bool ui_kernels_fixed_for(int w, int h);
+
+/* Benchmarks: force the generic path (false) or allow specialization (true, default). */
+void ui_kernels_set_specialized(bool on);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,414 @@
+#include "ui_gfx/color_conv.h"
+
+#include <stddef.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
+#include "util/jobs.h"
+#include "util/mem.h"
+
+/* Calls at least this large are split across cores. */
+#ifndef UI_COLOR_PARALLEL_MIN_PX
+#define UI_COLOR_PARALLEL_MIN_PX (64 * 1024)
+#endif
+
+/* Ordered rows on the ESP32-P4 vector unit (color_conv_pie.S); opt-in, 0 = portable loop only. */
+#ifndef UI_COLOR_PIE
+#if CONFIG_UI_GFX_COLOR_PIE
+#define UI_COLOR_PIE 1
+#else
+#define UI_COLOR_PIE 0
+#endif
+#endif
+
+/* PIE: pixels split into channel lanes per call of the vector body (multiple of 8). */
+#ifndef UI_COLOR_PIE_CHUNK
+#define UI_COLOR_PIE_CHUNK 64
+#endif
+_Static_assert(UI_COLOR_PIE_CHUNK > 0 && UI_COLOR_PIE_CHUNK % 8 == 0, "UI_COLOR_PIE_CHUNK: multiple of 8");
+
+/* Byte offsets of R, G, B inside a native 0xAARRGGBB word. */
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define ARGB_R 2
+#define ARGB_G 1
+#define ARGB_B 0
+#else
+#define ARGB_R 1
+#define ARGB_G 2
+#define ARGB_B 3
+#endif
+
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+
+/*
+ * Threshold matrices, row-major: (2·bayer + 1)·255 / (2·N²), in [0, 255).
+ * Each averages ~127, the plain rounding offset, so dithering adds no bias.
+ */
+static const uint8_t kBayer4[16] = {
+      7, 135,  39, 167,
+    199,  71, 231, 103,
+     55, 183,  23, 151,
+    247, 119, 215,  87,
+};
+
+static const uint8_t kBayer8[64] = {
+      1, 129,  33, 161,   9, 137,  41, 169,
+    193,  65, 225,  97, 201,  73, 233, 105,
+     49, 177,  17, 145,  57, 185,  25, 153,
+    241, 113, 209,  81, 249, 121, 217,  89,
+     13, 141,  45, 173,   5, 133,  37, 165,
+    205,  77, 237, 109, 197,  69, 229, 101,
+     61, 189,  29, 157,  53, 181,  21, 149,
+    253, 125, 221,  93, 245, 117, 213,  85,
+};
+
+static const uint8_t kRound[1] = { 127 };
+
+typedef struct {
+    const uint8_t *t;
+    int            mask;   // matrix side - 1
+} thresh_t;
+
+static inline thresh_t thresholds(ui_dither_t mode)
+{
+    switch (mode) {
+    case UI_DITHER_NONE:   return (thresh_t){ kRound, 0 };
+    case UI_DITHER_BAYER4: return (thresh_t){ kBayer4, 3 };
+    default:               return (thresh_t){ kBayer8, 7 };
+    }
+}
+
+static inline const uint8_t *thresh_row(thresh_t th, int y)
+{
+    return th.t + (y & th.mask) * (th.mask + 1);
+}
+
+/* floor(v / 255) for v < 65535 without a divide. */
+static ALWAYS_INLINE uint32_t div255(uint32_t v)
+{
+    return (v + 1u + (v >> 8)) >> 8;
+}
+
+/* floor((c·L + t) / 255) per channel: t = 127 rounds, a threshold in [0, 255) dithers. */
+static ALWAYS_INLINE uint16_t quant565(uint32_t r, uint32_t g, uint32_t b, uint32_t t)
+{
+    return (uint16_t)((div255(r * 31u + t) << 11) | (div255(g * 63u + t) << 5) | div255(b * 31u + t));
+}
+
+/*
+ * Ordered row: branch-free, one table load per pixel. bpp and the channel
+ * offsets are constants at every call site, so each format gets its own loop.
+ */
+static ALWAYS_INLINE void ordered_row_scalar(uint16_t *restrict dst, const uint8_t *restrict p, int n,
+                                             int bpp, int ro, int go, int bo,
+                                             const uint8_t *restrict trow, int mask, int x)
+{
+    for (int i = 0; i < n; ++i, p += bpp) {
+        dst[i] = quant565(p[ro], p[go], p[bo], trow[(x + i) & mask]);
+    }
+}
+
+#if UI_COLOR_PIE
+void ui_color_quant565_pie(uint16_t *dst, const uint16_t *r, const uint16_t *g, const uint16_t *b,
+                           const uint16_t *t1, int blocks);
+
+/*
+ * PIE: scalar up to a 16-byte aligned dst, then chunks split into u16 channel
+ * lanes for the vector body (8 px per register), then a scalar tail. The
+ * threshold lanes are the same for every block since the matrix side divides 8.
+ */
+static ALWAYS_INLINE void ordered_row(uint16_t *restrict dst, const uint8_t *restrict p, int n,
+                                      int bpp, int ro, int go, int bo,
+                                      const uint8_t *restrict trow, int mask, int x)
+{
+    const int head = (int)((16u - ((uintptr_t)dst & 15u)) & 15u) / 2;
+    if (((uintptr_t)dst & 1u) || n - head < 8) {
+        ordered_row_scalar(dst, p, n, bpp, ro, go, bo, trow, mask, x);
+        return;
+    }
+    ordered_row_scalar(dst, p, head, bpp, ro, go, bo, trow, mask, x);
+
+    uint16_t t1[8] __attribute__((aligned(16)));
+    uint16_t r[UI_COLOR_PIE_CHUNK] __attribute__((aligned(16)));
+    uint16_t g[UI_COLOR_PIE_CHUNK] __attribute__((aligned(16)));
+    uint16_t b[UI_COLOR_PIE_CHUNK] __attribute__((aligned(16)));
+    for (int k = 0; k < 8; ++k) t1[k] = (uint16_t)(trow[(x + head + k) & mask] + 1u);
+
+    int i = head;
+    for (const int end = head + ((n - head) & ~7); i < end;) {
+        const int m = (end - i < UI_COLOR_PIE_CHUNK) ? end - i : UI_COLOR_PIE_CHUNK;
+        const uint8_t *q = p + (size_t)i * bpp;
+        for (int k = 0; k < m; ++k, q += bpp) {
+            r[k] = q[ro];
+            g[k] = q[go];
+            b[k] = q[bo];
+        }
+        ui_color_quant565_pie(dst + i, r, g, b, t1, m / 8);
+        i += m;
+    }
+    ordered_row_scalar(dst + i, p + (size_t)i * bpp, n - i, bpp, ro, go, bo, trow, mask, x + i);
+}
+#else
+static ALWAYS_INLINE void ordered_row(uint16_t *restrict dst, const uint8_t *restrict p, int n,
+                                      int bpp, int ro, int go, int bo,
+                                      const uint8_t *restrict trow, int mask, int x)
+{
+    ordered_row_scalar(dst, p, n, bpp, ro, go, bo, trow, mask, x);
+}
+#endif
+
+void ui_rgb888_row_to_565(uint16_t *dst, const uint8_t *rgb, int n, int x, int y, ui_dither_t mode)
+{
+    if (!dst || !rgb || n <= 0) return;
+    const thresh_t th = thresholds(mode);
+    ordered_row(dst, rgb, n, 3, 0, 1, 2, thresh_row(th, y), th.mask, x);
+}
+
+void ui_argb8888_row_to_565(uint16_t *dst, const uint32_t *argb, int n, int x, int y, ui_dither_t mode)
+{
+    if (!dst || !argb || n <= 0) return;
+    const thresh_t th = thresholds(mode);
+    ordered_row(dst, (const uint8_t *)argb, n, 4, ARGB_R, ARGB_G, ARGB_B, thresh_row(th, y), th.mask, x);
+}
+
+/* ---- error diffusion ---- */
+
+bool ui_diffuse_begin(ui_diffuse_t *s, int w)
+{
+    if (!s || w <= 0) return false;
+    const size_t n = (size_t)(w + 2) * 3;
+    int16_t *e = mem_calloc(MEM_TAG_UI_GFX, 2 * n, sizeof(int16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!e) return false;
+    *s = (ui_diffuse_t){ .w = w, .cur = e, .next = e + n };
+    return true;
+}
+
+void ui_diffuse_end(ui_diffuse_t *s)
+{
+    if (!s) return;
+    if (s->cur) mem_free(MEM_TAG_UI_GFX, s->cur < s->next ? s->cur : s->next);  // rows swap each call
+    *s = (ui_diffuse_t){0};
+}
+
+/* Quantize v (0..255) to `bits`, return the level; *err gets v minus its 8-bit expansion. */
+static ALWAYS_INLINE uint32_t diffuse_q(int v, int bits, int *err)
+{
+    const uint32_t L = (1u << bits) - 1u;
+    const uint32_t q = div255((uint32_t)v * L + 127u);
+    const int back = (int)((q << (8 - bits)) | (q >> (2 * bits - 8)));
+    *err = v - back;
+    return q;
+}
+
+/*
+ * Floyd–Steinberg (7/16 ahead, 3/16 5/16 1/16 below), serpentine: odd rows run
+ * right to left so errors don't drift one way. Errors are kept in 1/16 units
+ * in two rows with one guard pixel on each side.
+ */
+static ALWAYS_INLINE void diffuse_row(ui_diffuse_t *s, uint16_t *dst, const uint8_t *p,
+                                      int bpp, int ro, int go, int bo)
+{
+    const int w   = s->w;
+    const int dir = (s->row & 1) ? -1 : 1;
+    const int d3  = dir * 3;
+    int16_t *cur = s->cur + 3, *nxt = s->next + 3;
+    memset(s->next, 0, (size_t)(w + 2) * 3 * sizeof(int16_t));
+
+    int x = (dir > 0) ? 0 : w - 1;
+    for (int i = 0; i < w; ++i, x += dir) {
+        const uint8_t *px = p + (size_t)x * bpp;
+        int16_t *e = cur + x * 3, *en = nxt + x * 3;
+        const int off[3] = { ro, go, bo }, bits[3] = { 5, 6, 5 };
+        uint32_t out = 0;
+        for (int c = 0; c < 3; ++c) {
+            int v = px[off[c]] + ((e[c] + 8) >> 4);
+            v = v < 0 ? 0 : v > 255 ? 255 : v;
+            int err;
+            out = (out << bits[c]) | diffuse_q(v, bits[c], &err);
+            e[d3 + c]  += (int16_t)(err * 7);
+            en[c - d3] += (int16_t)(err * 3);
+            en[c]      += (int16_t)(err * 5);
+            en[c + d3] += (int16_t)err;
+        }
+        dst[x] = (uint16_t)out;
+    }
+
+    int16_t *t = s->cur;
+    s->cur  = s->next;
+    s->next = t;
+    s->row++;
+}
+
+void ui_diffuse_rgb888_row(ui_diffuse_t *s, uint16_t *dst, const uint8_t *rgb)
+{
+    if (!s || !s->cur || !dst || !rgb) return;
+    diffuse_row(s, dst, rgb, 3, 0, 1, 2);
+}
+
+void ui_diffuse_argb8888_row(ui_diffuse_t *s, uint16_t *dst, const uint32_t *argb)
+{
+    if (!s || !s->cur || !dst || !argb) return;
+    diffuse_row(s, dst, (const uint8_t *)argb, 4, ARGB_R, ARGB_G, ARGB_B);
+}
+
+/* ---- whole images ---- */
+
+typedef struct {
+    uint16_t      *dst;
+    const uint8_t *src;
+    int            dst_stride;  // pixels
+    int            src_stride;  // bytes
+    int            w;
+    bool           argb;
+    thresh_t       th;
+} cjob_t;
+
+static void convert_rows(int y0, int y1, void *arg)
+{
+    const cjob_t *j = (const cjob_t *)arg;
+    for (int y = y0; y < y1; ++y) {
+        uint16_t      *d = j->dst + (size_t)y * j->dst_stride;
+        const uint8_t *s = j->src + (size_t)y * j->src_stride;
+        if (j->argb) {
+            ordered_row(d, s, j->w, 4, ARGB_R, ARGB_G, ARGB_B, thresh_row(j->th, y), j->th.mask, 0);
+        } else {
+            ordered_row(d, s, j->w, 3, 0, 1, 2, thresh_row(j->th, y), j->th.mask, 0);
+        }
+    }
+}
+
+static bool convert(uint16_t *dst, int dst_stride, const uint8_t *src, int src_stride_bytes,
+                    int w, int h, bool argb, ui_dither_t mode)
+{
+    if (!dst || !src || w <= 0 || h <= 0) return true;
+
+    if (mode == UI_DITHER_DIFFUSION) {
+        ui_diffuse_t s;
+        if (!ui_diffuse_begin(&s, w)) return false;
+        for (int y = 0; y < h; ++y) {
+            uint16_t      *d = dst + (size_t)y * dst_stride;
+            const uint8_t *p = src + (size_t)y * src_stride_bytes;
+            if (argb) diffuse_row(&s, d, p, 4, ARGB_R, ARGB_G, ARGB_B);
+            else      diffuse_row(&s, d, p, 3, 0, 1, 2);
+        }
+        ui_diffuse_end(&s);
+        return true;
+    }
+
+    cjob_t j = { .dst = dst, .src = src, .dst_stride = dst_stride, .src_stride = src_stride_bytes,
+                 .w = w, .argb = argb, .th = thresholds(mode) };
+    if ((long)w * h >= UI_COLOR_PARALLEL_MIN_PX) {
+        parallel_for_rows(0, h, 0, convert_rows, &j);
+    } else {
+        convert_rows(0, h, &j);
+    }
+    return true;
+}
+
+bool ui_rgb888_to_565(uint16_t *dst, int dst_stride, const uint8_t *src, int src_stride,
+                      int w, int h, ui_dither_t mode)
+{
+    return convert(dst, dst_stride, src, src_stride, w, h, false, mode);
+}
+
+bool ui_argb8888_to_565(uint16_t *dst, int dst_stride, const uint32_t *src, int src_stride,
+                        int w, int h, ui_dither_t mode)
+{
+    return convert(dst, dst_stride, (const uint8_t *)src, src_stride * 4, w, h, true, mode);
+}
+
+/* ---- gradients ---- */
+
+typedef struct {
+    uint16_t *fb;
+    int       w;
+    int       x0, x1;          // clipped columns
+    int       r0, len;         // ramp origin and length along its axis (unclipped)
+    int32_t   from[3], delta[3];
+    bool      vertical;
+    thresh_t  th;
+} gjob_t;
+
+/* Ramp position i quantized against threshold t: 8.8 channel values, one divide each. */
+static uint16_t ramp_px(const gjob_t *j, int i, uint32_t t)
+{
+    static const uint32_t L[3] = { 31, 63, 31 };
+    static const int bits[3]   = { 5, 6, 5 };
+    const uint32_t t16 = t * 256u + 128u;
+    uint32_t out = 0;
+    for (int c = 0; c < 3; ++c) {
+        const int32_t v = j->from[c] * 256 + (j->len > 1 ? j->delta[c] * 256 * i / (j->len - 1) : 0);
+        out = (out << bits[c]) | (((uint32_t)v * L[c] + t16) / (255u * 256u));
+    }
+    return (uint16_t)out;
+}
+
+/* Vertical: each row is one dither period repeated; doubling copies keep its phase. */
+static void vgrad_rows(int y0, int y1, void *arg)
+{
+    const gjob_t *j = (const gjob_t *)arg;
+    const int span = j->x1 - j->x0 + 1, m = j->th.mask;
+    for (int y = y0; y < y1; ++y) {
+        const uint8_t *trow = thresh_row(j->th, y);
+        uint16_t period[8];
+        for (int k = 0; k <= m; ++k) period[k] = ramp_px(j, y - j->r0, trow[k]);
+
+        uint16_t *row = j->fb + (size_t)y * j->w + j->x0;
+        const int head = (span < m + 1) ? span : m + 1;
+        for (int k = 0; k < head; ++k) row[k] = period[(j->x0 + k) & m];
+        for (int n = head; n < span; n *= 2) {
+            const int c = (n <= span - n) ? n : span - n;
+            memcpy(row + n, row, (size_t)c * sizeof(uint16_t));
+        }
+    }
+}
+
+/* Horizontal: the first period of rows in the band is computed, later rows copy it. */
+static void hgrad_rows(int y0, int y1, void *arg)
+{
+    const gjob_t *j = (const gjob_t *)arg;
+    const int span = j->x1 - j->x0 + 1, m = j->th.mask;
+    for (int y = y0; y < y1 && y <= y0 + m; ++y) {
+        const uint8_t *trow = thresh_row(j->th, y);
+        uint16_t *row = j->fb + (size_t)y * j->w;
+        for (int x = j->x0; x <= j->x1; ++x) row[x] = ramp_px(j, x - j->r0, trow[x & m]);
+    }
+    for (int y = y0 + m + 1; y < y1; ++y) {
+        uint16_t *row = j->fb + (size_t)y * j->w + j->x0;
+        memcpy(row, row - (size_t)(m + 1) * j->w, (size_t)span * sizeof(uint16_t));
+    }
+}
+
+void ui_gradient_fill565(uint16_t *fb, int w, int h, int x0, int y0, int x1, int y1,
+                         uint32_t rgb_from, uint32_t rgb_to, bool vertical, ui_dither_t mode)
+{
+    if (!fb || w <= 0 || h <= 0) return;
+    if (x0 > x1) { const int t = x0; x0 = x1; x1 = t; }
+    if (y0 > y1) { const int t = y0; y0 = y1; y1 = t; }
+
+    gjob_t j = {
+        .fb = fb, .w = w, .vertical = vertical, .th = thresholds(mode),
+        .r0  = vertical ? y0 : x0,
+        .len = vertical ? y1 - y0 + 1 : x1 - x0 + 1,
+    };
+    for (int c = 0; c < 3; ++c) {
+        const int sh = 16 - 8 * c;
+        j.from[c]  = (int32_t)((rgb_from >> sh) & 0xFF);
+        j.delta[c] = (int32_t)((rgb_to >> sh) & 0xFF) - j.from[c];
+    }
+
+    if (x1 < 0 || y1 < 0 || x0 >= w || y0 >= h) return;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= w) x1 = w - 1;
+    if (y1 >= h) y1 = h - 1;
+    j.x0 = x0;
+    j.x1 = x1;
+
+    const jobs_rows_fn_t fn = vertical ? vgrad_rows : hgrad_rows;
+    if ((long)(x1 - x0 + 1) * (y1 - y0 + 1) >= UI_COLOR_PARALLEL_MIN_PX) {
+        parallel_for_rows(y0, y1 + 1, 0, fn, &j);
+    } else {
+        fn(y0, y1 + 1, &j);
+    }
+}
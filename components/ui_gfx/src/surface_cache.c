@@ -0,0 +1,190 @@
+#include "ui_gfx/surface_cache.h"
+
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "util/mem.h"
+
+typedef struct {
+    ui_surface_t surf;
+    uint32_t     id, state;
+    uint32_t     last_used;   // LRU clock
+    size_t       bytes;
+    bool         used;
+    bool         internal;
+} entry_t;
+
+typedef struct ui_surface_cache_t_ {
+    ui_surface_cache_cfg_t   cfg;
+    entry_t                 *entries;
+    uint32_t                 clock;
+    ui_surface_cache_stats_t st;
+} ui_surface_cache_t_;
+
+ui_surface_cache_t ui_surface_cache_create(const ui_surface_cache_cfg_t *cfg)
+{
+    ui_surface_cache_t_ *c = mem_calloc(MEM_TAG_UI_GFX, 1, sizeof(*c), MALLOC_CAP_DEFAULT);
+    if (!c) return NULL;
+    c->cfg = cfg ? *cfg : (ui_surface_cache_cfg_t)UI_SURFACE_CACHE_CFG_DEFAULT();
+    if (c->cfg.max_entries <= 0) c->cfg.max_entries = 1;
+
+    c->entries = mem_calloc(MEM_TAG_UI_GFX, (size_t)c->cfg.max_entries, sizeof(entry_t), MALLOC_CAP_DEFAULT);
+    if (!c->entries) {
+        mem_free(MEM_TAG_UI_GFX, c);
+        return NULL;
+    }
+    return (ui_surface_cache_t)c;
+}
+
+static void release(ui_surface_cache_t_ *c, entry_t *e)
+{
+    if (!e->used) return;
+    if (e->internal) c->st.internal_bytes -= e->bytes;
+    else             c->st.psram_bytes    -= e->bytes;
+    mem_free(MEM_TAG_UI_GFX, e->surf.px);
+    memset(e, 0, sizeof(*e));
+    c->st.entries--;
+}
+
+void ui_surface_cache_destroy(ui_surface_cache_t h)
+{
+    ui_surface_cache_t_ *c = (ui_surface_cache_t_ *)h;
+    if (!c) return;
+    ui_surface_cache_clear(h);
+    mem_free(MEM_TAG_UI_GFX, c->entries);
+    mem_free(MEM_TAG_UI_GFX, c);
+}
+
+/* Least-recently-used live entry, optionally restricted to one pool (-1 = any). */
+static entry_t *lru(ui_surface_cache_t_ *c, int internal)
+{
+    entry_t *best = NULL;
+    for (int i = 0; i < c->cfg.max_entries; ++i) {
+        entry_t *e = &c->entries[i];
+        if (!e->used) continue;
+        if (internal >= 0 && e->internal != (bool)internal) continue;
+        if (!best || (int32_t)(e->last_used - best->last_used) < 0) best = e;
+    }
+    return best;
+}
+
+static void evict(ui_surface_cache_t_ *c, entry_t *e)
+{
+    release(c, e);
+    c->st.evictions++;
+}
+
+/* Make room for 'bytes' in one pool; false if the pool can never hold it. */
+static bool make_room(ui_surface_cache_t_ *c, bool internal, size_t bytes)
+{
+    const size_t budget = internal ? c->cfg.internal_budget : c->cfg.psram_budget;
+    if (bytes > budget) return false;
+    for (;;) {
+        const size_t in_use = internal ? c->st.internal_bytes : c->st.psram_bytes;
+        if (in_use + bytes <= budget) return true;
+        entry_t *victim = lru(c, internal);
+        if (!victim) return false;
+        evict(c, victim);
+    }
+}
+
+static entry_t *free_slot(ui_surface_cache_t_ *c)
+{
+    for (int i = 0; i < c->cfg.max_entries; ++i) {
+        if (!c->entries[i].used) return &c->entries[i];
+    }
+    entry_t *victim = lru(c, -1);
+    if (victim) evict(c, victim);
+    return victim;
+}
+
+const ui_surface_t *ui_surface_cache_get(ui_surface_cache_t h, uint32_t id, uint32_t state,
+                                         int w, int h_px, bool *fresh)
+{
+    ui_surface_cache_t_ *c = (ui_surface_cache_t_ *)h;
+    if (fresh) *fresh = false;
+    if (!c || w <= 0 || h_px <= 0) return NULL;
+
+    const uint32_t now = ++c->clock;
+    for (int i = 0; i < c->cfg.max_entries; ++i) {
+        entry_t *e = &c->entries[i];
+        if (!e->used || e->id != id || e->state != state) continue;
+        if (e->surf.w == w && e->surf.h == h_px) {
+            e->last_used = now;
+            c->st.hits++;
+            return &e->surf;
+        }
+        release(c, e);  // geometry changed: stale
+        break;
+    }
+    c->st.misses++;
+
+    const size_t bytes = (size_t)w * (size_t)h_px * sizeof(uint16_t);
+    entry_t *slot = free_slot(c);
+    if (!slot) return NULL;
+
+    /* Small surfaces take free internal RAM, then PSRAM; internal entries are
+     * only evicted for them when PSRAM can't take the surface either. */
+    uint16_t *px = NULL;
+    bool internal = false;
+    const bool small = bytes <= c->cfg.internal_max_surface;
+    if (small && c->st.internal_bytes + bytes <= c->cfg.internal_budget) {
+        px = mem_try_malloc(MEM_TAG_UI_GFX, bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        internal = (px != NULL);
+    }
+    if (!px && make_room(c, false, bytes)) {
+        px = mem_try_malloc(MEM_TAG_UI_GFX, bytes, MALLOC_CAP_SPIRAM);
+    }
+    if (!px && small && make_room(c, true, bytes)) {
+        px = mem_try_malloc(MEM_TAG_UI_GFX, bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        internal = (px != NULL);
+    }
+    if (!px) {
+        c->st.alloc_failures++;
+        return NULL;
+    }
+
+    *slot = (entry_t){
+        .surf      = { .px = px, .w = w, .h = h_px },
+        .id        = id,
+        .state     = state,
+        .last_used = now,
+        .bytes     = bytes,
+        .used      = true,
+        .internal  = internal,
+    };
+    c->st.entries++;
+    if (internal) {
+        c->st.internal_bytes += bytes;
+        if (c->st.internal_bytes > c->st.internal_peak) c->st.internal_peak = c->st.internal_bytes;
+    } else {
+        c->st.psram_bytes += bytes;
+        if (c->st.psram_bytes > c->st.psram_peak) c->st.psram_peak = c->st.psram_bytes;
+    }
+
+    if (fresh) *fresh = true;
+    return &slot->surf;
+}
+
+void ui_surface_cache_invalidate(ui_surface_cache_t h, uint32_t id)
+{
+    ui_surface_cache_t_ *c = (ui_surface_cache_t_ *)h;
+    if (!c) return;
+    for (int i = 0; i < c->cfg.max_entries; ++i) {
+        if (c->entries[i].used && c->entries[i].id == id) release(c, &c->entries[i]);
+    }
+}
+
+void ui_surface_cache_clear(ui_surface_cache_t h)
+{
+    ui_surface_cache_t_ *c = (ui_surface_cache_t_ *)h;
+    if (!c) return;
+    for (int i = 0; i < c->cfg.max_entries; ++i) release(c, &c->entries[i]);
+}
+
+void ui_surface_cache_get_stats(ui_surface_cache_t h, ui_surface_cache_stats_t *out)
+{
+    ui_surface_cache_t_ *c = (ui_surface_cache_t_ *)h;
+    if (!out) return;
+    if (!c) { memset(out, 0, sizeof(*out)); return; }
+    *out = c->st;
+}
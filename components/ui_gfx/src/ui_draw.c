@@ -1,7 +1,14 @@
 #include "ui_gfx/ui_draw.h"
 #include "ui_gfx/font5x7.h"
+#include "ui_gfx/ui_kernels.h"
+#include "util/jobs.h"
 #include <string.h>
 
+/* Fills at least this large are split across cores. */
+#ifndef UI_FILL_PARALLEL_MIN_PX
+#define UI_FILL_PARALLEL_MIN_PX (64 * 1024)
+#endif
+
 static inline void swap_int(int *a, int *b) { int t=*a; *a=*b; *b=t; }
 
 void ui_put_pixel565(uint16_t *fb, int w, int h, int x, int y, uint16_t rgb565)
@@ -34,6 +41,21 @@ void ui_draw_vline565(uint16_t *fb, int w, int h, int x, int y0, int y1, uint16_
     for (int y = y0; y <= y1; ++y) { *p = rgb565; p += w; }
 }
 
+typedef struct {
+    uint16_t *fb;
+    int       w, x0, span;
+    uint16_t  c;
+} fill_job_t;
+
+static void fill_rows(int y0, int y1, void *arg)
+{
+    const fill_job_t *j = (const fill_job_t *)arg;
+    for (int y = y0; y < y1; ++y) {
+        uint16_t *row = &j->fb[y * j->w + j->x0];
+        for (int i = 0; i < j->span; ++i) row[i] = j->c;
+    }
+}
+
 void ui_fill_rect565(uint16_t *fb, int w, int h, int x0, int y0, int x1, int y1, uint16_t rgb565)
 {
     if (x0 > x1) swap_int(&x0, &x1);
@@ -43,10 +65,30 @@ void ui_fill_rect565(uint16_t *fb, int w, int h, int x0, int y0, int x1, int y1,
     if (y0 < 0) y0 = 0;
     if (x1 >= w) x1 = w - 1;
     if (y1 >= h) y1 = h - 1;
-    const int span = x1 - x0 + 1;
-    for (int y = y0; y <= y1; ++y) {
-        uint16_t *row = &fb[y * w + x0];
-        for (int i = 0; i < span; ++i) row[i] = rgb565;
+    if (x0 == 0 && y0 == 0 && x1 == w - 1 && y1 == h - 1) {
+        ui_clear565(fb, w, h, rgb565);  // whole buffer: fixed-geometry kernel when built
+        return;
+    }
+    fill_job_t job = { .fb = fb, .w = w, .x0 = x0, .span = x1 - x0 + 1, .c = rgb565 };
+    if (job.span * (y1 - y0 + 1) >= UI_FILL_PARALLEL_MIN_PX) {
+        parallel_for_rows(y0, y1 + 1, 0, fill_rows, &job);
+    } else {
+        fill_rows(y0, y1 + 1, &job);
+    }
+}
+
+void ui_blit565(uint16_t *fb, int w, int h, int x, int y, const uint16_t *src, int sw, int sh)
+{
+    if (!fb || !src || sw <= 0 || sh <= 0) return;
+    int sx0 = 0, sy0 = 0;
+    int dx0 = x, dy0 = y;
+    if (dx0 < 0) { sx0 = -dx0; dx0 = 0; }
+    if (dy0 < 0) { sy0 = -dy0; dy0 = 0; }
+    const int cw = ((x + sw > w) ? w - x : sw) - sx0;
+    const int ch = ((y + sh > h) ? h - y : sh) - sy0;
+    if (cw <= 0 || ch <= 0) return;
+    for (int r = 0; r < ch; ++r) {
+        memcpy(&fb[(dy0 + r) * w + dx0], &src[(sy0 + r) * sw + sx0], (size_t)cw * sizeof(uint16_t));
     }
 }
 
@@ -0,0 +1,155 @@
+#include "ui_gfx/ui_kernels.h"
+
+#include <stddef.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "util/jobs.h"
+
+/* Calls at least this large are split across cores. */
+#ifndef UI_KERNELS_PARALLEL_MIN_PX
+#define UI_KERNELS_PARALLEL_MIN_PX (64 * 1024)
+#endif
+
+#if CONFIG_UI_GFX_FIXED_GEOMETRY
+#define FIXED_W CONFIG_UI_GFX_FIXED_W
+#define FIXED_H CONFIG_UI_GFX_FIXED_H
+_Static_assert((FIXED_W & 1) == 0, "CONFIG_UI_GFX_FIXED_W must be even");
+#define UNROLL _Pragma("GCC unroll 16")
+#endif
+
+static bool s_specialized = true;
+
+typedef struct {
+    uint16_t       *dst;
+    const uint16_t *src;       // copy source, or pattern tile
+    int             w;
+    int             x0, span;  // copy
+    int             tw, th;    // pattern
+    uint16_t        c;         // clear
+    bool            fixed;     // clear: fixed-geometry loop
+} kjob_t;
+
+static inline bool aligned4(const void *p)
+{
+    return ((uintptr_t)p & 3u) == 0;
+}
+
+bool ui_kernels_fixed_for(int w, int h)
+{
+#if CONFIG_UI_GFX_FIXED_GEOMETRY
+    return w == FIXED_W && h == FIXED_H;
+#else
+    return false;
+#endif
+}
+
+void ui_kernels_set_specialized(bool on)
+{
+    s_specialized = on;
+}
+
+static inline bool use_fixed(int w, int h, const void *p)
+{
+    return s_specialized && ui_kernels_fixed_for(w, h) && aligned4(p);
+}
+
+static void run(int h, int px_per_row, jobs_rows_fn_t fn, kjob_t *j)
+{
+    if ((long)px_per_row * h >= UI_KERNELS_PARALLEL_MIN_PX) {
+        parallel_for_rows(0, h, 0, fn, j);
+    } else {
+        fn(0, h, j);
+    }
+}
+
+/* ---- clear ---- */
+static void clear_rows(int y0, int y1, void *arg)
+{
+    const kjob_t *j = (const kjob_t *)arg;
+#if CONFIG_UI_GFX_FIXED_GEOMETRY
+    if (j->fixed) {
+        const uint32_t c2 = j->c | ((uint32_t)j->c << 16);
+        for (int y = y0; y < y1; ++y) {
+            uint32_t *row = (uint32_t *)(j->dst + (size_t)y * FIXED_W);
+            UNROLL
+            for (int i = 0; i < FIXED_W / 2; ++i) row[i] = c2;
+        }
+        return;
+    }
+#endif
+    for (int y = y0; y < y1; ++y) {
+        uint16_t *row = j->dst + (size_t)y * j->w;
+        for (int x = 0; x < j->w; ++x) row[x] = j->c;
+    }
+}
+
+void ui_clear565(uint16_t *fb, int w, int h, uint16_t rgb565)
+{
+    if (!fb || w <= 0 || h <= 0) return;
+    kjob_t j = { .dst = fb, .w = w, .c = rgb565, .fixed = use_fixed(w, h, fb) };
+    run(h, w, clear_rows, &j);
+}
+
+/* ---- pattern fill ---- */
+
+/* Build one row from the tile: one tile copy, then doubling copies within the row. */
+static inline void pattern_row(uint16_t *row, int w, const uint16_t *tile_row, int tw)
+{
+    if (tw > w) tw = w;
+    memcpy(row, tile_row, (size_t)tw * sizeof(uint16_t));
+    for (int n = tw; n < w; n *= 2) {
+        const int k = (n <= w - n) ? n : w - n;
+        memcpy(row + n, row, (size_t)k * sizeof(uint16_t));
+    }
+}
+
+/* First th rows of the band come from the tile; later rows repeat the row th above. */
+static void pattern_rows(int y0, int y1, void *arg)
+{
+    const kjob_t *j = (const kjob_t *)arg;
+    const int w = j->w, th = j->th;
+    for (int y = y0; y < y1 && y < y0 + th; ++y) {
+        pattern_row(j->dst + (size_t)y * w, w, j->src + (size_t)(y % th) * j->tw, j->tw);
+    }
+    for (int y = y0 + th; y < y1; ++y) {
+        uint16_t *row = j->dst + (size_t)y * w;
+        memcpy(row, row - (size_t)th * w, (size_t)w * sizeof(uint16_t));
+    }
+}
+
+void ui_pattern_fill565(uint16_t *fb, int w, int h, const uint16_t *tile, int tw, int th)
+{
+    if (!fb || !tile || w <= 0 || h <= 0 || tw <= 0 || th <= 0) return;
+    kjob_t j = { .dst = fb, .src = tile, .w = w, .tw = tw, .th = th };
+    run(h, w, pattern_rows, &j);
+}
+
+/* ---- rect copy ---- */
+static void copy_rows(int y0, int y1, void *arg)
+{
+    const kjob_t *j = (const kjob_t *)arg;
+    for (int y = y0; y < y1; ++y) {
+        const size_t o = (size_t)y * j->w + (size_t)j->x0;
+        memcpy(j->dst + o, j->src + o, (size_t)j->span * sizeof(uint16_t));
+    }
+}
+
+void ui_copy_rect565(uint16_t *dst, const uint16_t *src, int w, int h, int x0, int y0, int x1, int y1)
+{
+    if (!dst || !src || dst == src) return;
+    if (x0 > x1) { const int t = x0; x0 = x1; x1 = t; }
+    if (y0 > y1) { const int t = y0; y0 = y1; y1 = t; }
+    if (x1 < 0 || y1 < 0 || x0 >= w || y0 >= h) return;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= w) x1 = w - 1;
+    if (y1 >= h) y1 = h - 1;
+
+    kjob_t j = { .dst = dst, .src = src, .w = w, .x0 = x0, .span = x1 - x0 + 1 };
+    const int rows = y1 - y0 + 1;
+    if ((long)j.span * rows >= UI_KERNELS_PARALLEL_MIN_PX) {
+        parallel_for_rows(y0, y1 + 1, 0, copy_rows, &j);
+    } else {
+        copy_rows(y0, y1 + 1, &j);
+    }
+}
@@ -3,22 +3,51 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "display_panel/display.h"
 #include "touch_gt9xx/touch_gt9xx.h"
+#include "ui_gfx/surface_cache.h"
 
-/** Draw the 2×2 top-level menu into fb (RGB565, size w*h). */
+/**
+ * Draw the launcher grid (registered entries, two columns, top of the list)
+ * into fb (RGB565, size w*h). Registers the built-in demos if nothing is.
+ */
 void menu_draw(display_handle_t d, uint16_t *fb);
 
 /**
- * Blocking interaction loop:
- *  - wait for touch
- *  - highlight tile
- *  - run demo
- *  - redraw menu
+ * Lay out the grid for a W×H panel and pre-render the tiles visible at the
+ * top into the tile cache. Needs no display, so boot can run it while the
+ * panel is still coming up; the first menu_draw() then only blits.
+ */
+void menu_prewarm(int W, int H);
+
+/**
+ * Interaction loop: a single frame-paced scheduler driving an explicit
+ * state machine (quiet → idle → pressed → demo, plus drag/fling scrolling
+ * when the grid is taller than the screen). Each tick reads one touch sample
+ * and advances the state; demos are stepped once per frame and a touch
+ * cancels them. Scrolling block-shifts the framebuffer and renders only the
+ * newly exposed rows. Never blocks beyond one frame.
+ * Returns only when t is a replay source that has played out.
  */
 void menu_loop(display_handle_t d, uint16_t *fb, touch_handle_t t);
 
+/**
+ * Per-event timing sink. event is a static name ("menu", "press", "highlight",
+ * "unhighlight", "cancel"); render_us covers drawing into fb, present_us the
+ * display_draw_bitmap() call. Pass NULL to remove.
+ */
+typedef void (*menu_event_cb_t)(const char *event, uint32_t render_us, uint32_t present_us, void *arg);
+void menu_set_event_hook(menu_event_cb_t cb, void *arg);
+
+/** Hit rate and memory of the pre-rendered tile cache. */
+void menu_get_tile_cache_stats(ui_surface_cache_stats_t *out);
+
+/** Tile geometry at scroll 0, for scripted input (false if off-screen). */
+int  menu_tile_count(void);
+bool menu_tile_center(display_handle_t d, int index, int *x, int *y);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
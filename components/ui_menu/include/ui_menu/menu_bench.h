@@ -0,0 +1,25 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "display_panel/display.h"
+
+/**
+ * Deterministic UI latency benchmark.
+ * Replays canned touch sessions (tap each tile and cancel its demo,
+ * drag-cancel, rapid double taps, drag/flick scrolling) through menu_loop()
+ * and logs render/present time per menu event, plus a per-session summary
+ * with the achieved scroll rate against the panel refresh. Needs no touch
+ * hardware.
+ *
+ * @return ESP_ERR_INVALID_STATE if a session that never drags past the slop
+ *         (tap, drag-cancel, double tap) produced scroll frames.
+ */
+esp_err_t menu_bench_run(display_handle_t d, uint16_t *fb);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
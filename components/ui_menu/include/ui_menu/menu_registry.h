@@ -0,0 +1,43 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "demos/demos.h"
+
+/* Registry capacity (entries beyond this are rejected). */
+#ifndef MENU_REGISTRY_MAX
+#define MENU_REGISTRY_MAX 64
+#endif
+
+/**
+ * Optional icon painter: draw into the size×size box at (x,y).
+ * fb/w/h follow ui_gfx conventions (clipped, RGB565, stride = w).
+ */
+typedef void (*menu_icon_fn)(uint16_t *fb, int w, int h, int x, int y, int size);
+
+/** One launchable grid entry. */
+typedef struct {
+    const char        *name;       // tile label
+    uint16_t           accent;     // icon swatch colour when no draw_icon (0 = none)
+    menu_icon_fn       draw_icon;  // optional
+    const demo_desc_t *demo;       // entry callbacks (start/step/stop)
+    int                seconds;    // run time handed to demo_begin()
+} menu_entry_t;
+
+/**
+ * Add an entry (copied). Order of registration is grid order.
+ * @return index, or -1 if the registry is full.
+ */
+int menu_register(const menu_entry_t *e);
+
+/** Register the built-in demos (no-op once anything is registered). */
+void menu_register_defaults(void);
+
+int                 menu_entry_count(void);
+const menu_entry_t *menu_entry_at(int index);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
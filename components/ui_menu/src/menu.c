@@ -1,18 +1,32 @@
 #include "ui_menu/menu.h"
+#include "ui_menu/menu_registry.h"
 
+#include <math.h>
+#include <stdlib.h>
 #include <string.h>
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
-#include "esp_timer.h"
 #include "esp_log.h"
 
 #include "ui_gfx/ui_draw.h"
+#include "ui_gfx/ui_kernels.h"
+#include "ui_gfx/surface_cache.h"
 #include "display_panel/display.h"
 #include "touch_gt9xx/touch_gt9xx.h"
+#include "touch_gt9xx/touch_predict.h"
 #include "demos/demos.h"
 #include "util/timing.h"
+#include "util/trace.h"
 
-// static const char *TAG = "menu";
+static const char *TAG = "menu";
+
+/* Scroll inside the panel's two scanout buffers (one flip per step) when the panel has them. */
+#ifndef MENU_PANEL_SCROLL
+#define MENU_PANEL_SCROLL 1
+#endif
+
+/* Drive drag feedback from the predicted contact at expected display time. */
+#ifndef MENU_TOUCH_PREDICT
+#define MENU_TOUCH_PREDICT 1
+#endif
 
 /* --- Colors (RGB565) --- */
 #define RGB565(r,g,b)   (uint16_t)((((r)&0x1F)<<11) | (((g)&0x3F)<<5) | ((b)&0x1F))
@@ -23,30 +37,127 @@
 #define C_TEXT          RGB565(0x1F,0x3F,0x1F)
 #define C_CROSS         RGB565(0x1F,0x00,0x00)
 
+/* Scheduler tick while the menu itself is in charge (demos may ask for their own). */
+#ifndef MENU_FRAME_US
+#define MENU_FRAME_US 16667
+#endif
+
+/* Grid rows that fit on one screen; 2 reproduces the original 2×2 layout. */
+#ifndef MENU_ROWS_VISIBLE
+#define MENU_ROWS_VISIBLE 2
+#endif
+
+/* Quiet time required before a new press is accepted. */
+#define MENU_QUIET_AFTER_CANCEL_US  60000
+#define MENU_QUIET_AFTER_DEMO_US    80000
+/* A demo ignores touches this soon after launch (the accepting finger may still bounce). */
+#define MENU_DEMO_ARM_US           150000
+
+/* Scrolling: vertical travel that turns a press into a drag, and fling tuning. */
+#define MENU_DRAG_SLOP_PX           12
+#define MENU_FLING_MIN_PX_S         300.0f
+#define MENU_FLING_STOP_PX_S        30.0f
+#define MENU_FLING_DECAY_PER_S      3.0f    // v *= exp(-decay * dt)
+
 typedef struct {
     int x0,y0,x1,y1;
     const char *label;
 } tile_t;
 
+/* Grid geometry in content space; screen y = content y - scroll. */
+typedef struct {
+    int W, H;
+    int gutter, colw, rowh, pitch;
+    int view_y0, view_y1;   // scrollable rows (inside the frame border)
+    int count, rows;
+    int max_scroll;
+} grid_t;
+
 static inline int clampi(int v, int lo, int hi) { return v<lo?lo:(v>hi?hi:v); }
 static inline int inside(int x,int y,const tile_t* r) { return (x>=r->x0 && x<=r->x1 && y>=r->y0 && y<=r->y1); }
 
-/* Layout scales with display size (portrait). */
-static void build_tiles(display_handle_t d, tile_t out[4])
+/* Running estimate of a full present (µs); tells the predictor how far ahead to look. */
+static uint32_t s_present_est_us = 20000;
+
+/*
+ * Pre-rendered tile faces (icon + label) keyed by (entry index, highlight). Only
+ * the face is cached: the tile body is a plain fill that is cheaper to redraw
+ * than to copy, so a toggle is a fill plus one small blit.
+ */
+static ui_surface_cache_t s_tile_cache;
+static int                s_tile_cache_count = -1;   // registry size the cache was built for
+static int                s_tile_cache_colw, s_tile_cache_rowh;
+
+/* Optional per-event timing sink (benchmarks). An event = render since ev_begin() + present. */
+static menu_event_cb_t s_ev_cb;
+static void           *s_ev_arg;
+static uint64_t        s_ev_t0;
+
+void menu_set_event_hook(menu_event_cb_t cb, void *arg)
 {
-    const int W = display_width(d);
-    const int H = display_height(d);
+    s_ev_cb  = cb;
+    s_ev_arg = arg;
+}
 
-    const int gutter = (W < 480) ? 8 : 16;
-    const int colw   = (W - gutter*3) / 2;
-    const int rowh   = (H - gutter*3) / 2;
+static inline void ev_begin(void) { s_ev_t0 = timing_now_us(); }
 
-    // Row 0
-    out[0] = (tile_t){ .x0=gutter, .y0=gutter, .x1=gutter+colw, .y1=gutter+rowh, .label="Color Bars" };
-    out[1] = (tile_t){ .x0=gutter*2+colw, .y0=gutter, .x1=gutter*2+colw*2, .y1=gutter+rowh, .label="Gradient" };
-    // Row 1
-    out[2] = (tile_t){ .x0=gutter, .y0=gutter*2+rowh, .x1=gutter+colw, .y1=gutter*2+rowh*2, .label="Bounce 5s" };
-    out[3] = (tile_t){ .x0=gutter*2+colw, .y0=gutter*2+rowh, .x1=gutter*2+colw*2, .y1=gutter*2+rowh*2, .label="Sleep/Wake" };
+static void present_full(display_handle_t d, uint16_t *fb, int W, int H, const char *event)
+{
+    const uint64_t t0 = timing_now_us();
+    (void)display_draw_bitmap(d, 0, 0, W, H, fb);
+    const uint64_t t1 = timing_now_us();
+    const uint32_t dt = (uint32_t)(t1 - t0);
+    s_present_est_us = (s_present_est_us * 7 + dt) / 8;
+
+    if (s_ev_cb) s_ev_cb(event, (uint32_t)(t0 - s_ev_t0), dt, s_ev_arg);
+}
+
+static void tile_cache_build(const grid_t *g);
+
+/* Layout scales with display size (portrait): two columns, fixed row pitch. */
+static void grid_layout(grid_t *g, int W, int H)
+{
+    menu_register_defaults();
+
+    g->W       = W;
+    g->H       = H;
+    g->gutter  = (W < 480) ? 8 : 16;
+    g->colw    = (W - g->gutter*3) / 2;
+    g->rowh    = (H - g->gutter*(MENU_ROWS_VISIBLE + 1)) / MENU_ROWS_VISIBLE;
+    g->pitch   = g->rowh + g->gutter;
+    g->view_y0 = 1;
+    g->view_y1 = H - 2;
+    g->count   = menu_entry_count();
+    g->rows    = (g->count + 1) / 2;
+
+    const int content_h = g->gutter + g->rows * g->pitch;
+    g->max_scroll = (content_h > H) ? content_h - H : 0;
+
+    if (!s_tile_cache || s_tile_cache_count != g->count ||
+        s_tile_cache_colw != g->colw || s_tile_cache_rowh != g->rowh) {
+        tile_cache_build(g);   // indices may now name other entries
+    }
+}
+
+/* Screen-space rect of entry i at the given scroll. */
+static tile_t grid_tile(const grid_t *g, int i, int scroll)
+{
+    const int col = i & 1, row = i >> 1;
+    const int x0  = g->gutter + col * (g->gutter + g->colw);
+    const int y0  = g->gutter + row * g->pitch - scroll;
+    const menu_entry_t *e = menu_entry_at(i);
+    return (tile_t){ .x0 = x0, .y0 = y0, .x1 = x0 + g->colw, .y1 = y0 + g->rowh,
+                     .label = e ? e->name : "" };
+}
+
+static int grid_hit(const grid_t *g, int scroll, int x, int y)
+{
+    if (y < g->view_y0 || y > g->view_y1) return -1;
+    for (int i = 0; i < g->count; ++i) {
+        const tile_t t = grid_tile(g, i, scroll);
+        if (inside(x, y, &t)) return i;
+    }
+    return -1;
 }
 
 static void draw_frame(uint16_t *fb, int W,int H)
@@ -58,186 +169,633 @@ static void draw_frame(uint16_t *fb, int W,int H)
     ui_draw_vline565(fb, W,H, W-1,   0, H-1, C_FRAME);
 }
 
-static void draw_tile(uint16_t *fb, int W,int H, const tile_t* t, bool highlight)
+/* Tile fill and inner border. */
+static void draw_body(uint16_t *fb, int W,int H, const tile_t* t, bool highlight)
 {
     const uint16_t fill = highlight ? C_TILE_HI : C_TILE;
     ui_fill_rect565(fb, W,H, t->x0, t->y0, t->x1, t->y1, fill);
 
-    // inner border
     ui_draw_hline565(fb, W,H, t->x0, t->x1, t->y0, C_FRAME);
     ui_draw_hline565(fb, W,H, t->x0, t->x1, t->y1, C_FRAME);
     ui_draw_vline565(fb, W,H, t->x0, t->y0, t->y1, C_FRAME);
     ui_draw_vline565(fb, W,H, t->x1, t->y0, t->y1, C_FRAME);
+}
+
+/* Where the centered label and the icon above it go inside tile t. */
+typedef struct {
+    int lx, ly;            // label origin
+    int ix, iy, isize;     // icon box
+} face_geom_t;
 
-    // centered label
+static face_geom_t face_geom(const tile_t *t)
+{
     const int text_w = (int)strlen(t->label) * (5 + 1);
     const int text_h = 7;
-    const int cx = (t->x0 + t->x1) / 2;
-    const int cy = (t->y0 + t->y1) / 2;
-    const int x  = clampi(cx - text_w/2, t->x0+4, t->x1-4);
-    const int y  = clampi(cy - text_h/2, t->y0+4, t->y1-4);
-    (void)ui_draw_text5x7(fb, W,H, x, y, t->label, C_TEXT, UI_GFX_BG_TRANSPARENT);
+    const int cx = t->x0 + (t->x1 - t->x0) / 2;   // offset-invariant (tiles scroll off the top)
+    const int cy = t->y0 + (t->y1 - t->y0) / 2;
+    face_geom_t f;
+    f.lx    = clampi(cx - text_w/2, t->x0+4, t->x1-4);
+    f.ly    = clampi(cy - text_h/2, t->y0+4, t->y1-4);
+    f.isize = clampi((t->x1 - t->x0) / 6, 8, 64);
+    f.ix    = cx - f.isize / 2;
+    f.iy    = cy - f.isize - 12;
+    return f;
 }
 
-void menu_draw(display_handle_t d, uint16_t *fb)
+/* Bounding box of the face (label + icon), clipped to the tile interior. */
+static tile_t face_box(const tile_t *t)
+{
+    const face_geom_t f = face_geom(t);
+    const int text_w = (int)strlen(t->label) * (5 + 1);
+    tile_t b = {
+        .x0 = f.ix < f.lx ? f.ix : f.lx,
+        .y0 = f.iy,
+        .x1 = (f.ix + f.isize > f.lx + text_w ? f.ix + f.isize : f.lx + text_w) - 1,
+        .y1 = f.ly + 7 - 1,
+        .label = t->label,
+    };
+    b.x0 = clampi(b.x0, t->x0 + 1, t->x1 - 1);
+    b.x1 = clampi(b.x1, t->x0 + 1, t->x1 - 1);
+    b.y0 = clampi(b.y0, t->y0 + 1, t->y1 - 1);
+    b.y1 = clampi(b.y1, t->y0 + 1, t->y1 - 1);
+    return b;
+}
+
+/* Label plus icon (custom painter, or an accent swatch above the label). */
+static void draw_face(uint16_t *fb, int W, int H, const tile_t *t, const menu_entry_t *e)
 {
-    const int W = display_width(d);
-    const int H = display_height(d);
+    const face_geom_t f = face_geom(t);
+    (void)ui_draw_text5x7(fb, W,H, f.lx, f.ly, t->label, C_TEXT, UI_GFX_BG_TRANSPARENT);
+    if (!e) return;
+    if (e->draw_icon) {
+        e->draw_icon(fb, W, H, f.ix, f.iy, f.isize);
+    } else if (e->accent) {
+        ui_fill_rect565(fb, W, H, f.ix, f.iy, f.ix + f.isize - 1, f.iy + f.isize - 1, e->accent);
+    }
+}
 
-    tile_t tiles[4];
-    build_tiles(d, tiles);
+static void draw_entry(uint16_t *fb, int W, int H, const tile_t *t, const menu_entry_t *e, bool highlight)
+{
+    draw_body(fb, W, H, t, highlight);
+    draw_face(fb, W, H, t, e);
+}
 
-    draw_frame(fb, W,H);
-    for (int i = 0; i < 4; ++i) draw_tile(fb, W,H, &tiles[i], false);
+/* Off-screen face for tile i, rendered on first use; NULL if it doesn't fit the cache. */
+static const ui_surface_t *tile_surface(const tile_t *t, int i, bool highlight)
+{
+    const tile_t b = face_box(t);
+    const int fw = b.x1 - b.x0 + 1;
+    const int fh = b.y1 - b.y0 + 1;
+
+    bool fresh = false;
+    const ui_surface_t *s = ui_surface_cache_get(s_tile_cache, (uint32_t)i, highlight ? 1 : 0,
+                                                 fw, fh, &fresh);
+    if (s && fresh) {
+        /* The tile in face-local coordinates: same geometry, clipped to the face. */
+        const tile_t local = { .x0 = t->x0 - b.x0, .y0 = t->y0 - b.y0,
+                               .x1 = t->x1 - b.x0, .y1 = t->y1 - b.y0, .label = t->label };
+        ui_fill_rect565(s->px, fw, fh, 0, 0, fw - 1, fh - 1, highlight ? C_TILE_HI : C_TILE);
+        draw_face(s->px, fw, fh, &local, menu_entry_at(i));
+    }
+    return s;
 }
 
-/* Wait for a press (simple polling with timeout) */
-static bool wait_for_touch_first(touch_handle_t t, uint16_t *x, uint16_t *y, uint32_t timeout_ms)
+/* Cached variant: fill the body, then blit the face rendered once off-screen. */
+static void draw_entry_cached(uint16_t *fb, int W, int H, const tile_t *t, int i, bool highlight)
 {
-    const uint64_t t0 = esp_timer_get_time();
-    while (((esp_timer_get_time() - t0) / 1000ULL) < timeout_ms) {
-        if (touch_gt9xx_read_first(t, x, y)) return true;
-        vTaskDelay(pdMS_TO_TICKS(10));
+    const ui_surface_t *s = tile_surface(t, i, highlight);
+    if (!s) {
+        draw_entry(fb, W, H, t, menu_entry_at(i), highlight);
+        return;
     }
-    return false;
+    draw_body(fb, W, H, t, highlight);
+    const tile_t b = face_box(t);
+    ui_blit565(fb, W, H, b.x0, b.y0, s->px, s->w, s->h);
 }
 
-/* Drain touches until we observe 'quiet_ms' with no presses. */
-static void touch_drain_until_quiet(touch_handle_t t, uint32_t quiet_ms)
+/* Size the cache to the registry: both states of every face, nothing evicted. */
+static void tile_cache_build(const grid_t *g)
 {
-    // ESP_LOGI(TAG, "drain: waiting for %u ms quiet", (unsigned)quiet_ms);
-    uint32_t stable_ms = 0;
-    uint64_t last = esp_timer_get_time();
-    while (stable_ms < quiet_ms) {
-        uint16_t x, y;
-        bool pressed = touch_gt9xx_read_first(t, &x, &y);
-        vTaskDelay(pdMS_TO_TICKS(10));
-        uint64_t now = esp_timer_get_time();
-        uint32_t dt  = (uint32_t)((now - last)/1000ULL);
-        last = now;
+    ui_surface_cache_cfg_t cfg = UI_SURFACE_CACHE_CFG_DEFAULT();
+    size_t bytes = 0;
+    for (int i = 0; i < g->count; ++i) {
+        const tile_t b = face_box(&(tile_t){ .x0 = 0, .y0 = 0, .x1 = g->colw, .y1 = g->rowh,
+                                             .label = menu_entry_at(i) ? menu_entry_at(i)->name : "" });
+        bytes += 2 * (size_t)(b.x1 - b.x0 + 1) * (size_t)(b.y1 - b.y0 + 1) * sizeof(uint16_t);
+    }
+    cfg.psram_budget = bytes;
+    cfg.max_entries  = 2 * g->count;
+
+    ui_surface_cache_destroy(s_tile_cache);
+    s_tile_cache       = ui_surface_cache_create(&cfg);
+    s_tile_cache_count = g->count;
+    s_tile_cache_colw  = g->colw;
+    s_tile_cache_rowh  = g->rowh;
+    ESP_LOGI(TAG, "tile cache: %d faces, %u B", g->count, (unsigned)bytes);
+}
 
-        if (pressed) {
-            if (dt > 50) dt = 50;
-            stable_ms = 0;
-        } else {
-            if (dt > 50) dt = 50;
-            stable_ms += dt;
+/*
+ * Render screen rows [y0..y1] (inside the viewport) at the given scroll.
+ * Drawing goes through a band view of fb so ui_gfx clipping keeps it inside.
+ */
+static void render_rows(const grid_t *g, uint16_t *fb, int scroll, int y0, int y1, int hi)
+{
+    const int W  = g->W;
+    const int bh = y1 - y0 + 1;
+    if (bh <= 0) return;
+    uint16_t *band = fb + (size_t)y0 * W;
+
+    ui_fill_rect565(band, W, bh, 0, 0, W-1, bh-1, C_BG);
+    ui_draw_vline565(band, W, bh, 0,   0, bh-1, C_FRAME);
+    ui_draw_vline565(band, W, bh, W-1, 0, bh-1, C_FRAME);
+
+    const int first_row = clampi((y0 + scroll - g->gutter) / g->pitch, 0, g->rows);
+    for (int r = first_row; r < g->rows; ++r) {
+        if (g->gutter + r * g->pitch - scroll > y1) break;
+        for (int i = r * 2; i < r * 2 + 2 && i < g->count; ++i) {
+            tile_t t = grid_tile(g, i, scroll);
+            t.y0 -= y0;
+            t.y1 -= y0;
+            draw_entry_cached(band, W, bh, &t, i, i == hi);
         }
     }
-    // ESP_LOGI(TAG, "drain: quiet");
 }
 
-/* Accept only if:
- *  - we never left the tile while pressed, and
- *  - release occurred with the last in-bounds position inside.
+static void render_full(const grid_t *g, uint16_t *fb, int scroll)
+{
+    draw_frame(fb, g->W, g->H);
+    render_rows(g, fb, scroll, g->view_y0, g->view_y1, -1);
+}
+
+/* Redraw one tile, clipped to the viewport. */
+static void render_tile(const grid_t *g, uint16_t *fb, int scroll, int i, bool highlight)
+{
+    const int vh = g->view_y1 - g->view_y0 + 1;
+    tile_t t = grid_tile(g, i, scroll);
+    t.y0 -= g->view_y0;
+    t.y1 -= g->view_y0;
+    draw_entry_cached(fb + (size_t)g->view_y0 * g->W, g->W, vh, &t, i, highlight);
+}
+
+/*
+ * Block-scroll the viewport to new_scroll: shift the rows that stay visible
+ * and render only the newly exposed band. Returns true if anything moved.
  */
-static bool confirm_release_inside(display_handle_t d, uint16_t *fb,
-                                   const tile_t *tile, touch_handle_t t,
-                                   uint16_t start_x, uint16_t start_y)
+static bool scroll_blit(const grid_t *g, uint16_t *fb, int *scroll, int new_scroll)
 {
-    const int W = display_width(d);
-    const int H = display_height(d);
+    new_scroll = clampi(new_scroll, 0, g->max_scroll);
+    const int dy = new_scroll - *scroll;
+    if (dy == 0) return false;
+
+    const int    W   = g->W;
+    const int    vh  = g->view_y1 - g->view_y0 + 1;
+    const int    ady = abs(dy);
+    uint16_t    *top = fb + (size_t)g->view_y0 * W;
+    *scroll = new_scroll;
+
+    if (ady >= vh) {
+        render_rows(g, fb, new_scroll, g->view_y0, g->view_y1, -1);
+    } else if (dy > 0) {
+        memmove(top, top + (size_t)dy * W, (size_t)(vh - dy) * W * sizeof(uint16_t));
+        render_rows(g, fb, new_scroll, g->view_y1 - dy + 1, g->view_y1, -1);
+    } else {
+        memmove(top + (size_t)ady * W, top, (size_t)(vh - ady) * W * sizeof(uint16_t));
+        render_rows(g, fb, new_scroll, g->view_y0, g->view_y0 + ady - 1, -1);
+    }
+    return true;
+}
 
-    bool highlighted   = true;
-    bool cancelled     = false;
-    bool ever_pressed  = false;
-    int  last_x        = (int)start_x;
-    int  last_y        = (int)start_y;
+void menu_draw(display_handle_t d, uint16_t *fb)
+{
+    grid_t g;
+    grid_layout(&g, display_width(d), display_height(d));
+    render_full(&g, fb, 0);
+}
 
-    TickType_t wake = xTaskGetTickCount();
-    const TickType_t poll_ticks = pdMS_TO_TICKS(20);
+void menu_prewarm(int W, int H)
+{
+    if (W <= 0 || H <= 0) return;
+    grid_t g;
+    grid_layout(&g, W, H);
+    for (int i = 0; i < g.count; ++i) {
+        const tile_t t = grid_tile(&g, i, 0);
+        if (t.y0 > g.view_y1) break;
+        (void)tile_surface(&t, i, false);
+    }
+}
 
-    for (;;) {
-        uint16_t x, y;
-        bool pressed = touch_gt9xx_read_first(t, &x, &y);
-
-        if (pressed) {
-            ever_pressed = true;
-            last_x = (int)x;
-            last_y = (int)y;
-
-            const bool now_inside = inside(last_x, last_y, tile);
-
-            if (!now_inside) {
-                cancelled = true;
-                if (highlighted) {
-                    draw_tile(fb, W, H, tile, false);
-                    (void)display_draw_bitmap(d, 0, 0, W, H, fb);
-                    highlighted = false;
-                }
-            } else if (!cancelled && !highlighted) {
-                draw_tile(fb, W, H, tile, true);
-                (void)display_draw_bitmap(d, 0, 0, W, H, fb);
-                highlighted = true;
-            }
-
-        } else if (ever_pressed) {
-            const bool final_inside = inside(last_x, last_y, tile);
-            if (!cancelled && final_inside) {
-                return true;
-            } else {
-                if (highlighted) {
-                    draw_tile(fb, W, H, tile, false);
-                    (void)display_draw_bitmap(d, 0, 0, W, H, fb);
-                    highlighted = false;
-                }
-                return false;
-            }
-        }
+void menu_get_tile_cache_stats(ui_surface_cache_stats_t *out)
+{
+    ui_surface_cache_get_stats(s_tile_cache, out);
+}
+
+int menu_tile_count(void)
+{
+    menu_register_defaults();
+    return menu_entry_count();
+}
+
+bool menu_tile_center(display_handle_t d, int index, int *x, int *y)
+{
+    grid_t g;
+    grid_layout(&g, display_width(d), display_height(d));
+    if (index < 0 || index >= g.count) return false;
+
+    const tile_t t = grid_tile(&g, index, 0);
+    const int cx = (t.x0 + t.x1) / 2;
+    const int cy = (t.y0 + t.y1) / 2;
+    if (cy < g.view_y0 || cy > g.view_y1) return false;  // needs scrolling to reach
+    if (x) *x = cx;
+    if (y) *y = cy;
+    return true;
+}
+
+/* --- Event-driven state machine: one touch sample + one frame tick per step --- */
 
-        vTaskDelayUntil(&wake, poll_ticks);
+typedef enum {
+    MS_QUIET,     // wait for 'quiet_us' without contact, then (re)draw and go idle
+    MS_IDLE,      // menu on screen, waiting for a press
+    MS_PRESSED,   // press began on a tile; tracking until release or drag
+    MS_DRAG,      // finger scrolls the grid
+    MS_FLING,     // grid coasts after a fast release
+    MS_DEMO,      // demo stepping once per frame; a touch cancels it
+} menu_state_t;
+
+typedef struct {
+    display_handle_t d;
+    uint16_t        *fb;
+    touch_handle_t   t;
+    grid_t           g;
+    int              scroll;
+    uint16_t        *pfb[2];       // panel scanout buffers (NULL: scroll through fb + present)
+    bool             fb_stale;     // panel scrolled past fb; re-render fb before drawing into it
+
+    menu_state_t     state;
+    uint64_t         last_us;
+    uint32_t         quiet_us;     // MS_QUIET: required quiet time
+    uint32_t         quiet_acc;    // MS_QUIET: accumulated quiet time
+    bool             redraw;       // MS_QUIET: draw the menu on exit
+
+    int              chosen;       // MS_PRESSED
+    bool             highlighted;
+    bool             cancelled;
+    int              start_y;
+    int              last_x, last_y;
+#if MENU_TOUCH_PREDICT
+    touch_predict_t  pred;
+#endif
+
+    int              drag_y;       // MS_DRAG: last finger y
+    int              drag_show_y;  // MS_DRAG: finger y the current scroll corresponds to
+    uint64_t         drag_t;       // MS_DRAG: last sample time
+    float            vel;          // MS_DRAG/MS_FLING: px per µs (content direction)
+    float            fling_pos;    // MS_FLING: sub-pixel scroll
+
+    const menu_entry_t *running;   // MS_DEMO
+    demo_ctx_t       demo;
+} menu_sm_t;
+
+/*
+ * Scroll one step inside the panel FBs: shift the visible rows from what is on
+ * screen into the back buffer, render the exposed band there and flip. Costs a
+ * CPU copy instead of a throttled full-frame DMA2D present, and paces to the
+ * panel refresh. The source is fb while it matches the screen (the front FB may
+ * have been written by DMA2D behind the cache), otherwise our last back buffer.
+ */
+static bool scroll_panel(menu_sm_t *m, int new_scroll, const char *event)
+{
+    const grid_t *g = &m->g;
+    new_scroll = clampi(new_scroll, 0, g->max_scroll);
+    const int dy = new_scroll - m->scroll;
+    if (dy == 0) return false;
+
+    const int W = g->W, H = g->H;
+    (void)display_wait_idle(m->d, 100);   // no DMA2D present still writing either FB
+    (void)display_wait_flip(m->d, 100);   // the back buffer is no longer scanned out
+    ev_begin();                           // render time excludes the pacing waits
+    const uint16_t *front = display_front_buffer(m->d);
+    uint16_t *back = (front == m->pfb[0]) ? m->pfb[1] : m->pfb[0];
+    const uint16_t *src = m->fb_stale ? front : m->fb;
+
+    const int ady = abs(dy);
+    const int vh  = g->view_y1 - g->view_y0 + 1;
+    ui_copy_rect565(back, src, W, H, 0, 0, W - 1, g->view_y0 - 1);
+    ui_copy_rect565(back, src, W, H, 0, g->view_y1 + 1, W - 1, H - 1);
+    if (ady >= vh) {
+        render_rows(g, back, new_scroll, g->view_y0, g->view_y1, -1);
+    } else if (dy > 0) {
+        ui_copy_rect565(back, src + (size_t)dy * W, W, H, 0, g->view_y0, W - 1, g->view_y1 - dy);
+        render_rows(g, back, new_scroll, g->view_y1 - dy + 1, g->view_y1, -1);
+    } else {
+        ui_copy_rect565(back + (size_t)ady * W, src, W, H, 0, g->view_y0, W - 1, g->view_y1 - ady);
+        render_rows(g, back, new_scroll, g->view_y0, g->view_y0 + ady - 1, -1);
     }
+    m->scroll   = new_scroll;
+    m->fb_stale = true;
+
+    const uint64_t t0 = timing_now_us();
+    (void)display_flip(m->d, back);
+    const uint64_t t1 = timing_now_us();
+    /* A flip is seen at the next refresh: half a period away on average. */
+    const uint32_t show_us = (uint32_t)(t1 - t0) + (uint32_t)(5e5f / display_refresh_hz(m->d));
+    s_present_est_us = (s_present_est_us * 7 + show_us) / 8;
+    if (s_ev_cb) s_ev_cb(event, (uint32_t)(t0 - s_ev_t0), (uint32_t)(t1 - t0), s_ev_arg);
+    return true;
 }
 
-void menu_loop(display_handle_t d, uint16_t *fb, touch_handle_t t)
+/* Move the viewport to new_scroll and put it on screen. Returns true if anything moved. */
+static bool scroll_to(menu_sm_t *m, int new_scroll)
 {
-    const int W = display_width(d);
-    const int H = display_height(d);
+    if (m->pfb[0]) return scroll_panel(m, new_scroll, "scroll");
+    if (!scroll_blit(&m->g, m->fb, &m->scroll, new_scroll)) return false;
+    present_full(m->d, m->fb, m->g.W, m->g.H, "scroll");
+    return true;
+}
 
-    tile_t tiles[4];
+/* Bring fb back in line with the screen after panel-side scrolling. */
+static void sync_fb(menu_sm_t *m)
+{
+    if (!m->fb_stale) return;
+    render_full(&m->g, m->fb, m->scroll);
+    m->fb_stale = false;
+}
 
-    for (;;) {
-        touch_drain_until_quiet(t, 60);
+static void enter_quiet(menu_sm_t *m, uint32_t quiet_us, bool redraw)
+{
+    m->state     = MS_QUIET;
+    m->quiet_us  = quiet_us;
+    m->quiet_acc = 0;
+    m->redraw    = m->redraw || redraw;
+}
 
-        build_tiles(d, tiles);
-        menu_draw(d, fb);
-        (void)display_draw_bitmap(d, 0,0, W,H, fb);
+/* Where to draw feedback for the latest sample: the predicted contact at display time. */
+static void feedback_point(menu_sm_t *m, uint64_t now, int *x, int *y)
+{
+#if MENU_TOUCH_PREDICT
+    (void)touch_predict_at(&m->pred, now + s_present_est_us, x, y);
+#endif
+}
 
-        uint16_t tx=0, ty=0;
-        if (!wait_for_touch_first(t, &tx, &ty, 30000)) {
-            continue;
+/* Start a fresh predictor stroke at (x, y). */
+static void stroke_begin(menu_sm_t *m, int x, int y)
+{
+#if MENU_TOUCH_PREDICT
+    touch_predict_init(&m->pred, NULL);
+    touch_predict_update(&m->pred, (uint16_t)x, (uint16_t)y, touch_gt9xx_last_sample_us(m->t));
+#endif
+}
+
+/* y is the finger position the current scroll corresponds to. */
+static void begin_drag(menu_sm_t *m, int y)
+{
+    m->drag_y = y;
+    m->drag_show_y = y;
+    m->drag_t = touch_gt9xx_last_sample_us(m->t);
+    m->vel    = 0;
+    m->state  = MS_DRAG;
+}
+
+static void on_quiet(menu_sm_t *m, bool pressed, uint32_t dt_us)
+{
+    /* Cap one step's contribution so a stalled frame can't skip the quiet window. */
+    if (dt_us > 50000) dt_us = 50000;
+    m->quiet_acc = pressed ? 0 : m->quiet_acc + dt_us;
+    if (m->quiet_acc < m->quiet_us) return;
+
+    if (m->redraw) {
+        ev_begin();
+        grid_layout(&m->g, m->g.W, m->g.H);   // registry may have grown
+        m->scroll = clampi(m->scroll, 0, m->g.max_scroll);
+        render_full(&m->g, m->fb, m->scroll);
+        present_full(m->d, m->fb, m->g.W, m->g.H, "menu");
+        m->redraw   = false;
+        m->fb_stale = false;
+    }
+    m->state = MS_IDLE;
+}
+
+static void on_idle(menu_sm_t *m, bool pressed, uint16_t tx, uint16_t ty, uint64_t now)
+{
+    if (!pressed) return;
+    const int W = m->g.W, H = m->g.H;
+
+    stroke_begin(m, tx, ty);
+    int show_x = tx, show_y = ty;
+    feedback_point(m, now, &show_x, &show_y);
+
+    display_mark_input(m->d, touch_gt9xx_last_sample_us(m->t));
+    ev_begin();
+    sync_fb(m);
+    ui_draw_crosshair(m->fb, W, H, show_x, show_y, (W < 480) ? 6 : 10, C_CROSS);
+    present_full(m->d, m->fb, W, H, "press");
+
+    m->chosen = grid_hit(&m->g, m->scroll, tx, ty);
+    if (m->chosen < 0) {
+        if (m->g.max_scroll > 0) {
+            m->redraw = true;        // crosshair stays until the next full render
+            begin_drag(m, ty);
+        } else {
+            enter_quiet(m, MENU_QUIET_AFTER_DEMO_US, true);
         }
+        return;
+    }
 
-        ui_draw_crosshair(fb, W,H, tx, ty, (W < 480) ? 6 : 10, C_CROSS);
-        (void)display_draw_bitmap(d, 0,0, W,H, fb);
+    ev_begin();
+    render_tile(&m->g, m->fb, m->scroll, m->chosen, true);
+    present_full(m->d, m->fb, W, H, "highlight");
 
-        int chosen = -1;
-        for (int i = 0; i < 4; ++i) {
-            if (inside(tx, ty, &tiles[i])) { chosen = i; break; }
+    m->highlighted = true;
+    m->cancelled   = false;
+    m->start_y     = ty;
+    m->last_x      = tx;
+    m->last_y      = ty;
+    m->state       = MS_PRESSED;
+}
+
+/* Accept only if:
+ *  - we never left the tile while pressed, and
+ *  - release occurred with the last in-bounds position inside.
+ * Vertical travel past the slop on a scrollable grid turns the press into a drag.
+ */
+static void on_pressed(menu_sm_t *m, bool pressed, uint16_t x, uint16_t y, uint64_t now)
+{
+    const int W = m->g.W, H = m->g.H;
+    const tile_t tile = grid_tile(&m->g, m->chosen, m->scroll);
+
+    if (pressed) {
+        m->last_x = (int)x;
+        m->last_y = (int)y;
+
+        if (m->g.max_scroll > 0 && abs(m->last_y - m->start_y) > MENU_DRAG_SLOP_PX) {
+            ev_begin();
+            render_full(&m->g, m->fb, m->scroll);   // drop highlight + crosshair
+            present_full(m->d, m->fb, W, H, "cancel");
+            begin_drag(m, m->start_y);
+            return;
         }
-        if (chosen < 0) {
-            touch_drain_until_quiet(t, 80);
-            continue;
+
+        /* Decision uses the real contact; feedback may run ahead of it. */
+        int show_x = m->last_x, show_y = m->last_y;
+#if MENU_TOUCH_PREDICT
+        touch_predict_update(&m->pred, x, y, touch_gt9xx_last_sample_us(m->t));
+#endif
+        feedback_point(m, now, &show_x, &show_y);
+        if (!inside(m->last_x, m->last_y, &tile)) m->cancelled = true;
+
+        const bool want_hi = !m->cancelled && inside(show_x, show_y, &tile);
+        if (want_hi != m->highlighted) {
+            display_mark_input(m->d, touch_gt9xx_last_sample_us(m->t));
+            ev_begin();
+            render_tile(&m->g, m->fb, m->scroll, m->chosen, want_hi);
+            present_full(m->d, m->fb, W, H, want_hi ? "highlight" : "unhighlight");
+            m->highlighted = want_hi;
         }
+        return;
+    }
 
-        draw_tile(fb, W,H, &tiles[chosen], true);
-        (void)display_draw_bitmap(d, 0,0, W,H, fb);
+#if MENU_TOUCH_PREDICT
+    touch_predict_stats_t st;
+    touch_predict_get_stats(&m->pred, &st);
+    ESP_LOGD(TAG, "predict: %u samples, %u scored, err mean %.1f max %.1f px",
+             (unsigned)st.samples, (unsigned)st.scored,
+             (double)st.mean_err_px, (double)st.max_err_px);
+#endif
+
+    const menu_entry_t *e = menu_entry_at(m->chosen);
+    if (!m->cancelled && inside(m->last_x, m->last_y, &tile) && e && e->demo) {
+        m->running = e;
+        demo_begin(e->demo, &m->demo, m->d, m->fb, e->seconds);
+        m->state = MS_DEMO;
+        return;
+    }
 
-        const bool accepted = confirm_release_inside(d, fb, &tiles[chosen], t, tx, ty);
-        if (!accepted) {
-            menu_draw(d, fb);
-            (void)display_draw_bitmap(d, 0,0, W,H, fb);
-            continue;
-        }
+    ev_begin();
+    render_full(&m->g, m->fb, m->scroll);
+    present_full(m->d, m->fb, W, H, "cancel");
+    enter_quiet(m, MENU_QUIET_AFTER_CANCEL_US, false);
+}
 
-        switch (chosen) {
-            case 0: demo_color_bars(d, fb, 2);        break;
-            case 1: demo_vertical_gradient(d, fb, 2); break;
-            case 2: demo_bounce_seconds(d, fb, 5);    break;
-            case 3: demo_checker_sleep_wake(d, fb, 2);break;
-            default: break;
+/*
+ * Content follows the predicted finger so it lands under the real one when the
+ * frame reaches the panel; velocity for the fling comes from the raw samples.
+ */
+static void on_drag(menu_sm_t *m, bool pressed, uint16_t x, uint16_t y, uint64_t now)
+{
+    if (!pressed) {
+#if MENU_TOUCH_PREDICT
+        touch_predict_release(&m->pred);
+#endif
+        const float v_px_s = fabsf(m->vel) * 1e6f;
+        if (v_px_s >= MENU_FLING_MIN_PX_S) {
+            m->fling_pos = (float)m->scroll;
+            m->state     = MS_FLING;
+        } else {
+            /* Settle on where the finger actually lifted, not where it was predicted. */
+            ev_begin();
+            (void)scroll_to(m, m->scroll + (m->drag_show_y - m->drag_y));
+            enter_quiet(m, MENU_QUIET_AFTER_CANCEL_US, false);
         }
+        return;
+    }
+
+    const uint64_t ts = touch_gt9xx_last_sample_us(m->t);
+    if (ts > m->drag_t) {
+        const float inst = (float)(m->drag_y - (int)y) / (float)(ts - m->drag_t);   // finger up → content scrolls down
+        m->vel = 0.6f * m->vel + 0.4f * inst;
+    }
+    m->drag_y = y;
+    m->drag_t = ts;
+
+    int show_x = x, show_y = y;
+#if MENU_TOUCH_PREDICT
+    touch_predict_update(&m->pred, x, y, ts);
+#endif
+    feedback_point(m, now, &show_x, &show_y);
+    const int dy = m->drag_show_y - show_y;
+    m->drag_show_y = show_y;
+
+    ev_begin();
+    (void)scroll_to(m, m->scroll + dy);
+}
+
+static void on_fling(menu_sm_t *m, bool pressed, uint16_t x, uint16_t y, uint32_t dt_us)
+{
+    if (pressed) {          // finger catches the grid
+        stroke_begin(m, x, y);
+        begin_drag(m, y);
+        return;
+    }
 
-        touch_drain_until_quiet(t, 80);
+    m->fling_pos += m->vel * (float)dt_us;
+    m->vel       *= expf(-MENU_FLING_DECAY_PER_S * (float)dt_us * 1e-6f);
+
+    ev_begin();
+    const int target = (int)lroundf(m->fling_pos);
+    (void)scroll_to(m, target);
+
+    const bool at_edge = (target <= 0 || target >= m->g.max_scroll);
+    if (at_edge || fabsf(m->vel) * 1e6f < MENU_FLING_STOP_PX_S) {
+        enter_quiet(m, 0, false);   // settles any pending redraw, then idle
+    }
+}
+
+static void on_demo(menu_sm_t *m, bool pressed, uint64_t now)
+{
+    const demo_desc_t *desc = m->running->demo;
+    const bool cancel = pressed && (now - m->demo.t_start_us) >= MENU_DEMO_ARM_US;
+
+    if (cancel || !demo_step(desc, &m->demo, now)) {
+        if (cancel) ESP_LOGI(TAG, "demo '%s' cancelled", desc->name);
+        demo_end(desc, &m->demo);
+        m->running = NULL;
+        enter_quiet(m, MENU_QUIET_AFTER_DEMO_US, true);
+    }
+}
+
+/* One scheduler step. Returns false when the session is over (replay finished). */
+static bool menu_sm_step(menu_sm_t *m, uint64_t now)
+{
+    uint16_t x = 0, y = 0;
+    const bool pressed = touch_gt9xx_read_first(m->t, &x, &y);
+    const uint32_t dt  = (uint32_t)(now - m->last_us);
+    m->last_us = now;
+
+    switch (m->state) {
+        case MS_QUIET:   on_quiet(m, pressed, dt);          break;
+        case MS_IDLE:    on_idle(m, pressed, x, y, now);    break;
+        case MS_PRESSED: on_pressed(m, pressed, x, y, now); break;
+        case MS_DRAG:    on_drag(m, pressed, x, y, now);    break;
+        case MS_FLING:   on_fling(m, pressed, x, y, dt);    break;
+        case MS_DEMO:    on_demo(m, pressed, now);          break;
+    }
+
+    return !(m->state == MS_IDLE && touch_gt9xx_replay_done(m->t));
+}
+
+void menu_loop(display_handle_t d, uint16_t *fb, touch_handle_t t)
+{
+    menu_sm_t m = {
+        .d  = d,
+        .fb = fb,
+        .t  = t,
+        .last_us = timing_now_us(),
+    };
+    grid_layout(&m.g, display_width(d), display_height(d));
+#if MENU_PANEL_SCROLL
+    if (display_get_frame_buffers(d, m.pfb) != ESP_OK) m.pfb[0] = m.pfb[1] = NULL;
+#endif
+    enter_quiet(&m, MENU_QUIET_AFTER_CANCEL_US, true);
+
+    uint64_t next = 0;
+    for (;;) {
+        TRACE_BEGIN("menu_frame");
+        const bool more = menu_sm_step(&m, timing_now_us());
+        TRACE_COUNTER("menu_state", m.state);
+        TRACE_END("menu_frame");
+        if (!more) return;
+
+        const uint32_t frame_us = (m.state == MS_DEMO && m.running->demo->frame_us)
+                                ? m.running->demo->frame_us : MENU_FRAME_US;
+        timing_sleep_periodic_us(&next, frame_us);
     }
 }
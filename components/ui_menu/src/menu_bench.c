@@ -0,0 +1,234 @@
+#include "ui_menu/menu_bench.h"
+
+#include <string.h>
+#include "esp_log.h"
+
+#include "ui_menu/menu.h"
+#include "util/timing.h"
+#include "touch_gt9xx/touch_gt9xx.h"
+#include "touch_gt9xx/touch_capture.h"
+
+static const char *TAG = "menu_bench";
+
+#define SAMPLE_US     10000   // matches a 10 ms poll
+#define SETTLE_US     400000  // let the menu draw before the first touch
+#define CAPTURE_BYTES 4096
+#define DEMO_RUN_MS   1000    // how long a launched demo runs before the cancel tap
+#define SCROLL_GAP_US 100000  // scroll frames further apart than this start a new motion run
+#define CANCEL_DRIFT_PX 6     // vertical wobble on a cancel drag, under menu.c's 12 px drag slop
+
+/* ---- session scripting ---- */
+typedef struct {
+    touch_capture_writer_t w;
+    uint64_t t;
+} script_t;
+
+static void s_wait(script_t *s, uint32_t ms)
+{
+    s->t += (uint64_t)ms * 1000ULL;
+}
+
+static void s_release(script_t *s)
+{
+    const touch_sample_t up = { .t_us = s->t, .pressed = false };
+    (void)touch_capture_append(&s->w, &up);
+}
+
+static void s_tap(script_t *s, int x, int y, uint32_t hold_ms)
+{
+    for (uint32_t held = 0; held < hold_ms * 1000U; held += SAMPLE_US) {
+        const touch_sample_t p = { .t_us = s->t, .x = (uint16_t)x, .y = (uint16_t)y, .pressed = true };
+        (void)touch_capture_append(&s->w, &p);
+        s->t += SAMPLE_US;
+    }
+    s_release(s);
+}
+
+static void s_drag(script_t *s, int x0, int y0, int x1, int y1, uint32_t dur_ms)
+{
+    const int steps = (int)(dur_ms * 1000U / SAMPLE_US);
+    for (int i = 0; i <= steps; ++i) {
+        const touch_sample_t p = {
+            .t_us    = s->t,
+            .x       = (uint16_t)(x0 + (x1 - x0) * i / (steps ? steps : 1)),
+            .y       = (uint16_t)(y0 + (y1 - y0) * i / (steps ? steps : 1)),
+            .pressed = true,
+        };
+        (void)touch_capture_append(&s->w, &p);
+        s->t += SAMPLE_US;
+    }
+    s_release(s);
+}
+
+/* Launch each tile's demo, let it run briefly, then tap to cancel it. */
+static void build_tap_each(display_handle_t d, script_t *s)
+{
+    for (int i = 0; i < menu_tile_count(); ++i) {
+        int x = 0, y = 0;
+        if (!menu_tile_center(d, i, &x, &y)) continue;  // below the fold
+        s_wait(s, SETTLE_US / 1000);
+        s_tap(s, x, y, 80);
+        s_wait(s, DEMO_RUN_MS);
+        s_tap(s, x, y, 40);
+    }
+}
+
+/*
+ * Press each on-screen tile, slide sideways onto its row neighbour and let go:
+ * the press leaves the tile without passing the vertical drag slop, so every
+ * one must end as a cancel, never a scroll or a launch.
+ */
+static void build_drag_cancel(display_handle_t d, script_t *s)
+{
+    int n = 0;
+    while (n < menu_tile_count() && menu_tile_center(d, n, NULL, NULL)) ++n;
+    for (int i = 0; i < n; ++i) {
+        int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+        (void)menu_tile_center(d, i, &x0, &y0);
+        int j = 0;
+        while (j < n && (j == i || !menu_tile_center(d, j, &x1, &y1) || y1 != y0)) ++j;
+        if (j == n) continue;   // alone in its row
+        s_wait(s, SETTLE_US / 1000);
+        s_drag(s, x0, y0, x1, y0 + CANCEL_DRIFT_PX, 300);
+    }
+}
+
+static void build_double_taps(display_handle_t d, script_t *s)
+{
+    int x = 0, y = 0;
+    (void)menu_tile_center(d, 0, &x, &y);
+    s_wait(s, SETTLE_US / 1000);
+    for (int i = 0; i < 3; ++i) {
+        s_tap(s, x, y, 40);
+        s_wait(s, 60);
+        s_tap(s, x, y, 40);
+        s_wait(s, SETTLE_US / 1000);
+    }
+}
+
+/* Slow drags down and back up the grid, then a flick each way (fling coast). */
+static void build_scroll(display_handle_t d, script_t *s)
+{
+    const int W = display_width(d), H = display_height(d);
+    const int x = W / 2, lo = H * 3 / 4, hi = H / 4;
+    for (int i = 0; i < 2; ++i) {
+        s_wait(s, SETTLE_US / 1000);
+        s_drag(s, x, lo, x, hi, 800);
+        s_wait(s, SETTLE_US / 1000);
+        s_drag(s, x, hi, x, lo, 800);
+    }
+    s_wait(s, SETTLE_US / 1000);
+    s_drag(s, x, lo, x, hi, 120);
+    s_wait(s, 1500);
+    s_drag(s, x, hi, x, lo, 120);
+    s_wait(s, 1500);
+}
+
+/* ---- per-event collection ---- */
+typedef struct {
+    const char *session;
+    uint32_t    events;
+    uint64_t    render_sum, present_sum;
+    uint32_t    render_max, present_max;
+    uint32_t    scrolls;         // every "scroll" event
+    uint32_t    scroll_frames;   // ...of which inside motion runs
+    uint64_t    scroll_us;       // time covered by those runs
+    uint64_t    scroll_last;
+} bench_acc_t;
+
+static void on_event(const char *event, uint32_t render_us, uint32_t present_us, void *arg)
+{
+    bench_acc_t *a = (bench_acc_t *)arg;
+    if (strcmp(event, "scroll") == 0) {
+        a->scrolls++;
+        const uint64_t now = timing_now_us();
+        if (a->scroll_last && now - a->scroll_last < SCROLL_GAP_US) {
+            a->scroll_frames++;
+            a->scroll_us += now - a->scroll_last;
+        }
+        a->scroll_last = now;
+    }
+    a->events++;
+    a->render_sum  += render_us;
+    a->present_sum += present_us;
+    if (render_us  > a->render_max)  a->render_max  = render_us;
+    if (present_us > a->present_max) a->present_max = present_us;
+    ESP_LOGI(TAG, "[%s] %-11s render=%6u us present=%6u us",
+             a->session, event, (unsigned)render_us, (unsigned)present_us);
+}
+
+typedef struct {
+    const char *name;
+    void (*build)(display_handle_t d, script_t *s);
+    bool        no_scroll;   // the script never passes the drag slop
+} session_t;
+
+static const session_t kSessions[] = {
+    { "tap-each",    build_tap_each,    true  },
+    { "drag-cancel", build_drag_cancel, true  },
+    { "double-tap",  build_double_taps, true  },
+    { "scroll",      build_scroll,      false },
+};
+
+esp_err_t menu_bench_run(display_handle_t d, uint16_t *fb)
+{
+    static uint8_t capture[CAPTURE_BYTES];
+    esp_err_t ret = ESP_OK;
+    display_reset_present_filter_stats(d);
+
+    for (size_t i = 0; i < sizeof(kSessions) / sizeof(kSessions[0]); ++i) {
+        script_t s = {0};
+        if (touch_capture_writer_init(&s.w, capture, sizeof(capture)) != ESP_OK) return ESP_ERR_NO_MEM;
+        kSessions[i].build(d, &s);
+        if (s.w.overflow) ESP_LOGW(TAG, "[%s] capture truncated", kSessions[i].name);
+        const size_t len = touch_capture_finish(&s.w);
+
+        touch_handle_t replay = NULL;
+        if (touch_gt9xx_open_replay(capture, len, &replay) != ESP_OK) continue;
+
+        bench_acc_t acc = { .session = kSessions[i].name };
+        menu_set_event_hook(on_event, &acc);
+        menu_loop(d, fb, replay);
+        menu_set_event_hook(NULL, NULL);
+        touch_gt9xx_deinit(replay);
+
+        const uint32_t n = acc.events ? acc.events : 1;
+        ESP_LOGI(TAG, "[%s] %u events (%u samples, %u bytes): render avg %u max %u us, "
+                      "present avg %u max %u us",
+                 acc.session, (unsigned)acc.events, (unsigned)s.w.count, (unsigned)len,
+                 (unsigned)(acc.render_sum / n), (unsigned)acc.render_max,
+                 (unsigned)(acc.present_sum / n), (unsigned)acc.present_max);
+        if (acc.scroll_frames) {
+            ESP_LOGI(TAG, "[%s] scrolling: %u frames in %u ms of motion = %.1f fps (panel %.1f Hz)",
+                     acc.session, (unsigned)acc.scroll_frames, (unsigned)(acc.scroll_us / 1000),
+                     (double)(acc.scroll_frames * 1e6f / (float)acc.scroll_us),
+                     (double)display_refresh_hz(d));
+        }
+        if (kSessions[i].no_scroll && acc.scrolls) {
+            ESP_LOGE(TAG, "[%s] %u scroll frames from a script that never drags",
+                     acc.session, (unsigned)acc.scrolls);
+            ret = ESP_ERR_INVALID_STATE;
+        }
+    }
+
+    display_filter_stats_t fs;
+    display_get_present_filter_stats(d, &fs);
+    if (fs.tile_px) {
+        ESP_LOGI(TAG, "present filter (%d px): %u frames, %u skipped, %u bands, sent %u%% of px, "
+                      "hash avg %u us",
+                 fs.tile_px, (unsigned)fs.frames, (unsigned)fs.skipped, (unsigned)fs.bands,
+                 (unsigned)(fs.px_in ? fs.px_sent * 100 / fs.px_in : 0),
+                 (unsigned)(fs.frames ? fs.hash_us / fs.frames : 0));
+    }
+
+    ui_surface_cache_stats_t cs;
+    menu_get_tile_cache_stats(&cs);
+    const uint32_t lookups = cs.hits + cs.misses;
+    ESP_LOGI(TAG, "tile cache: %u/%u hits (%u%%), %d entries, %u evictions, "
+                  "internal %u (peak %u) B, psram %u (peak %u) B",
+             (unsigned)cs.hits, (unsigned)lookups,
+             (unsigned)(lookups ? cs.hits * 100U / lookups : 0), cs.entries,
+             (unsigned)cs.evictions, (unsigned)cs.internal_bytes, (unsigned)cs.internal_peak,
+             (unsigned)cs.psram_bytes, (unsigned)cs.psram_peak);
+    return ret;
+}
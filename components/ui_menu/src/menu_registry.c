@@ -0,0 +1,50 @@
+#include "ui_menu/menu_registry.h"
+
+#include "esp_log.h"
+
+static const char *TAG = "menu_registry";
+
+static menu_entry_t s_entries[MENU_REGISTRY_MAX];
+static int          s_count;
+
+int menu_register(const menu_entry_t *e)
+{
+    if (!e || !e->name) return -1;
+    if (s_count >= MENU_REGISTRY_MAX) {
+        ESP_LOGW(TAG, "registry full; '%s' dropped", e->name);
+        return -1;
+    }
+    s_entries[s_count] = *e;
+    return s_count++;
+}
+
+void menu_register_defaults(void)
+{
+    if (s_count) return;
+    menu_register(&(menu_entry_t){ .name = "Color Bars", .accent = 0xF800,
+                                   .demo = &demo_color_bars_desc,         .seconds = 2 });
+    menu_register(&(menu_entry_t){ .name = "Gradient",   .accent = 0x07E0,
+                                   .demo = &demo_vertical_gradient_desc,  .seconds = 2 });
+    menu_register(&(menu_entry_t){ .name = "Bounce 5s",  .accent = 0xFBE0,
+                                   .demo = &demo_bounce_desc,             .seconds = 5 });
+    menu_register(&(menu_entry_t){ .name = "Sleep/Wake", .accent = 0xFFFF,
+                                   .demo = &demo_checker_sleep_wake_desc, .seconds = 2 });
+    menu_register(&(menu_entry_t){ .name = "Particles",  .accent = 0x07FF,
+                                   .demo = &demo_particles_desc,          .seconds = 30 });
+    menu_register(&(menu_entry_t){ .name = "Plasma",     .accent = 0xF81F,
+                                   .demo = &demo_plasma_desc,             .seconds = 10 });
+    menu_register(&(menu_entry_t){ .name = "Animation",  .accent = 0x841F,
+                                   .demo = &demo_anim_desc,               .seconds = 10 });
+    menu_register(&(menu_entry_t){ .name = "Slideshow",  .accent = 0xFD20,
+                                   .demo = &demo_slideshow_desc,          .seconds = 60 });
+}
+
+int menu_entry_count(void)
+{
+    return s_count;
+}
+
+const menu_entry_t *menu_entry_at(int index)
+{
+    return (index >= 0 && index < s_count) ? &s_entries[index] : NULL;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * Fixed-timestep animation clock.
+ *
+ * Simulation advances in whole `step_us` ticks accumulated from real time, so
+ * motion speed doesn't depend on how often (or how late) frames render. The
+ * leftover fraction is exposed as an interpolation alpha for drawing between
+ * the previous and current simulation state.
+ *
+ * After a long stall at most `max_steps` ticks are run per advance; the rest of
+ * the backlog is dropped (counted in dropped_us) instead of fast-forwarding.
+ */
+typedef struct {
+    uint32_t step_us;
+    uint32_t max_steps;
+    uint64_t last_us;     // time of previous advance
+    uint64_t acc_us;      // unsimulated time, < step_us after advance
+    uint64_t steps;       // simulation ticks run so far
+    uint64_t dropped_us;  // backlog discarded by the max_steps limit
+    uint32_t frames;      // advance() calls
+} anim_clock_t;
+
+void anim_clock_init(anim_clock_t *c, uint32_t step_us, uint32_t max_steps, uint64_t now_us);
+
+/** Accumulate time up to now_us; returns how many simulation steps to run (≤ max_steps). */
+uint32_t anim_clock_advance(anim_clock_t *c, uint64_t now_us);
+
+/** Fraction of a step since the last simulated tick, Q16 (0..65535). */
+static inline uint32_t anim_clock_alpha_q16(const anim_clock_t *c)
+{
+    return (uint32_t)((c->acc_us << 16) / c->step_us);
+}
+
+/** a + (b - a)·alpha for Q16.16 (or any int32) values. */
+static inline int32_t anim_lerp_q16(int32_t a, int32_t b, uint32_t alpha_q16)
+{
+    return a + (int32_t)(((int64_t)(b - a) * alpha_q16) >> 16);
+}
+
+#ifdef __cplusplus
+}
+#endif
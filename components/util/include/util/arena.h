@@ -0,0 +1,92 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * Boot-time arenas for frame-loop memory.
+ *
+ * Each region is one block reserved at boot. Persistent allocations bump up
+ * from the bottom and are released LIFO with a mark (e.g. a demo marks in
+ * start() and resets in stop()). Per-frame scratch bumps down from the top
+ * inside an owner's frame scope and is released when that owner ends the
+ * scope, once nothing reads it any more. Every block is cache-line aligned and
+ * padded, so the cache write-back a DMA consumer does on one block never
+ * touches a neighbour. Nothing here calls the heap after arena_init().
+ */
+typedef enum {
+    ARENA_INTERNAL_DMA = 0,   // on-chip, DMA-capable
+    ARENA_PSRAM_DMA,          // external, DMA-capable
+    ARENA_REGION_COUNT,
+} arena_region_t;
+
+typedef struct {
+    size_t bytes[ARENA_REGION_COUNT];
+} arena_cfg_t;
+
+#define ARENA_CFG_DEFAULT() { .bytes = { [ARENA_INTERNAL_DMA] = 128 * 1024, \
+                                         [ARENA_PSRAM_DMA]    = 1024 * 1024 } }
+
+typedef struct {
+    size_t   capacity;
+    size_t   used;          // persistent
+    size_t   scratch;       // current frame
+    size_t   high_water;    // peak persistent + scratch
+    uint32_t failures;      // requests that did not fit
+} arena_stats_t;
+
+/** Opaque LIFO position for arena_reset_to(). */
+typedef size_t arena_mark_t;
+
+/** One owner's scratch scope: the scratch position of every region when it opened. */
+typedef struct {
+    size_t hi[ARENA_REGION_COUNT];
+} arena_frame_t;
+
+/** Reserve the regions (idempotent). A region that can't be reserved stays empty. */
+esp_err_t arena_init(const arena_cfg_t *cfg);
+
+/** Cache-line size used for alignment/padding. */
+size_t arena_align(void);
+
+/** Persistent block; NULL if the region is exhausted or not reserved. */
+void *arena_alloc(arena_region_t r, size_t bytes);
+
+arena_mark_t arena_mark(arena_region_t r);
+void         arena_reset_to(arena_region_t r, arena_mark_t m);
+
+/** Scratch valid until the enclosing frame scope ends. */
+void *arena_scratch(arena_region_t r, size_t bytes);
+
+/** Open a frame scope: scratch taken from now on belongs to it. */
+void arena_frame_begin(arena_frame_t *f);
+
+/**
+ * Release the scratch taken since arena_frame_begin(f). Scopes nest LIFO like
+ * marks. Only end a scope once no transfer still reads its blocks (e.g. after
+ * display_wait_idle()).
+ */
+void arena_frame_end(const arena_frame_t *f);
+
+void arena_get_stats(arena_region_t r, arena_stats_t *out);
+
+/*
+ * Cache maintenance for an arena block shared with a DMA engine, widened to
+ * whole lines (safe because blocks are line-aligned and padded). Only needed
+ * when the caller drives the DMA itself: esp_lcd already syncs what it is
+ * handed in draw_bitmap. No-op where memory is coherent (the host shim).
+ */
+
+/** CPU writes -> memory, before a DMA engine reads buf. */
+esp_err_t arena_cache_writeback(const void *buf, size_t bytes);
+
+/** Drop cached lines, after a DMA engine wrote buf and before the CPU reads it. */
+esp_err_t arena_cache_invalidate(void *buf, size_t bytes);
+
+#ifdef __cplusplus
+}
+#endif
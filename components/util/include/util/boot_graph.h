@@ -0,0 +1,67 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * Startup as a small dependency graph.
+ *
+ * Each stage runs on its own task as soon as the stages named in its deps mask
+ * have finished, so independent bring-up (panel vs touch vs asset prep)
+ * overlaps. A stage whose dependency failed or was skipped is skipped. Deps may
+ * only name earlier stages, which keeps the array a valid topological order
+ * and rules out cycles. One graph runs at a time.
+ */
+#define BOOT_GRAPH_MAX_STAGES     16
+
+#ifndef BOOT_GRAPH_STACK_DEFAULT
+#define BOOT_GRAPH_STACK_DEFAULT  4096
+#endif
+
+#define BOOT_DEP(i)               (1u << (i))
+
+typedef esp_err_t (*boot_stage_fn_t)(void *ctx);
+
+typedef struct {
+    const char     *name;
+    boot_stage_fn_t fn;
+    uint32_t        deps;          // BOOT_DEP(i) | ... of earlier stages
+    uint32_t        stack_bytes;   // 0 = BOOT_GRAPH_STACK_DEFAULT
+} boot_stage_t;
+
+typedef enum {
+    BOOT_STAGE_PENDING = 0,
+    BOOT_STAGE_OK,
+    BOOT_STAGE_FAILED,
+    BOOT_STAGE_SKIPPED,            // a dependency did not succeed
+} boot_stage_status_t;
+
+typedef struct {
+    boot_stage_status_t status;
+    esp_err_t           err;
+    uint64_t            start_us;  // timing_now_us(), i.e. since app start
+    uint64_t            end_us;
+    int                 core;
+} boot_stage_result_t;
+
+typedef struct {
+    boot_stage_result_t stage[BOOT_GRAPH_MAX_STAGES];
+    uint64_t            t0_us, t1_us;  // graph entry / last stage done
+} boot_report_t;
+
+/**
+ * Run all stages and block until every one has finished or been skipped.
+ * Returns ESP_OK when the graph ran (check out->stage[i].status per stage),
+ * ESP_ERR_INVALID_ARG for a malformed graph.
+ */
+esp_err_t boot_graph_run(const boot_stage_t *stages, int n, void *ctx, boot_report_t *out);
+
+/** Per-stage start/end/duration table plus critical-path total. */
+void boot_graph_log(const boot_stage_t *stages, int n, const boot_report_t *r);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,42 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* Rects kept per frame; further adds merge into the cheapest existing rect. */
+#ifndef DIRTY_RECTS_MAX
+#define DIRTY_RECTS_MAX 16
+#endif
+
+/** Half-open rectangle [x0,x1) × [y0,y1), same convention as display_draw_bitmap. */
+typedef struct {
+    int x0, y0, x1, y1;
+} dirty_rect_t;
+
+/**
+ * Per-frame damage list. Rects that overlap (or come within `slop` px of each
+ * other) are merged on add, so the list stays short and disjoint-ish and each
+ * entry maps to one present.
+ */
+typedef struct {
+    dirty_rect_t r[DIRTY_RECTS_MAX];
+    int          n;
+    int          slop;
+} dirty_rects_t;
+
+void dirty_rects_reset(dirty_rects_t *d, int slop);
+
+/** Add a rect (empty rects are ignored); merges as described above. */
+void dirty_rects_add(dirty_rects_t *d, int x0, int y0, int x1, int y1);
+
+/** Clip every rect to [0,W)×[0,H), dropping ones that become empty. */
+void dirty_rects_clip(dirty_rects_t *d, int W, int H);
+
+/** Sum of rect areas in px (rects are disjoint after merging, so this is the push size). */
+uint32_t dirty_rects_area(const dirty_rects_t *d);
+
+#ifdef __cplusplus
+}
+#endif
@@ -15,10 +15,15 @@ extern "C" {
  *  3) DEFAULT
  *
  * @param bytes  number of bytes to allocate
+ * Accounted under MEM_TAG_FB (see util/mem.h).
+ *
  * @return pointer to buffer, or NULL if allocation fails
  */
 void *util_malloc_psram_dma(size_t bytes);
 
+/** Release a buffer from util_malloc_psram_dma() (accounted under MEM_TAG_FB). */
+void util_free_psram_dma(void *p);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
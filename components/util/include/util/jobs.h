@@ -0,0 +1,60 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/* Chunks a single parallel_for_rows() call may be split into (per worker deque). */
+#ifndef JOBS_DEQUE_CAP
+#define JOBS_DEQUE_CAP 32
+#endif
+
+/* Ranges smaller than this many rows run inline on the caller. */
+#ifndef JOBS_MIN_ROWS
+#define JOBS_MIN_ROWS 16
+#endif
+
+typedef struct {
+    uint32_t    stack_bytes;   // per worker
+    int         priority;      // worker task priority
+} jobs_cfg_t;
+
+#define JOBS_CFG_DEFAULT() { .stack_bytes = 3072, .priority = 5 }
+
+/** Row-range body: process rows [y0, y1). Must be safe to run concurrently on disjoint ranges. */
+typedef void (*jobs_rows_fn_t)(int y0, int y1, void *arg);
+
+typedef struct {
+    uint32_t batches;          // parallel_for_rows() calls that were split
+    uint32_t inline_calls;     // calls run entirely on the caller
+    uint32_t chunks;           // chunks executed in total
+    uint32_t steals;           // chunks taken from another core's deque
+} jobs_stats_t;
+
+/**
+ * Start one worker task pinned to each core. Idempotent. Until this is called
+ * (or if it fails) parallel_for_rows() simply runs the body on the caller.
+ */
+esp_err_t jobs_init(const jobs_cfg_t *cfg);
+
+/** True once workers are running. */
+bool jobs_ready(void);
+
+/**
+ * Run fn over [y0, y1) split into chunks of about `grain` rows (0 = auto),
+ * spread across the cores. The caller executes chunks too and returns only
+ * when every chunk has finished.
+ *
+ * Runs inline when workers aren't started, the range is small, another batch
+ * is already in flight, or it's called from inside a job (no nesting).
+ */
+void parallel_for_rows(int y0, int y1, int grain, jobs_rows_fn_t fn, void *arg);
+
+void jobs_get_stats(jobs_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
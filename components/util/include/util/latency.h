@@ -0,0 +1,43 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* Samples kept for percentile queries; older ones roll off. */
+#ifndef LATENCY_HIST_WINDOW
+#define LATENCY_HIST_WINDOW 128
+#endif
+
+/**
+ * Rolling latency window (µs). add() is O(1) and allocation-free, so it can
+ * run under a spinlock; it is not IRAM-resident, so IRAM-safe ISRs should
+ * record the sample and leave add() to task context. Percentiles are
+ * computed on query.
+ */
+typedef struct {
+    uint32_t samples[LATENCY_HIST_WINDOW];
+    uint32_t head;       // next write slot
+    uint32_t filled;     // valid samples in the window
+    uint32_t total;      // samples ever added
+} latency_hist_t;
+
+typedef struct {
+    uint32_t count;      // samples in window
+    uint32_t total;      // samples ever added
+    uint32_t min_us;
+    uint32_t p50_us;
+    uint32_t p95_us;
+    uint32_t max_us;
+} latency_summary_t;
+
+void latency_hist_reset(latency_hist_t *h);
+void latency_hist_add(latency_hist_t *h, uint32_t us);
+
+/** Summarize the current window (zeros if empty). */
+void latency_hist_summary(const latency_hist_t *h, latency_summary_t *out);
+
+#ifdef __cplusplus
+}
+#endif
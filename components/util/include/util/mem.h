@@ -0,0 +1,75 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * Tagged heap wrappers with per-component accounting.
+ *
+ * Every block is attributed to the tag passed at allocation and classed by
+ * where it actually landed (internal vs PSRAM; DMA is counted in addition when
+ * the memory is DMA-capable). Sizes come from the heap itself, so mem_free()
+ * only needs the same tag back. A request that fails on every caps fallback
+ * logs the tag and dumps the table.
+ */
+typedef enum {
+    MEM_TAG_FB = 0,     // framebuffers (util_malloc_psram_dma)
+    MEM_TAG_ARENA,      // boot-time arena regions
+    MEM_TAG_DISPLAY,
+    MEM_TAG_TOUCH,
+    MEM_TAG_UI_GFX,
+    MEM_TAG_DEMOS,
+    MEM_TAG_IMAGE,
+    MEM_TAG_LVGL,
+    MEM_TAG_UTIL,
+    MEM_TAG_MAIN,
+    MEM_TAG_COUNT,
+} mem_tag_t;
+
+typedef enum {
+    MEM_CLASS_INTERNAL = 0,
+    MEM_CLASS_SPIRAM,
+    MEM_CLASS_DMA,      // overlaps the two above
+    MEM_CLASS_COUNT,
+} mem_class_t;
+
+typedef struct {
+    size_t   live_bytes;
+    size_t   peak_bytes;
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t failures;  // tagged requests that failed (classed by the caps asked for)
+} mem_stats_t;
+
+/** Hook heap failures (untagged ones included) into the report. Idempotent. */
+esp_err_t mem_init(void);
+
+void *mem_malloc(mem_tag_t tag, size_t bytes, uint32_t caps);
+void *mem_calloc(mem_tag_t tag, size_t n, size_t size, uint32_t caps);
+void *mem_aligned_alloc(mem_tag_t tag, size_t align, size_t bytes, uint32_t caps);
+
+/** Like mem_malloc(), but a miss is silent and uncounted (caller has a fallback). */
+void *mem_try_malloc(mem_tag_t tag, size_t bytes, uint32_t caps);
+
+/**
+ * Try caps[0..n-1] in order (align 0 = natural alignment); only a miss on the
+ * last one counts as a failure.
+ */
+void *mem_alloc_prefer(mem_tag_t tag, size_t align, size_t bytes, const uint32_t *caps, int n);
+
+/** Free a block from any of the above (NULL is fine). */
+void mem_free(mem_tag_t tag, void *p);
+
+void        mem_get_stats(mem_tag_t tag, mem_class_t cls, mem_stats_t *out);
+const char *mem_tag_name(mem_tag_t tag);
+
+/** Log the per-tag table plus heap free/minimum-free per capability. */
+void mem_dump(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,19 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * xxHash32-style content hash of a w×h RGB565 block (row stride in pixels).
+ * Four independent lanes over 32-bit words keep the multiply chains short;
+ * word loads need p 4-byte aligned and an even stride, otherwise a 16-bit
+ * path runs (same result is not guaranteed across the two paths, so hash a
+ * given region the same way every time).
+ */
+uint32_t tile_hash565(const uint16_t *p, int stride, int w, int h);
+
+#ifdef __cplusplus
+}
+#endif
@@ -11,9 +11,50 @@ extern "C" {
 /** Monotonic time since boot (µs). */
 uint64_t timing_now_us(void);
 
+/** How timing_sleep_until_abs_us() waits. */
+typedef enum {
+    /* RTOS delay to within a tick, then esp_rom_delay_us for the rest (up to a full tick of spin). */
+    TIMING_SLEEP_TICK_SPIN = 0,
+    /* One-shot esp_timer notifies the task; only the last final_spin_us are spun. */
+    TIMING_SLEEP_TIMER,
+} timing_sleep_mode_t;
+
+#ifndef TIMING_SLEEP_DEFAULT_MODE
+#define TIMING_SLEEP_DEFAULT_MODE TIMING_SLEEP_TIMER
+#endif
+
+/* Timer mode: wake this early and spin the remainder (covers wake-up latency). */
+#ifndef TIMING_FINAL_SPIN_US
+#define TIMING_FINAL_SPIN_US 30
+#endif
+
+/* Live tasks that hold a timer-mode slot at once (freed when the task is deleted); others use TICK_SPIN. */
+#ifndef TIMING_MAX_SLEEPERS
+#define TIMING_MAX_SLEEPERS 8
+#endif
+
+/* Timer mode wakes on this task-notification index, so slot 0 stays free for the task's own use. */
+#ifndef TIMING_NOTIFY_INDEX
+#define TIMING_NOTIFY_INDEX 1
+#endif
+
+/* TLS pointer holding the task's sleeper slot (index 0 belongs to pthread). */
+#ifndef TIMING_TLS_INDEX
+#define TIMING_TLS_INDEX 1
+#endif
+
+/** Select the sleep mode (all tasks) and the timer mode's final spin bound. */
+void timing_set_sleep_mode(timing_sleep_mode_t mode, uint32_t final_spin_us);
+timing_sleep_mode_t timing_get_sleep_mode(void);
+
+/** Total µs spent busy-waiting inside timing_sleep_* since boot. */
+uint64_t timing_spin_us_total(void);
+
+/** Timer-mode sleeper slots currently held by live tasks. */
+uint32_t timing_sleepers_in_use(void);
+
 /**
- * Sleep until an absolute microsecond deadline.
- * Uses RTOS delay for the coarse part, then a short busy-wait to finish near target.
+ * Sleep until an absolute microsecond deadline, using the current sleep mode.
  *
  * @return true if we actually slept; false if deadline already passed.
  */
@@ -0,0 +1,32 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "util/timing.h"
+
+typedef struct {
+    timing_sleep_mode_t mode;
+    uint32_t samples;
+    uint32_t early;            // wakes before the deadline
+    uint32_t late_p50_us;
+    uint32_t late_p99_us;
+    uint32_t late_max_us;
+    uint32_t spin_us_per_wake; // CPU burned busy-waiting, average
+} timing_jitter_result_t;
+
+/**
+ * Sleep `samples` times on a `period_us` grid with timing_sleep_periodic_us()
+ * in the given mode and measure wake lateness. Restores the previous mode.
+ */
+esp_err_t timing_jitter_run(timing_sleep_mode_t mode, uint32_t period_us, uint32_t samples,
+                            timing_jitter_result_t *out);
+
+/** Run both modes back to back and log them side by side. */
+void timing_jitter_bench(uint32_t period_us, uint32_t samples);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,81 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Compile-time switch (CONFIG_UTIL_TRACE); with 0 every TRACE_* macro compiles to nothing. */
+#ifndef TRACE_ENABLE
+#include "sdkconfig.h"
+#ifdef CONFIG_UTIL_TRACE
+#define TRACE_ENABLE 1
+#else
+#define TRACE_ENABLE 0
+#endif
+#endif
+
+/*
+ * Events kept per core (power of two); older ones are overwritten. The rings
+ * (~24 B per event per core) are allocated by the first trace_start(), PSRAM
+ * first, and kept until reboot.
+ */
+#ifndef TRACE_RING_EVENTS
+#define TRACE_RING_EVENTS 2048
+#endif
+
+typedef enum {
+    TRACE_EV_BEGIN = 0,
+    TRACE_EV_END,
+    TRACE_EV_COUNTER,
+    TRACE_EV_INSTANT,
+} trace_ev_type_t;
+
+/**
+ * Begin recording (clears the rings). Recording is off until this is called.
+ * A no-op when tracing is compiled out or the rings can't be allocated.
+ */
+void trace_start(void);
+void trace_stop(void);
+
+/**
+ * Record one event stamped with timing_now_us() and the current core.
+ * `name` must outlive the export (use string literals). Lock-free and
+ * ISR-safe, except from IRAM ISRs while the cache is off if the rings landed
+ * in PSRAM.
+ */
+void trace_emit(trace_ev_type_t type, const char *name, int32_t value);
+
+/**
+ * Stop recording and print the rings as hex-encoded CBOR lines on stdout:
+ *   TRACE-BEGIN v1 cores=<n> overwritten=<n>
+ *   TRACE <hex of CBOR array of [type, core, t_us, name, value]>   (repeated)
+ *   TRACE-END events=<n>
+ * tools/trace2chrome.py turns a captured log into Chrome trace JSON.
+ */
+void trace_export_console(void);
+
+#if TRACE_ENABLE
+static inline void trace_scope_end_(const char *const *name) { trace_emit(TRACE_EV_END, *name, 0); }
+#define TRACE_CAT2_(a, b) a##b
+#define TRACE_CAT_(a, b)  TRACE_CAT2_(a, b)
+#define TRACE_BEGIN(name)       trace_emit(TRACE_EV_BEGIN, (name), 0)
+#define TRACE_END(name)         trace_emit(TRACE_EV_END, (name), 0)
+#define TRACE_COUNTER(name, v)  trace_emit(TRACE_EV_COUNTER, (name), (int32_t)(v))
+#define TRACE_INSTANT(name)     trace_emit(TRACE_EV_INSTANT, (name), 0)
+/* Begin now, end when the enclosing block exits. */
+#define TRACE_SCOPE(name) \
+    const char *const TRACE_CAT_(trace_scope_, __LINE__) \
+        __attribute__((cleanup(trace_scope_end_), unused)) = (TRACE_BEGIN(name), (name))
+#else
+#define TRACE_BEGIN(name)       ((void)0)
+#define TRACE_END(name)         ((void)0)
+#define TRACE_COUNTER(name, v)  ((void)0)
+#define TRACE_INSTANT(name)     ((void)0)
+#define TRACE_SCOPE(name)       ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,29 @@
+#include "util/anim_clock.h"
+#include <string.h>
+
+void anim_clock_init(anim_clock_t *c, uint32_t step_us, uint32_t max_steps, uint64_t now_us)
+{
+    memset(c, 0, sizeof(*c));
+    c->step_us   = step_us ? step_us : 1;
+    c->max_steps = max_steps ? max_steps : 1;
+    c->last_us   = now_us;
+}
+
+uint32_t anim_clock_advance(anim_clock_t *c, uint64_t now_us)
+{
+    if (now_us > c->last_us) c->acc_us += now_us - c->last_us;
+    c->last_us = now_us;
+    c->frames++;
+
+    uint64_t n = c->acc_us / c->step_us;
+    if (n > c->max_steps) {
+        /* Too far behind: run the cap and forget the rest (keep the phase). */
+        const uint64_t drop = (n - c->max_steps) * c->step_us;
+        c->dropped_us += drop;
+        c->acc_us     -= drop;
+        n = c->max_steps;
+    }
+    c->acc_us -= n * c->step_us;
+    c->steps  += n;
+    return (uint32_t)n;
+}
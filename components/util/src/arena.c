@@ -0,0 +1,194 @@
+#include "util/arena.h"
+
+#include <string.h>
+
+#include "esp_cache.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "util/mem.h"
+
+static const char *TAG = "arena";
+
+/* Floor for alignment when the cache driver reports something smaller. */
+#define ARENA_MIN_ALIGN 64
+
+typedef struct {
+    uint8_t *base;
+    size_t   cap;
+    size_t   lo;        // persistent top (grows up)
+    size_t   hi;        // scratch bottom (grows down from cap)
+    size_t   high_water;
+    uint32_t failures;
+} region_t;
+
+static region_t     s_regions[ARENA_REGION_COUNT];
+static size_t       s_align = ARENA_MIN_ALIGN;
+static bool         s_ready;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static const uint32_t kCaps[ARENA_REGION_COUNT][2] = {
+    [ARENA_INTERNAL_DMA] = { MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT },
+    [ARENA_PSRAM_DMA]    = { MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA,   MALLOC_CAP_SPIRAM },
+};
+
+static inline size_t round_up(size_t v)
+{
+    return (v + s_align - 1) & ~(s_align - 1);
+}
+
+static void note_use(region_t *g)
+{
+    const size_t in_use = g->lo + (g->cap - g->hi);
+    if (in_use > g->high_water) g->high_water = in_use;
+}
+
+esp_err_t arena_init(const arena_cfg_t *cfg)
+{
+    if (s_ready) return ESP_OK;
+    const arena_cfg_t def = ARENA_CFG_DEFAULT();
+    if (!cfg) cfg = &def;
+
+    for (int r = 0; r < ARENA_REGION_COUNT; ++r) {
+        size_t a = 0;
+        if (esp_cache_get_alignment(kCaps[r][0], &a) == ESP_OK && a > s_align) s_align = a;
+    }
+
+    esp_err_t ret = ESP_OK;
+    for (int r = 0; r < ARENA_REGION_COUNT; ++r) {
+        region_t *g = &s_regions[r];
+        const size_t bytes = round_up(cfg->bytes[r]);
+        if (!bytes) continue;
+        g->base = mem_alloc_prefer(MEM_TAG_ARENA, s_align, bytes, kCaps[r], 2);
+        if (!g->base) {
+            ESP_LOGW(TAG, "region %d: could not reserve %u bytes", r, (unsigned)bytes);
+            ret = ESP_ERR_NO_MEM;
+            continue;
+        }
+        g->cap = bytes;
+        g->hi  = bytes;
+    }
+    s_ready = true;
+    ESP_LOGI(TAG, "internal %u B, psram %u B, %u-byte lines",
+             (unsigned)s_regions[ARENA_INTERNAL_DMA].cap,
+             (unsigned)s_regions[ARENA_PSRAM_DMA].cap, (unsigned)s_align);
+    return ret;
+}
+
+size_t arena_align(void)
+{
+    return s_align;
+}
+
+void *arena_alloc(arena_region_t r, size_t bytes)
+{
+    if ((unsigned)r >= ARENA_REGION_COUNT || !bytes) return NULL;
+    region_t *g = &s_regions[r];
+    const size_t n = round_up(bytes);
+    void *p = NULL;
+    portENTER_CRITICAL(&s_lock);
+    if (g->base && g->hi - g->lo >= n) {
+        p = g->base + g->lo;
+        g->lo += n;
+        note_use(g);
+    } else {
+        g->failures++;
+    }
+    portEXIT_CRITICAL(&s_lock);
+    return p;
+}
+
+arena_mark_t arena_mark(arena_region_t r)
+{
+    return ((unsigned)r < ARENA_REGION_COUNT) ? s_regions[r].lo : 0;
+}
+
+void arena_reset_to(arena_region_t r, arena_mark_t m)
+{
+    if ((unsigned)r >= ARENA_REGION_COUNT) return;
+    portENTER_CRITICAL(&s_lock);
+    if (m <= s_regions[r].lo) s_regions[r].lo = m;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void *arena_scratch(arena_region_t r, size_t bytes)
+{
+    if ((unsigned)r >= ARENA_REGION_COUNT || !bytes) return NULL;
+    region_t *g = &s_regions[r];
+    const size_t n = round_up(bytes);
+    void *p = NULL;
+    portENTER_CRITICAL(&s_lock);
+    if (g->base && g->hi - g->lo >= n) {
+        g->hi -= n;
+        p = g->base + g->hi;
+        note_use(g);
+    } else {
+        g->failures++;
+    }
+    portEXIT_CRITICAL(&s_lock);
+    return p;
+}
+
+void arena_frame_begin(arena_frame_t *f)
+{
+    if (!f) return;
+    portENTER_CRITICAL(&s_lock);
+    for (int r = 0; r < ARENA_REGION_COUNT; ++r) f->hi[r] = s_regions[r].hi;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void arena_frame_end(const arena_frame_t *f)
+{
+    if (!f) return;
+    portENTER_CRITICAL(&s_lock);
+    for (int r = 0; r < ARENA_REGION_COUNT; ++r) {
+        region_t *g = &s_regions[r];
+        if (f->hi[r] > g->hi && f->hi[r] <= g->cap) g->hi = f->hi[r];
+    }
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void arena_get_stats(arena_region_t r, arena_stats_t *out)
+{
+    if (!out) return;
+    memset(out, 0, sizeof(*out));
+    if ((unsigned)r >= ARENA_REGION_COUNT) return;
+    const region_t *g = &s_regions[r];
+    portENTER_CRITICAL(&s_lock);
+    *out = (arena_stats_t){
+        .capacity   = g->cap,
+        .used       = g->lo,
+        .scratch    = g->cap - g->hi,
+        .high_water = g->high_water,
+        .failures   = g->failures,
+    };
+    portEXIT_CRITICAL(&s_lock);
+}
+
+/* Widen to whole lines; arena blocks are padded, so this never touches a neighbour. */
+static void line_span(const void *buf, size_t bytes, void **start, size_t *len)
+{
+    const uintptr_t a = (uintptr_t)buf & ~(uintptr_t)(s_align - 1);
+    const uintptr_t e = ((uintptr_t)buf + bytes + s_align - 1) & ~(uintptr_t)(s_align - 1);
+    *start = (void *)a;
+    *len   = e - a;
+}
+
+esp_err_t arena_cache_writeback(const void *buf, size_t bytes)
+{
+    if (!buf || !bytes) return ESP_ERR_INVALID_ARG;
+    void *a; size_t n;
+    line_span(buf, bytes, &a, &n);
+    const esp_err_t err = esp_cache_msync(a, n, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_TYPE_DATA);
+    /* Uncached (e.g. plain internal RAM on some targets): nothing to do. */
+    return err == ESP_ERR_INVALID_ARG ? ESP_OK : err;
+}
+
+esp_err_t arena_cache_invalidate(void *buf, size_t bytes)
+{
+    if (!buf || !bytes) return ESP_ERR_INVALID_ARG;
+    void *a; size_t n;
+    line_span(buf, bytes, &a, &n);
+    const esp_err_t err = esp_cache_msync(a, n, ESP_CACHE_MSYNC_FLAG_DIR_M2C | ESP_CACHE_MSYNC_FLAG_TYPE_DATA);
+    return err == ESP_ERR_INVALID_ARG ? ESP_OK : err;
+}
@@ -0,0 +1,115 @@
+#include "util/boot_graph.h"
+
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "util/timing.h"
+#include "util/trace.h"
+
+static const char *TAG = "boot_graph";
+
+typedef struct {
+    const boot_stage_t *stages;
+    boot_report_t      *report;
+    void               *ctx;
+    int                 index;
+} stage_arg_t;
+
+/* Created once and never deleted: a finishing task may still be inside
+ * xEventGroupSetBits() when the waiter wakes. */
+static EventGroupHandle_t s_done;
+static stage_arg_t        s_args[BOOT_GRAPH_MAX_STAGES];
+
+static bool deps_ok(const boot_report_t *r, uint32_t deps)
+{
+    for (int i = 0; deps; ++i, deps >>= 1) {
+        if ((deps & 1) && r->stage[i].status != BOOT_STAGE_OK) return false;
+    }
+    return true;
+}
+
+static void run_stage(stage_arg_t *a)
+{
+    const boot_stage_t  *s = &a->stages[a->index];
+    boot_stage_result_t *r = &a->report->stage[a->index];
+
+    if (s->deps) xEventGroupWaitBits(s_done, s->deps, pdFALSE, pdTRUE, portMAX_DELAY);
+
+    r->core     = (int)xPortGetCoreID();
+    r->start_us = timing_now_us();
+    if (!deps_ok(a->report, s->deps)) {
+        r->status = BOOT_STAGE_SKIPPED;
+    } else {
+        TRACE_BEGIN(s->name);
+        r->err = s->fn(a->ctx);
+        TRACE_END(s->name);
+        r->status = (r->err == ESP_OK) ? BOOT_STAGE_OK : BOOT_STAGE_FAILED;
+    }
+    r->end_us = timing_now_us();
+    xEventGroupSetBits(s_done, BOOT_DEP(a->index));
+}
+
+static void stage_task(void *arg)
+{
+    run_stage((stage_arg_t *)arg);
+    vTaskDelete(NULL);
+}
+
+esp_err_t boot_graph_run(const boot_stage_t *stages, int n, void *ctx, boot_report_t *out)
+{
+    ESP_RETURN_ON_FALSE(stages && out && n > 0 && n <= BOOT_GRAPH_MAX_STAGES,
+                        ESP_ERR_INVALID_ARG, TAG, "bad args");
+    for (int i = 0; i < n; ++i) {
+        ESP_RETURN_ON_FALSE(stages[i].fn && (stages[i].deps >> i) == 0, ESP_ERR_INVALID_ARG, TAG,
+                            "stage %d '%s': missing fn or dep on a later stage", i,
+                            stages[i].name ? stages[i].name : "?");
+    }
+    if (!s_done) {
+        s_done = xEventGroupCreate();
+        ESP_RETURN_ON_FALSE(s_done, ESP_ERR_NO_MEM, TAG, "event group");
+    }
+    xEventGroupClearBits(s_done, BOOT_DEP(BOOT_GRAPH_MAX_STAGES) - 1);
+
+    *out = (boot_report_t){ .t0_us = timing_now_us() };
+    const UBaseType_t prio = uxTaskPriorityGet(NULL);
+    for (int i = 0; i < n; ++i) {
+        s_args[i] = (stage_arg_t){ .stages = stages, .report = out, .ctx = ctx, .index = i };
+        const uint32_t stack = stages[i].stack_bytes ? stages[i].stack_bytes : BOOT_GRAPH_STACK_DEFAULT;
+        if (xTaskCreate(stage_task, stages[i].name, stack, &s_args[i], prio, NULL) != pdPASS) {
+            // No task: run it here instead (waits for its deps like any other stage).
+            ESP_LOGW(TAG, "'%s': no task, running inline", stages[i].name);
+            run_stage(&s_args[i]);
+        }
+    }
+
+    xEventGroupWaitBits(s_done, BOOT_DEP(n) - 1, pdFALSE, pdTRUE, portMAX_DELAY);
+    for (int i = 0; i < n; ++i) {
+        if (out->stage[i].end_us > out->t1_us) out->t1_us = out->stage[i].end_us;
+    }
+    return ESP_OK;
+}
+
+void boot_graph_log(const boot_stage_t *stages, int n, const boot_report_t *r)
+{
+    static const char *const kStatus[] = { "pending", "ok", "FAILED", "skipped" };
+    if (!stages || !r) return;
+
+    uint64_t serial_us = 0;
+    ESP_LOGI(TAG, "%-10s %8s %8s %8s  core  status", "stage", "start", "end", "dur");
+    for (int i = 0; i < n && i < BOOT_GRAPH_MAX_STAGES; ++i) {
+        const boot_stage_result_t *s = &r->stage[i];
+        const uint64_t dur = s->end_us - s->start_us;
+        serial_us += dur;
+        ESP_LOGI(TAG, "%-10s %8llu %8llu %8llu  %4d  %s%s%s", stages[i].name,
+                 (unsigned long long)s->start_us, (unsigned long long)s->end_us,
+                 (unsigned long long)dur, s->core, kStatus[s->status],
+                 s->status == BOOT_STAGE_FAILED ? ": " : "",
+                 s->status == BOOT_STAGE_FAILED ? esp_err_to_name(s->err) : "");
+    }
+    ESP_LOGI(TAG, "graph %llu us (stages back-to-back would be %llu us), done at %llu us since app start",
+             (unsigned long long)(r->t1_us - r->t0_us), (unsigned long long)serial_us,
+             (unsigned long long)r->t1_us);
+}
@@ -0,0 +1,84 @@
+#include "util/dirty_rect.h"
+
+static inline int imin(int a, int b) { return a < b ? a : b; }
+static inline int imax(int a, int b) { return a > b ? a : b; }
+
+static inline int64_t area(const dirty_rect_t *r)
+{
+    return (int64_t)(r->x1 - r->x0) * (int64_t)(r->y1 - r->y0);
+}
+
+static inline dirty_rect_t unite(const dirty_rect_t *a, const dirty_rect_t *b)
+{
+    return (dirty_rect_t){ imin(a->x0, b->x0), imin(a->y0, b->y0),
+                           imax(a->x1, b->x1), imax(a->y1, b->y1) };
+}
+
+static inline int near(const dirty_rect_t *a, const dirty_rect_t *b, int slop)
+{
+    return a->x0 < b->x1 + slop && b->x0 < a->x1 + slop &&
+           a->y0 < b->y1 + slop && b->y0 < a->y1 + slop;
+}
+
+static inline void remove_at(dirty_rects_t *d, int i)
+{
+    d->r[i] = d->r[--d->n];
+}
+
+void dirty_rects_reset(dirty_rects_t *d, int slop)
+{
+    d->n    = 0;
+    d->slop = slop;
+}
+
+void dirty_rects_add(dirty_rects_t *d, int x0, int y0, int x1, int y1)
+{
+    if (x1 <= x0 || y1 <= y0) return;
+    dirty_rect_t r = { x0, y0, x1, y1 };
+
+    /* Absorb neighbours until r touches none; a grown r can reach new ones. */
+    for (;;) {
+        int i = 0;
+        while (i < d->n) {
+            if (near(&r, &d->r[i], d->slop)) {
+                r = unite(&r, &d->r[i]);
+                remove_at(d, i);
+                i = 0;
+            } else {
+                ++i;
+            }
+        }
+        if (d->n < DIRTY_RECTS_MAX) break;
+
+        /* Full: fold into whichever rect grows the pushed area least, then rescan. */
+        int     best = 0;
+        int64_t best_cost = INT64_MAX;
+        for (i = 0; i < d->n; ++i) {
+            const dirty_rect_t u = unite(&r, &d->r[i]);
+            const int64_t cost = area(&u) - area(&d->r[i]) - area(&r);
+            if (cost < best_cost) { best_cost = cost; best = i; }
+        }
+        r = unite(&r, &d->r[best]);
+        remove_at(d, best);
+    }
+    d->r[d->n++] = r;
+}
+
+void dirty_rects_clip(dirty_rects_t *d, int W, int H)
+{
+    int i = 0;
+    while (i < d->n) {
+        dirty_rect_t *r = &d->r[i];
+        r->x0 = imax(r->x0, 0); r->y0 = imax(r->y0, 0);
+        r->x1 = imin(r->x1, W); r->y1 = imin(r->y1, H);
+        if (r->x1 <= r->x0 || r->y1 <= r->y0) remove_at(d, i);
+        else ++i;
+    }
+}
+
+uint32_t dirty_rects_area(const dirty_rects_t *d)
+{
+    uint32_t px = 0;
+    for (int i = 0; i < d->n; ++i) px += (uint32_t)area(&d->r[i]);
+    return px;
+}
@@ -1,10 +1,18 @@
 #include "util/fb.h"
+#include "util/mem.h"
 #include "esp_heap_caps.h"
 
 void *util_malloc_psram_dma(size_t bytes)
 {
-    void *p = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA);
-    if (!p) p = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
-    if (!p) p = heap_caps_malloc(bytes, MALLOC_CAP_DEFAULT);
-    return p;
+    static const uint32_t kCaps[] = {
+        MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA,
+        MALLOC_CAP_SPIRAM,
+        MALLOC_CAP_DEFAULT,
+    };
+    return mem_alloc_prefer(MEM_TAG_FB, 0, bytes, kCaps, sizeof(kCaps) / sizeof(kCaps[0]));
+}
+
+void util_free_psram_dma(void *p)
+{
+    mem_free(MEM_TAG_FB, p);
 }
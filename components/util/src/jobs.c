@@ -0,0 +1,211 @@
+#include "util/jobs.h"
+
+#include <stdatomic.h>
+#include <string.h>
+
+#include "esp_check.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+static const char *TAG = "jobs";
+
+#define JOBS_CORES portNUM_PROCESSORS
+
+typedef struct {
+    int y0, y1;
+} chunk_t;
+
+/*
+ * Per-core deque. The owning core pops from the bottom (most recently pushed,
+ * still warm); other cores steal from the top. Critical sections are a few
+ * instructions long, so a spinlock beats anything cleverer here.
+ */
+typedef struct {
+    portMUX_TYPE lock;
+    chunk_t      items[JOBS_DEQUE_CAP];
+    int          top, bottom;    // valid items are [top, bottom)
+} deque_t;
+
+typedef struct {
+    TaskHandle_t      workers[JOBS_CORES];
+    deque_t           dq[JOBS_CORES];
+    SemaphoreHandle_t batch_lock;   // one batch in flight
+    SemaphoreHandle_t done;         // given by the worker that finishes a batch's last chunk
+    bool              ready;
+
+    /* current batch (published before workers are notified) */
+    jobs_rows_fn_t    fn;
+    void             *arg;
+    atomic_int        remaining;
+
+    /* Inline calls come from any task, so every counter is atomic. */
+    atomic_uint       chunks, steals;
+    atomic_uint       batches, inline_calls;
+} jobs_t;
+
+static jobs_t s_jobs;
+
+static bool dq_pop(deque_t *q, chunk_t *out)
+{
+    bool ok = false;
+    portENTER_CRITICAL(&q->lock);
+    if (q->bottom > q->top) {
+        *out = q->items[--q->bottom];
+        ok = true;
+    }
+    portEXIT_CRITICAL(&q->lock);
+    return ok;
+}
+
+static bool dq_steal(deque_t *q, chunk_t *out)
+{
+    bool ok = false;
+    portENTER_CRITICAL(&q->lock);
+    if (q->bottom > q->top) {
+        *out = q->items[q->top++];
+        ok = true;
+    }
+    portEXIT_CRITICAL(&q->lock);
+    return ok;
+}
+
+/* Own deque first, then the others. */
+static bool take_chunk(int core, chunk_t *out)
+{
+    if (dq_pop(&s_jobs.dq[core], out)) return true;
+    for (int i = 1; i < JOBS_CORES; ++i) {
+        if (dq_steal(&s_jobs.dq[(core + i) % JOBS_CORES], out)) {
+            atomic_fetch_add_explicit(&s_jobs.steals, 1, memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Run chunks until none are left; true if this call finished the batch's last one. */
+static bool drain(int core)
+{
+    bool finished = false;
+    chunk_t c;
+    while (take_chunk(core, &c)) {
+        s_jobs.fn(c.y0, c.y1, s_jobs.arg);
+        atomic_fetch_add_explicit(&s_jobs.chunks, 1, memory_order_relaxed);
+        if (atomic_fetch_sub_explicit(&s_jobs.remaining, 1, memory_order_acq_rel) == 1) finished = true;
+    }
+    return finished;
+}
+
+static void worker_task(void *arg)
+{
+    const int core = (int)(intptr_t)arg;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (drain(core)) xSemaphoreGive(s_jobs.done);
+    }
+}
+
+esp_err_t jobs_init(const jobs_cfg_t *cfg)
+{
+    if (s_jobs.ready) return ESP_OK;
+    const jobs_cfg_t def = JOBS_CFG_DEFAULT();
+    if (!cfg) cfg = &def;
+
+    for (int i = 0; i < JOBS_CORES; ++i) {
+        portMUX_INITIALIZE(&s_jobs.dq[i].lock);
+    }
+    s_jobs.batch_lock = xSemaphoreCreateMutex();
+    s_jobs.done       = xSemaphoreCreateBinary();
+    ESP_RETURN_ON_FALSE(s_jobs.batch_lock && s_jobs.done, ESP_ERR_NO_MEM, TAG, "semaphores");
+
+    for (int i = 0; i < JOBS_CORES; ++i) {
+        char name[12] = "jobs0";
+        name[4] = (char)('0' + i);
+        ESP_RETURN_ON_FALSE(xTaskCreatePinnedToCore(worker_task, name, cfg->stack_bytes,
+                                                    (void *)(intptr_t)i, cfg->priority,
+                                                    &s_jobs.workers[i], i) == pdPASS,
+                            ESP_ERR_NO_MEM, TAG, "worker %d", i);
+    }
+    s_jobs.ready = true;
+    ESP_LOGI(TAG, "%d workers up (prio %d)", JOBS_CORES, cfg->priority);
+    return ESP_OK;
+}
+
+bool jobs_ready(void)
+{
+    return s_jobs.ready;
+}
+
+static bool in_worker(void)
+{
+    const TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    for (int i = 0; i < JOBS_CORES; ++i) {
+        if (s_jobs.workers[i] == self) return true;
+    }
+    return false;
+}
+
+void parallel_for_rows(int y0, int y1, int grain, jobs_rows_fn_t fn, void *arg)
+{
+    if (y1 <= y0 || !fn) return;
+    const int rows = y1 - y0;
+
+    if (!s_jobs.ready || rows < JOBS_MIN_ROWS || in_worker() ||
+        xSemaphoreTake(s_jobs.batch_lock, 0) != pdTRUE) {
+        atomic_fetch_add_explicit(&s_jobs.inline_calls, 1, memory_order_relaxed);
+        fn(y0, y1, arg);
+        return;
+    }
+
+    /* Auto grain: a few chunks per core so a late starter can still steal. */
+    if (grain <= 0) grain = (rows + JOBS_CORES * 4 - 1) / (JOBS_CORES * 4);
+    if (grain < JOBS_MIN_ROWS / 2) grain = JOBS_MIN_ROWS / 2;
+    int n = (rows + grain - 1) / grain;
+    if (n > JOBS_CORES * JOBS_DEQUE_CAP) {
+        n = JOBS_CORES * JOBS_DEQUE_CAP;
+        grain = (rows + n - 1) / n;
+        n = (rows + grain - 1) / grain;
+    }
+
+    s_jobs.fn  = fn;
+    s_jobs.arg = arg;
+    atomic_store_explicit(&s_jobs.remaining, n, memory_order_relaxed);
+
+    /* Deal contiguous blocks to each core so neighbouring rows stay on one cache. */
+    int c = 0;
+    for (int core = 0; core < JOBS_CORES; ++core) {
+        deque_t *q = &s_jobs.dq[core];
+        const int share = n / JOBS_CORES + (core < n % JOBS_CORES ? 1 : 0);
+        portENTER_CRITICAL(&q->lock);
+        q->top = q->bottom = 0;
+        for (int k = 0; k < share; ++k, ++c) {
+            const int a = y0 + c * grain;
+            q->items[q->bottom++] = (chunk_t){ a, a + grain < y1 ? a + grain : y1 };
+        }
+        portEXIT_CRITICAL(&q->lock);
+    }
+    atomic_thread_fence(memory_order_release);
+
+    const int me = (int)xPortGetCoreID();
+    for (int core = 0; core < JOBS_CORES; ++core) {
+        if (core != me) xTaskNotifyGive(s_jobs.workers[core]);
+    }
+
+    /* Help out; if a worker ran the last chunk, wait for its signal. */
+    if (!drain(me)) xSemaphoreTake(s_jobs.done, portMAX_DELAY);
+
+    atomic_fetch_add_explicit(&s_jobs.batches, 1, memory_order_relaxed);
+    xSemaphoreGive(s_jobs.batch_lock);
+}
+
+void jobs_get_stats(jobs_stats_t *out)
+{
+    if (!out) return;
+    *out = (jobs_stats_t){
+        .batches      = atomic_load(&s_jobs.batches),
+        .inline_calls = atomic_load(&s_jobs.inline_calls),
+        .chunks       = atomic_load(&s_jobs.chunks),
+        .steals       = atomic_load(&s_jobs.steals),
+    };
+}
@@ -0,0 +1,40 @@
+#include "util/latency.h"
+#include <string.h>
+
+void latency_hist_reset(latency_hist_t *h)
+{
+    if (h) memset(h, 0, sizeof(*h));
+}
+
+void latency_hist_add(latency_hist_t *h, uint32_t us)
+{
+    h->samples[h->head] = us;
+    h->head = (h->head + 1) % LATENCY_HIST_WINDOW;
+    if (h->filled < LATENCY_HIST_WINDOW) h->filled++;
+    h->total++;
+}
+
+void latency_hist_summary(const latency_hist_t *h, latency_summary_t *out)
+{
+    if (!out) return;
+    memset(out, 0, sizeof(*out));
+    if (!h || h->filled == 0) return;
+
+    /* Insertion sort on a copy: the window is small and this runs off the hot path. */
+    uint32_t v[LATENCY_HIST_WINDOW];
+    const uint32_t n = h->filled;
+    memcpy(v, h->samples, n * sizeof(v[0]));
+    for (uint32_t i = 1; i < n; ++i) {
+        const uint32_t key = v[i];
+        uint32_t j = i;
+        while (j > 0 && v[j - 1] > key) { v[j] = v[j - 1]; --j; }
+        v[j] = key;
+    }
+
+    out->count  = n;
+    out->total  = h->total;
+    out->min_us = v[0];
+    out->p50_us = v[(n - 1) / 2];
+    out->p95_us = v[((n - 1) * 95) / 100];
+    out->max_us = v[n - 1];
+}
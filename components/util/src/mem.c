@@ -0,0 +1,193 @@
+#include "util/mem.h"
+
+#include <stdbool.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "esp_log.h"
+
+static const char *TAG = "mem";
+
+static const char *const kTagNames[MEM_TAG_COUNT] = {
+    [MEM_TAG_FB]      = "fb",
+    [MEM_TAG_ARENA]   = "arena",
+    [MEM_TAG_DISPLAY] = "display",
+    [MEM_TAG_TOUCH]   = "touch",
+    [MEM_TAG_UI_GFX]  = "ui_gfx",
+    [MEM_TAG_DEMOS]   = "demos",
+    [MEM_TAG_IMAGE]   = "image",
+    [MEM_TAG_LVGL]    = "lvgl",
+    [MEM_TAG_UTIL]    = "util",
+    [MEM_TAG_MAIN]    = "main",
+};
+
+static const char *const kClassNames[MEM_CLASS_COUNT] = { "internal", "spiram", "dma" };
+
+static mem_stats_t s_stats[MEM_TAG_COUNT][MEM_CLASS_COUNT];
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static bool s_hooked;
+
+/* Last heap failure seen by the IDF hook (tagged or not). */
+static volatile uint32_t s_heap_failures;
+static volatile size_t   s_last_fail_bytes;
+static volatile uint32_t s_last_fail_caps;
+
+static void on_heap_failure(size_t size, uint32_t caps, const char *function_name)
+{
+    // May run with heap locks held or from an ISR: record only, report later.
+    s_heap_failures++;
+    s_last_fail_bytes = size;
+    s_last_fail_caps  = caps;
+}
+
+esp_err_t mem_init(void)
+{
+    if (s_hooked) return ESP_OK;
+    const esp_err_t err = heap_caps_register_failed_alloc_callback(on_heap_failure);
+    if (err == ESP_OK) s_hooked = true;
+    return err;
+}
+
+static inline bool tag_ok(mem_tag_t tag)
+{
+    return (unsigned)tag < MEM_TAG_COUNT;
+}
+
+static void account(mem_tag_t tag, mem_class_t cls, size_t bytes, bool alloc)
+{
+    mem_stats_t *s = &s_stats[tag][cls];
+    if (alloc) {
+        s->live_bytes += bytes;
+        s->allocs++;
+        if (s->live_bytes > s->peak_bytes) s->peak_bytes = s->live_bytes;
+    } else {
+        s->live_bytes = (s->live_bytes > bytes) ? s->live_bytes - bytes : 0;
+        s->frees++;
+    }
+}
+
+/* Class by where the block landed, so alloc and free always agree. */
+static void track(mem_tag_t tag, void *p, bool alloc)
+{
+    const size_t bytes = heap_caps_get_allocated_size(p);
+    const bool ext = esp_ptr_external_ram(p);
+    const bool dma = ext ? esp_ptr_dma_ext_capable(p) : esp_ptr_dma_capable(p);
+
+    portENTER_CRITICAL(&s_lock);
+    account(tag, ext ? MEM_CLASS_SPIRAM : MEM_CLASS_INTERNAL, bytes, alloc);
+    if (dma) account(tag, MEM_CLASS_DMA, bytes, alloc);
+    portEXIT_CRITICAL(&s_lock);
+}
+
+static void *done(mem_tag_t tag, void *p, size_t bytes, uint32_t caps)
+{
+    if (p) {
+        track(tag, p, true);
+        return p;
+    }
+    portENTER_CRITICAL(&s_lock);
+    s_stats[tag][(caps & MALLOC_CAP_SPIRAM) ? MEM_CLASS_SPIRAM : MEM_CLASS_INTERNAL].failures++;
+    if (caps & MALLOC_CAP_DMA) s_stats[tag][MEM_CLASS_DMA].failures++;
+    portEXIT_CRITICAL(&s_lock);
+
+    ESP_LOGE(TAG, "%s: %u bytes (caps 0x%08lx) failed", kTagNames[tag],
+             (unsigned)bytes, (unsigned long)caps);
+    mem_dump();
+    return NULL;
+}
+
+void *mem_malloc(mem_tag_t tag, size_t bytes, uint32_t caps)
+{
+    if (!tag_ok(tag)) return NULL;
+    return done(tag, heap_caps_malloc(bytes, caps), bytes, caps);
+}
+
+void *mem_try_malloc(mem_tag_t tag, size_t bytes, uint32_t caps)
+{
+    if (!tag_ok(tag)) return NULL;
+    void *p = heap_caps_malloc(bytes, caps);
+    if (p) track(tag, p, true);
+    return p;
+}
+
+void *mem_calloc(mem_tag_t tag, size_t n, size_t size, uint32_t caps)
+{
+    if (!tag_ok(tag)) return NULL;
+    return done(tag, heap_caps_calloc(n, size, caps), n * size, caps);
+}
+
+void *mem_aligned_alloc(mem_tag_t tag, size_t align, size_t bytes, uint32_t caps)
+{
+    if (!tag_ok(tag)) return NULL;
+    return done(tag, heap_caps_aligned_alloc(align, bytes, caps), bytes, caps);
+}
+
+void *mem_alloc_prefer(mem_tag_t tag, size_t align, size_t bytes, const uint32_t *caps, int n)
+{
+    if (!tag_ok(tag) || !caps || n <= 0) return NULL;
+    void *p = NULL;
+    for (int i = 0; i < n && !p; ++i) {
+        p = align ? heap_caps_aligned_alloc(align, bytes, caps[i]) : heap_caps_malloc(bytes, caps[i]);
+    }
+    return done(tag, p, bytes, caps[n - 1]);
+}
+
+void mem_free(mem_tag_t tag, void *p)
+{
+    if (!p) return;
+    if (tag_ok(tag)) track(tag, p, false);
+    heap_caps_free(p);
+}
+
+void mem_get_stats(mem_tag_t tag, mem_class_t cls, mem_stats_t *out)
+{
+    if (!out) return;
+    if (!tag_ok(tag) || (unsigned)cls >= MEM_CLASS_COUNT) {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+    portENTER_CRITICAL(&s_lock);
+    *out = s_stats[tag][cls];
+    portEXIT_CRITICAL(&s_lock);
+}
+
+const char *mem_tag_name(mem_tag_t tag)
+{
+    return tag_ok(tag) ? kTagNames[tag] : "?";
+}
+
+void mem_dump(void)
+{
+    mem_stats_t snap[MEM_TAG_COUNT][MEM_CLASS_COUNT];
+    portENTER_CRITICAL(&s_lock);
+    memcpy(snap, s_stats, sizeof(snap));
+    portEXIT_CRITICAL(&s_lock);
+
+    ESP_LOGI(TAG, "%-8s %-8s %10s %10s %7s %7s %5s", "tag", "class", "live", "peak", "allocs", "frees", "fail");
+    for (int t = 0; t < MEM_TAG_COUNT; ++t) {
+        for (int k = 0; k < MEM_CLASS_COUNT; ++k) {
+            const mem_stats_t *s = &snap[t][k];
+            if (!s->allocs && !s->failures) continue;
+            ESP_LOGI(TAG, "%-8s %-8s %10u %10u %7lu %7lu %5lu", kTagNames[t], kClassNames[k],
+                     (unsigned)s->live_bytes, (unsigned)s->peak_bytes,
+                     (unsigned long)s->allocs, (unsigned long)s->frees, (unsigned long)s->failures);
+        }
+    }
+
+    static const struct { const char *name; uint32_t caps; } kHeaps[] = {
+        { "internal", MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT },
+        { "spiram",   MALLOC_CAP_SPIRAM },
+        { "dma",      MALLOC_CAP_DMA },
+    };
+    for (size_t i = 0; i < sizeof(kHeaps) / sizeof(kHeaps[0]); ++i) {
+        ESP_LOGI(TAG, "heap %-8s free %u, min free %u, largest %u", kHeaps[i].name,
+                 (unsigned)heap_caps_get_free_size(kHeaps[i].caps),
+                 (unsigned)heap_caps_get_minimum_free_size(kHeaps[i].caps),
+                 (unsigned)heap_caps_get_largest_free_block(kHeaps[i].caps));
+    }
+    if (s_heap_failures) {
+        ESP_LOGW(TAG, "heap misses %lu incl. caps fallbacks (last %u bytes, caps 0x%08lx)", (unsigned long)s_heap_failures,
+                 (unsigned)s_last_fail_bytes, (unsigned long)s_last_fail_caps);
+    }
+}
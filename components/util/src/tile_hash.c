@@ -0,0 +1,56 @@
+#include "util/tile_hash.h"
+
+#include <stddef.h>
+
+#define P1 0x9E3779B1u
+#define P2 0x85EBCA77u
+#define P3 0xC2B2AE3Du
+
+static inline uint32_t rotl(uint32_t x, int r)
+{
+    return (x << r) | (x >> (32 - r));
+}
+
+static inline uint32_t round32(uint32_t acc, uint32_t in)
+{
+    return rotl(acc + in * P2, 13) * P1;
+}
+
+uint32_t tile_hash565(const uint16_t *p, int stride, int w, int h)
+{
+    if (!p || w <= 0 || h <= 0) return 0;
+    uint32_t v1 = P1 + P2, v2 = P2, v3 = 0, v4 = 0u - P1;
+
+    if (((uintptr_t)p & 3u) == 0 && (stride & 1) == 0) {
+        const int words = w / 2;
+        for (int y = 0; y < h; ++y) {
+            const uint32_t *q = (const uint32_t *)(p + (size_t)y * stride);
+            int i = 0;
+            for (; i + 4 <= words; i += 4) {
+                v1 = round32(v1, q[i]);
+                v2 = round32(v2, q[i + 1]);
+                v3 = round32(v3, q[i + 2]);
+                v4 = round32(v4, q[i + 3]);
+            }
+            for (; i < words; ++i) v1 = round32(v1, q[i]);
+            if (w & 1) v2 = round32(v2, p[(size_t)y * stride + w - 1]);
+        }
+    } else {
+        for (int y = 0; y < h; ++y) {
+            const uint16_t *q = p + (size_t)y * stride;
+            int i = 0;
+            for (; i + 2 <= w; i += 2) {
+                v1 = round32(v1, q[i]);
+                v2 = round32(v2, q[i + 1]);
+            }
+            if (i < w) v3 = round32(v3, q[i]);
+        }
+    }
+
+    uint32_t x = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+    x += (uint32_t)(w * h) * 2u;
+    x ^= x >> 15; x *= P2;
+    x ^= x >> 13; x *= P3;
+    x ^= x >> 16;
+    return x;
+}
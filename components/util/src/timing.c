@@ -1,18 +1,136 @@
 #include "util/timing.h"
+#include "esp_attr.h"
 #include "esp_timer.h"
 #include "esp_rom_sys.h"
+#include "sdkconfig.h"
+
+/* ISR dispatch skips the esp_timer task hop (needs CONFIG_ESP_TIMER_SUPPORTS_ISR_DISPATCH_METHOD). */
+#if CONFIG_ESP_TIMER_SUPPORTS_ISR_DISPATCH_METHOD
+#define TIMING_TIMER_DISPATCH ESP_TIMER_ISR
+#else
+#define TIMING_TIMER_DISPATCH ESP_TIMER_TASK
+#endif
+
+#if TIMING_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES
+#error "TIMING_NOTIFY_INDEX needs CONFIG_FREERTOS_TASK_NOTIFICATION_ARRAY_ENTRIES > TIMING_NOTIFY_INDEX"
+#endif
+#if TIMING_TLS_INDEX >= configNUM_THREAD_LOCAL_STORAGE_POINTERS
+#error "TIMING_TLS_INDEX needs CONFIG_FREERTOS_THREAD_LOCAL_STORAGE_POINTERS > TIMING_TLS_INDEX"
+#endif
+
+/*
+ * One lazily created one-shot per sleeping task; the callback wakes that task.
+ * The slot hangs off the task's TLS pointer and is given back when it is deleted.
+ */
+typedef struct {
+    TaskHandle_t       task;
+    esp_timer_handle_t timer;
+} sleeper_t;
+
+static sleeper_t           s_sleepers[TIMING_MAX_SLEEPERS];
+static portMUX_TYPE        s_sleepers_lock = portMUX_INITIALIZER_UNLOCKED;
+static timing_sleep_mode_t s_mode = TIMING_SLEEP_DEFAULT_MODE;
+static uint32_t            s_final_spin_us = TIMING_FINAL_SPIN_US;
+static uint64_t            s_spin_us_total;
 
 uint64_t timing_now_us(void)
 {
     return (uint64_t)esp_timer_get_time();
 }
 
-static inline uint64_t now_ms_from_us(uint64_t us)
+void timing_set_sleep_mode(timing_sleep_mode_t mode, uint32_t final_spin_us)
 {
-    return us / 1000ULL;
+    s_mode = mode;
+    s_final_spin_us = final_spin_us;
 }
 
-bool timing_sleep_until_abs_us(uint64_t deadline_us)
+timing_sleep_mode_t timing_get_sleep_mode(void)
+{
+    return s_mode;
+}
+
+uint64_t timing_spin_us_total(void)
+{
+    return s_spin_us_total;
+}
+
+uint32_t timing_sleepers_in_use(void)
+{
+    uint32_t n = 0;
+    portENTER_CRITICAL(&s_sleepers_lock);
+    for (int i = 0; i < TIMING_MAX_SLEEPERS; ++i) n += s_sleepers[i].task != NULL;
+    portEXIT_CRITICAL(&s_sleepers_lock);
+    return n;
+}
+
+static void spin_us(int64_t us)
+{
+    if (us <= 0) return;
+    if (us > (int64_t)UINT32_MAX) us = (int64_t)UINT32_MAX;
+    esp_rom_delay_us((uint32_t)us);
+    s_spin_us_total += (uint64_t)us;
+}
+
+static void IRAM_ATTR wake_cb(void *arg)
+{
+#if CONFIG_ESP_TIMER_SUPPORTS_ISR_DISPATCH_METHOD
+    BaseType_t hp = pdFALSE;
+    vTaskNotifyGiveIndexedFromISR((TaskHandle_t)arg, TIMING_NOTIFY_INDEX, &hp);
+    if (hp) esp_timer_isr_dispatch_need_yield();
+#else
+    (void)xTaskNotifyGiveIndexed((TaskHandle_t)arg, TIMING_NOTIFY_INDEX);
+#endif
+}
+
+/* TLS deletion callback: runs as the owning task is deleted. */
+static void release_sleeper(int index, void *p)
+{
+    sleeper_t *s = p;
+    if (!s) return;
+    if (s->timer) {
+        (void)esp_timer_stop(s->timer);
+        (void)esp_timer_delete(s->timer);
+    }
+    portENTER_CRITICAL(&s_sleepers_lock);
+    s->timer = NULL;
+    s->task = NULL;
+    portEXIT_CRITICAL(&s_sleepers_lock);
+}
+
+/* Timer owned by the calling task, created on first use; NULL when the table is full. */
+static esp_timer_handle_t sleeper_timer(void)
+{
+    const sleeper_t *own = pvTaskGetThreadLocalStoragePointer(NULL, TIMING_TLS_INDEX);
+    if (own) return own->timer;
+
+    const TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    sleeper_t *slot = NULL;
+    portENTER_CRITICAL(&s_sleepers_lock);
+    for (int i = 0; i < TIMING_MAX_SLEEPERS; ++i) {
+        if (!s_sleepers[i].task) {
+            slot = &s_sleepers[i];
+            slot->task = self;  // claim before leaving the lock
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&s_sleepers_lock);
+    if (!slot) return NULL;
+
+    const esp_timer_create_args_t args = {
+        .callback        = wake_cb,
+        .arg             = self,
+        .dispatch_method = TIMING_TIMER_DISPATCH,
+        .name            = "timing_sleep",
+    };
+    if (esp_timer_create(&args, &slot->timer) != ESP_OK) {
+        release_sleeper(TIMING_TLS_INDEX, slot);
+        return NULL;
+    }
+    vTaskSetThreadLocalStoragePointerAndDelCallback(NULL, TIMING_TLS_INDEX, slot, release_sleeper);
+    return slot->timer;
+}
+
+static bool sleep_tick_spin(uint64_t deadline_us)
 {
     int64_t now = (int64_t)esp_timer_get_time();
     int64_t remain = (int64_t)deadline_us - now;
@@ -31,13 +149,45 @@ bool timing_sleep_until_abs_us(uint64_t deadline_us)
     }
 
     // Short busy-wait to land near the target
-    if (remain > 0) {
-        if (remain > (int64_t)UINT32_MAX) remain = (int64_t)UINT32_MAX;
-        esp_rom_delay_us((uint32_t)remain);
+    spin_us(remain);
+    return true;
+}
+
+static bool sleep_timer(uint64_t deadline_us, esp_timer_handle_t timer)
+{
+    int64_t remain = (int64_t)deadline_us - (int64_t)esp_timer_get_time();
+    if (remain <= 0) return false;
+
+    const int64_t spin = s_final_spin_us;
+    (void)ulTaskNotifyTakeIndexed(TIMING_NOTIFY_INDEX, pdTRUE, 0);  // drop a wake left over from a stopped timer
+    while (remain > spin) {
+        if (esp_timer_start_once(timer, (uint64_t)(remain - spin)) != ESP_OK) {
+            return sleep_tick_spin(deadline_us);
+        }
+        // Bounded wait: a lost wake costs at most one extra tick past the deadline.
+        const TickType_t guard = (TickType_t)(remain / (1000000LL / configTICK_RATE_HZ)) + 2;
+        (void)ulTaskNotifyTakeIndexed(TIMING_NOTIFY_INDEX, pdTRUE, guard);
+        (void)esp_timer_stop(timer);  // no-op if it fired; cancels it on an early/foreign wake
+        remain = (int64_t)deadline_us - (int64_t)esp_timer_get_time();
     }
+    spin_us(remain);
     return true;
 }
 
+bool timing_sleep_until_abs_us(uint64_t deadline_us)
+{
+    if (s_mode == TIMING_SLEEP_TIMER) {
+        esp_timer_handle_t t = sleeper_timer();
+        if (t) return sleep_timer(deadline_us, t);
+    }
+    return sleep_tick_spin(deadline_us);
+}
+
+static inline uint64_t now_ms_from_us(uint64_t us)
+{
+    return us / 1000ULL;
+}
+
 bool timing_sleep_until_abs_ms(uint64_t deadline_ms)
 {
     const uint64_t now_ms = timing_now_us() / 1000ULL;
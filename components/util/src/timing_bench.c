@@ -0,0 +1,63 @@
+#include "util/timing_bench.h"
+
+#include <stdlib.h>
+
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "util/mem.h"
+
+static const char *TAG = "timing_bench";
+
+static int cmp_u32(const void *a, const void *b)
+{
+    const uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+esp_err_t timing_jitter_run(timing_sleep_mode_t mode, uint32_t period_us, uint32_t samples,
+                            timing_jitter_result_t *out)
+{
+    ESP_RETURN_ON_FALSE(out && samples > 0 && period_us > 0, ESP_ERR_INVALID_ARG, TAG, "bad args");
+    uint32_t *late = mem_malloc(MEM_TAG_UTIL, samples * sizeof(uint32_t), MALLOC_CAP_DEFAULT);
+    ESP_RETURN_ON_FALSE(late, ESP_ERR_NO_MEM, TAG, "no mem for %u samples", (unsigned)samples);
+
+    const timing_sleep_mode_t prev = timing_get_sleep_mode();
+    timing_set_sleep_mode(mode, TIMING_FINAL_SPIN_US);
+
+    *out = (timing_jitter_result_t){ .mode = mode, .samples = samples };
+    const uint64_t spin0 = timing_spin_us_total();
+    uint64_t next = timing_now_us() + period_us;
+    for (uint32_t i = 0; i < samples; ++i) {
+        const uint64_t deadline = next;
+        (void)timing_sleep_periodic_us(&next, period_us);
+        const int64_t d = (int64_t)(timing_now_us() - deadline);
+        if (d < 0) out->early++;
+        late[i] = d > 0 ? (uint32_t)d : 0;
+    }
+    out->spin_us_per_wake = (uint32_t)((timing_spin_us_total() - spin0) / samples);
+    timing_set_sleep_mode(prev, TIMING_FINAL_SPIN_US);
+
+    qsort(late, samples, sizeof(uint32_t), cmp_u32);
+    out->late_p50_us = late[(samples - 1) / 2];
+    out->late_p99_us = late[(samples * 99 + 99) / 100 - 1];
+    out->late_max_us = late[samples - 1];
+    mem_free(MEM_TAG_UTIL, late);
+    return ESP_OK;
+}
+
+void timing_jitter_bench(uint32_t period_us, uint32_t samples)
+{
+    static const char *const kName[] = { "tick+spin", "timer" };
+    const timing_sleep_mode_t modes[] = { TIMING_SLEEP_TICK_SPIN, TIMING_SLEEP_TIMER };
+    for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); ++i) {
+        timing_jitter_result_t r;
+        if (timing_jitter_run(modes[i], period_us, samples, &r) != ESP_OK) continue;
+        ESP_LOGI(TAG, "%-9s period %u us x%u: late p50 %u p99 %u max %u us, %u early, "
+                      "spin %u us/wake (%u%% of period)",
+                 kName[modes[i]], (unsigned)period_us, (unsigned)r.samples,
+                 (unsigned)r.late_p50_us, (unsigned)r.late_p99_us, (unsigned)r.late_max_us,
+                 (unsigned)r.early, (unsigned)r.spin_us_per_wake,
+                 (unsigned)(r.spin_us_per_wake * 100U / period_us));
+    }
+}
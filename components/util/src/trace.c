@@ -0,0 +1,151 @@
+#include "util/trace.h"
+
+#if TRACE_ENABLE
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cbor.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "util/mem.h"
+
+#define TRACE_CORES        portNUM_PROCESSORS
+#define TRACE_CHUNK_EVENTS 16     // events per exported line
+#define TRACE_CHUNK_BYTES  1024
+
+_Static_assert((TRACE_RING_EVENTS & (TRACE_RING_EVENTS - 1)) == 0, "TRACE_RING_EVENTS must be a power of two");
+
+typedef struct {
+    uint64_t    t_us;
+    const char *name;
+    int32_t     value;
+    uint8_t     type;
+} trace_event_t;
+
+/*
+ * One ring per core. Writers (tasks or ISRs on that core) reserve a slot with
+ * a single fetch_add, so preemption between reserve and fill never hands the
+ * same slot out twice. The exporter only reads after recording has stopped.
+ */
+typedef struct {
+    trace_event_t ev[TRACE_RING_EVENTS];
+    atomic_uint   head;   // total events ever reserved
+} trace_ring_t;
+
+static const char *TAG = "trace";
+
+static trace_ring_t *s_rings;   // TRACE_CORES rings, allocated by the first trace_start()
+static volatile bool s_on;
+
+void trace_start(void)
+{
+    s_on = false;
+    if (!s_rings) {
+        static const uint32_t kCaps[] = { MALLOC_CAP_SPIRAM, MALLOC_CAP_INTERNAL };
+        const size_t bytes = sizeof(trace_ring_t) * TRACE_CORES;
+        s_rings = mem_alloc_prefer(MEM_TAG_UTIL, 0, bytes, kCaps, 2);
+        if (!s_rings) {
+            ESP_LOGW(TAG, "no memory for %u B of rings, not recording", (unsigned)bytes);
+            return;
+        }
+    }
+    for (int c = 0; c < TRACE_CORES; ++c) atomic_store(&s_rings[c].head, 0);
+    s_on = true;
+}
+
+void trace_stop(void)
+{
+    s_on = false;
+}
+
+void IRAM_ATTR trace_emit(trace_ev_type_t type, const char *name, int32_t value)
+{
+    if (!s_on) return;
+    trace_ring_t *r = &s_rings[xPortGetCoreID()];
+    const unsigned i = atomic_fetch_add_explicit(&r->head, 1, memory_order_relaxed);
+    trace_event_t *e = &r->ev[i & (TRACE_RING_EVENTS - 1)];
+    e->t_us  = (uint64_t)esp_timer_get_time();
+    e->name  = name;
+    e->value = value;
+    e->type  = (uint8_t)type;
+}
+
+static void print_hex_line(const uint8_t *buf, size_t len)
+{
+    static const char kHex[] = "0123456789abcdef";
+    fputs("TRACE ", stdout);
+    for (size_t i = 0; i < len; ++i) {
+        putchar(kHex[buf[i] >> 4]);
+        putchar(kHex[buf[i] & 0xF]);
+    }
+    putchar('\n');
+}
+
+static void export_chunk(int core, const trace_ring_t *r, unsigned from, unsigned n)
+{
+    static uint8_t buf[TRACE_CHUNK_BYTES];
+    CborEncoder root, arr, ev;
+    cbor_encoder_init(&root, buf, sizeof(buf), 0);
+    CborError err = cbor_encoder_create_array(&root, &arr, n);
+    for (unsigned k = 0; k < n && err == CborNoError; ++k) {
+        const trace_event_t *e = &r->ev[(from + k) & (TRACE_RING_EVENTS - 1)];
+        err |= cbor_encoder_create_array(&arr, &ev, 5);
+        err |= cbor_encode_uint(&ev, e->type);
+        err |= cbor_encode_uint(&ev, (uint64_t)core);
+        err |= cbor_encode_uint(&ev, e->t_us);
+        err |= cbor_encode_text_stringz(&ev, e->name ? e->name : "?");
+        err |= cbor_encode_int(&ev, e->value);
+        err |= cbor_encoder_close_container(&arr, &ev);
+    }
+    err |= cbor_encoder_close_container(&root, &arr);
+    if (err != CborNoError) {
+        printf("TRACE-ERR cbor %d\n", (int)err);
+        return;
+    }
+    print_hex_line(buf, cbor_encoder_get_buffer_size(&root, buf));
+}
+
+void trace_export_console(void)
+{
+    trace_stop();
+    if (!s_rings) {
+        printf("TRACE-BEGIN v1 cores=%d overwritten=0\nTRACE-END events=0\n", TRACE_CORES);
+        fflush(stdout);
+        return;
+    }
+
+    unsigned total = 0, overwritten = 0;
+    for (int c = 0; c < TRACE_CORES; ++c) {
+        const unsigned head = atomic_load(&s_rings[c].head);
+        if (head > TRACE_RING_EVENTS) overwritten += head - TRACE_RING_EVENTS;
+    }
+    printf("TRACE-BEGIN v1 cores=%d overwritten=%u\n", TRACE_CORES, overwritten);
+
+    for (int c = 0; c < TRACE_CORES; ++c) {
+        const trace_ring_t *r = &s_rings[c];
+        const unsigned head  = atomic_load(&r->head);
+        const unsigned count = head < TRACE_RING_EVENTS ? head : TRACE_RING_EVENTS;
+        for (unsigned k = 0; k < count; k += TRACE_CHUNK_EVENTS) {
+            const unsigned n = (count - k) < TRACE_CHUNK_EVENTS ? (count - k) : TRACE_CHUNK_EVENTS;
+            export_chunk(c, r, head - count + k, n);
+        }
+        total += count;
+    }
+    printf("TRACE-END events=%u\n", total);
+    fflush(stdout);
+}
+
+#else  // !TRACE_ENABLE: keep the functions so callers need no #if of their own
+
+void trace_start(void) {}
+void trace_stop(void) {}
+void trace_emit(trace_ev_type_t type, const char *name, int32_t value) {}
+void trace_export_console(void) {}
+
+#endif
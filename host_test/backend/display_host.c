@@ -0,0 +1,217 @@
+#include "display_host.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "esp_check.h"
+#include "esp_log.h"
+
+#include "board/board.h"
+#include "util/timing.h"
+
+/* Same video timing as the DPI panel: 40 MHz pixel clock, 80/44 px blanking. */
+#define HOST_PIXEL_CLOCK_HZ 40000000.0f
+#define HOST_H_BLANK        80
+#define HOST_V_BLANK        44
+
+static const char *TAG = "display_host";
+
+typedef struct display_handle_t_ {
+    int                  width, height;
+    uint16_t            *fbs[2];
+    int                  front;        // scanout buffer; presents copy into it
+    uint64_t             flip_due_us;  // next simulated refresh after the last flip
+    float                refresh_hz;
+    bool                 on;
+    uint64_t             pending_input_us;
+    latency_hist_t       lat;
+    uint32_t             log_every, logged_at;
+    display_host_stats_t st;
+} display_handle_t_;
+
+esp_err_t display_host_init(int w, int h, display_handle_t *out)
+{
+    ESP_RETURN_ON_FALSE(out && w > 0 && h > 0, ESP_ERR_INVALID_ARG, TAG, "bad args");
+    display_handle_t_ *d = calloc(1, sizeof(*d));
+    ESP_RETURN_ON_FALSE(d, ESP_ERR_NO_MEM, TAG, "no mem");
+    d->fbs[0] = calloc((size_t)w * h, sizeof(uint16_t));
+    d->fbs[1] = calloc((size_t)w * h, sizeof(uint16_t));
+    if (!d->fbs[0] || !d->fbs[1]) {
+        free(d->fbs[0]);
+        free(d->fbs[1]);
+        free(d);
+        return ESP_ERR_NO_MEM;
+    }
+    d->width  = w;
+    d->height = h;
+    d->refresh_hz = HOST_PIXEL_CLOCK_HZ / ((float)(w + HOST_H_BLANK) * (float)(h + HOST_V_BLANK));
+    d->on     = true;
+    latency_hist_reset(&d->lat);
+    *out = d;
+    return ESP_OK;
+}
+
+esp_err_t display_init(display_handle_t *out)
+{
+    int w = 0, h = 0;
+    board_panel_resolution(&w, &h);
+    return display_host_init(w, h, out);
+}
+
+void display_host_deinit(display_handle_t d)
+{
+    if (!d) return;
+    free(d->fbs[0]);
+    free(d->fbs[1]);
+    free(d);
+}
+
+int display_width(display_handle_t d)  { return d ? d->width : 0; }
+int display_height(display_handle_t d) { return d ? d->height : 0; }
+
+static void settle_input(display_handle_t_ *d, uint64_t t_done);
+
+esp_err_t display_draw_bitmap(display_handle_t d, int x0, int y0, int x1, int y1, const void *buf)
+{
+    ESP_RETURN_ON_FALSE(d && buf, ESP_ERR_INVALID_ARG, TAG, "bad args");
+    ESP_RETURN_ON_FALSE(x0 >= 0 && y0 >= 0 && x1 <= d->width && y1 <= d->height && x0 < x1 && y0 < y1,
+                        ESP_ERR_INVALID_ARG, TAG, "rect %d,%d..%d,%d off panel", x0, y0, x1, y1);
+
+    const uint64_t t0 = timing_now_us();
+    const int w = x1 - x0;
+    const uint16_t *src = buf;
+    uint16_t *panel = d->fbs[d->front];
+    for (int y = y0; y < y1; ++y, src += w) {
+        memcpy(panel + (size_t)y * d->width + x0, src, (size_t)w * sizeof(uint16_t));
+    }
+    const uint64_t t1 = timing_now_us();
+
+    d->st.presents++;
+    d->st.px += (uint64_t)w * (uint64_t)(y1 - y0);
+    d->st.present_us += t1 - t0;
+    settle_input(d, t1);
+    return ESP_OK;
+}
+
+esp_err_t display_wait_idle(display_handle_t d, uint32_t timeout_ms)
+{
+    return d ? ESP_OK : ESP_ERR_INVALID_ARG;   // presents are synchronous
+}
+
+esp_err_t display_get_frame_buffers(display_handle_t d, uint16_t *fbs[2])
+{
+    ESP_RETURN_ON_FALSE(d && fbs, ESP_ERR_INVALID_ARG, TAG, "bad args");
+    fbs[0] = d->fbs[0];
+    fbs[1] = d->fbs[1];
+    return ESP_OK;
+}
+
+uint16_t *display_front_buffer(display_handle_t d)
+{
+    return d ? d->fbs[d->front] : NULL;
+}
+
+/* The flip lands at the next refresh boundary of a free-running panel clock. */
+esp_err_t display_flip(display_handle_t d, const uint16_t *fb)
+{
+    ESP_RETURN_ON_FALSE(d && (fb == d->fbs[0] || fb == d->fbs[1]), ESP_ERR_INVALID_ARG, TAG,
+                        "not a panel frame buffer");
+    const uint64_t now = timing_now_us();
+    const uint64_t period = (uint64_t)(1e6f / d->refresh_hz);
+    d->front       = (fb == d->fbs[1]);
+    d->flip_due_us = (now / period + 1) * period;
+    d->st.flips++;
+    settle_input(d, d->flip_due_us);
+    return ESP_OK;
+}
+
+esp_err_t display_wait_flip(display_handle_t d, uint32_t timeout_ms)
+{
+    ESP_RETURN_ON_FALSE(d, ESP_ERR_INVALID_ARG, TAG, "null handle");
+    const uint64_t now = timing_now_us();
+    if (d->flip_due_us > now) timing_sleep_until_abs_us(d->flip_due_us);
+    return ESP_OK;
+}
+
+float display_refresh_hz(display_handle_t d)
+{
+    return d ? d->refresh_hz : 0.0f;
+}
+
+static void settle_input(display_handle_t_ *d, uint64_t t_done)
+{
+    if (d->pending_input_us) {
+        latency_hist_add(&d->lat, (uint32_t)(t_done - d->pending_input_us));
+        d->pending_input_us = 0;
+        if (d->log_every && d->lat.total - d->logged_at >= d->log_every) {
+            latency_summary_t s;
+            latency_hist_summary(&d->lat, &s);
+            ESP_LOGI(TAG, "touch->photon (%u): min %u p50 %u p95 %u max %u us", (unsigned)s.count,
+                     (unsigned)s.min_us, (unsigned)s.p50_us, (unsigned)s.p95_us, (unsigned)s.max_us);
+            d->logged_at = d->lat.total;
+        }
+    }
+}
+
+void display_mark_input(display_handle_t d, uint64_t t_input_us)
+{
+    if (d) d->pending_input_us = t_input_us;
+}
+
+void display_latency_get(display_handle_t d, latency_summary_t *out)
+{
+    if (!out) return;
+    if (!d) {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+    latency_hist_summary(&d->lat, out);
+}
+
+void display_latency_reset(display_handle_t d)
+{
+    if (!d) return;
+    latency_hist_reset(&d->lat);
+    d->logged_at = 0;
+}
+
+void display_latency_set_logging(display_handle_t d, uint32_t every_n)
+{
+    if (d) d->log_every = every_n;
+}
+
+/* Tile-hash filtering lives in the panel driver; headless presents are never filtered. */
+esp_err_t display_set_present_filter(display_handle_t d, int tile_px)
+{
+    return tile_px ? ESP_ERR_NOT_SUPPORTED : ESP_OK;
+}
+
+void display_get_present_filter_stats(display_handle_t d, display_filter_stats_t *out)
+{
+    if (out) memset(out, 0, sizeof(*out));
+}
+
+void display_reset_present_filter_stats(display_handle_t d)
+{
+}
+
+esp_err_t display_on(display_handle_t d, bool on)
+{
+    ESP_RETURN_ON_FALSE(d, ESP_ERR_INVALID_ARG, TAG, "null handle");
+    d->on = on;
+    return ESP_OK;
+}
+
+const uint16_t *display_host_pixels(display_handle_t d)
+{
+    return d ? d->fbs[d->front] : NULL;
+}
+
+void display_host_get_stats(display_handle_t d, display_host_stats_t *out)
+{
+    if (d && out) *out = d->st;
+}
+
+void display_host_reset_stats(display_handle_t d)
+{
+    if (d) memset(&d->st, 0, sizeof(d->st));
+}
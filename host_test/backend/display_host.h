@@ -0,0 +1,37 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Headless display backend for host builds. Implements display_panel's API
+ * (display/display.h) over two in-memory panel framebuffers: presents are
+ * copied synchronously into the front one, so "transfer done" is the end of
+ * the call. Flips land on the next refresh of a simulated panel clock with the
+ * DPI timing (~34 Hz). Touch-to-photon marks are measured the same way the
+ * panel driver measures them.
+ */
+
+#include <stdint.h>
+#include "display_panel/display.h"
+
+typedef struct {
+    uint32_t presents;     // display_draw_bitmap() calls accepted
+    uint64_t px;           // pixels copied to the panel
+    uint64_t present_us;   // time spent inside display_draw_bitmap()
+    uint32_t flips;        // display_flip() calls
+} display_host_stats_t;
+
+/** display_init() with an explicit size instead of the board resolution. */
+esp_err_t display_host_init(int w, int h, display_handle_t *out);
+void      display_host_deinit(display_handle_t d);
+
+/** What the panel currently shows (RGB565, stride = width). */
+const uint16_t *display_host_pixels(display_handle_t d);
+
+void display_host_get_stats(display_handle_t d, display_host_stats_t *out);
+void display_host_reset_stats(display_handle_t d);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,33 @@
+/*
+ * Host microbenchmarks: bench_run_all's suites (ui_gfx, kernels, filter,
+ * color, font, util, timing) on a panel-sized scratch frame, checked against
+ * the host column of bench_baselines.c (ns). Regressions are reported, not
+ * failed on: host numbers move with the machine and its load. Pass "strict"
+ * to exit non-zero on any.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "bench/bench.h"
+#include "util/fb.h"
+#include "util/mem.h"
+
+#define BENCH_W 800
+#define BENCH_H 1280
+
+int main(int argc, char **argv)
+{
+    const int strict = argc > 1 && strcmp(argv[1], "strict") == 0;
+    (void)mem_init();
+
+    uint16_t *fb = util_malloc_psram_dma((size_t)BENCH_W * BENCH_H * sizeof(uint16_t));
+    if (!fb) return 1;
+
+    bench_cfg_t cfg = BENCH_CFG_DEFAULT();
+    const int regressions = bench_run_all(fb, BENCH_W, BENCH_H, &cfg);
+    util_free_psram_dma(fb);
+
+    printf("bench: %d regression(s) against %u host baselines\n", regressions,
+           (unsigned)bench_baseline_count);
+    return strict && regressions ? 1 : 0;
+}
@@ -0,0 +1,175 @@
+/*
+ * Host demo benchmark: every built-in demo run unpaced through demo_bench
+ * against the headless display. Render times are host CPU times; present
+ * times are memcpy into the fake panel. The Animation demo plays a synthetic
+ * ISEQ blob (a sliding square, run-coded, plus a raw corner patch per frame)
+ * registered as the "anim" partition. The Slideshow demo shows the JPEG test
+ * fixtures from a "photos" partition, or the JPEGs in photo_dir when given.
+ *
+ *   demo_bench_host [frames] [log|csv|json] [photo_dir]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "demos/demo_bench.h"
+#include "demos/demos.h"
+#include "display_host.h"
+#include "esp_partition.h"
+#include "image/img_seq.h"
+#include "jpeg_fixtures.h"
+#include "phot_blob.h"
+#include "util/arena.h"
+#include "util/fb.h"
+#include "util/jobs.h"
+#include "util/mem.h"
+
+#define SEQ_W      400
+#define SEQ_H      300
+#define SEQ_FRAMES 30
+#define SEQ_SQ     64
+#define SEQ_PATCH  32
+
+typedef struct { uint8_t *p; size_t n, cap; } blob_t;
+
+static void put(blob_t *b, const void *src, size_t n)
+{
+    if (b->n + n > b->cap) {
+        b->cap = (b->n + n) * 2;
+        b->p = realloc(b->p, b->cap);
+        if (!b->p) abort();
+    }
+    memcpy(b->p + b->n, src, n);
+    b->n += n;
+}
+
+static void put16(blob_t *b, uint16_t v) { put(b, &v, 2); }
+static void put32(blob_t *b, uint32_t v) { put(b, &v, 4); }
+static void pad4(blob_t *b) { while (b->n & 3) put(b, "", 1); }
+
+/* Same run coding as tools/mkseq.py: runs of 3+ repeat, literals otherwise. */
+static void put_runs(blob_t *b, const uint16_t *px, int n)
+{
+    for (int i = 0; i < n;) {
+        int j = i;
+        while (j < n && px[j] == px[i] && j - i < 0x7FFF) ++j;
+        if (j - i >= 3) {
+            put16(b, (uint16_t)(0x8000 | (j - i)));
+            put16(b, px[i]);
+            i = j;
+            continue;
+        }
+        j = i;
+        while (j < n && j - i < 0x7FFF && !(j + 2 < n && px[j] == px[j + 1] && px[j] == px[j + 2])) ++j;
+        put16(b, (uint16_t)(j - i));
+        put(b, px + i, (size_t)(j - i) * 2);
+        i = j;
+    }
+    pad4(b);
+}
+
+static uint16_t seq_px(int f, int x, int y)
+{
+    const int sx = (f * 9) % (SEQ_W - SEQ_SQ), sy = (f * 5) % (SEQ_H - SEQ_SQ);
+    if (x >= sx && x < sx + SEQ_SQ && y >= sy && y < sy + SEQ_SQ) return 0xF800;
+    if (x < SEQ_PATCH && y < SEQ_PATCH) return (uint16_t)((x * 2654435761u + y * 40503u + f * 97u) >> 16);
+    return 0x0010;
+}
+
+/* Rect of frame f: payload is either raw or run-coded pixels. */
+static void put_rect(blob_t *b, int f, int x0, int y0, int w, int h, bool raw)
+{
+    uint16_t *px = malloc((size_t)w * h * 2);
+    if (!px) abort();
+    for (int y = 0; y < h; ++y)
+        for (int x = 0; x < w; ++x) px[y * w + x] = seq_px(f, x0 + x, y0 + y);
+    put16(b, (uint16_t)x0); put16(b, (uint16_t)y0); put16(b, (uint16_t)w); put16(b, (uint16_t)h);
+    put16(b, raw ? IMG_SEQ_RECT_RAW : 0); put16(b, 0);
+    const size_t len_at = b->n;
+    put32(b, 0);
+    const size_t start = b->n;
+    if (raw) {
+        put(b, px, (size_t)w * h * 2);
+        pad4(b);
+    } else {
+        put_runs(b, px, w * h);
+    }
+    const uint32_t len = (uint32_t)(b->n - start);
+    memcpy(b->p + len_at, &len, 4);
+    free(px);
+}
+
+static blob_t make_anim(void)
+{
+    blob_t b = {0};
+    put(&b, IMG_SEQ_MAGIC, 4);
+    put16(&b, IMG_SEQ_VERSION); put16(&b, SEQ_W); put16(&b, SEQ_H); put16(&b, SEQ_FRAMES);
+    put32(&b, 33333);
+    const size_t table = b.n;
+    for (int f = 0; f < SEQ_FRAMES * 3; ++f) put32(&b, 0);   // entries, patched below
+
+    for (int f = 0; f < SEQ_FRAMES; ++f) {
+        const uint32_t off = (uint32_t)b.n;
+        if (f == 0) {
+            for (int y = 0; y < SEQ_H; ++y)
+                for (int x = 0; x < SEQ_W; ++x) put16(&b, seq_px(0, x, y));
+            pad4(&b);
+        } else {
+            /* The square's old and new boxes, plus the patch that changes every frame. */
+            const int ox = ((f - 1) * 9) % (SEQ_W - SEQ_SQ), oy = ((f - 1) * 5) % (SEQ_H - SEQ_SQ);
+            const int nx = (f * 9) % (SEQ_W - SEQ_SQ), ny = (f * 5) % (SEQ_H - SEQ_SQ);
+            const int x0 = ox < nx ? ox : nx, y0 = oy < ny ? oy : ny;
+            const int x1 = (ox > nx ? ox : nx) + SEQ_SQ, y1 = (oy > ny ? oy : ny) + SEQ_SQ;
+            put16(&b, 2); put16(&b, 0);
+            put_rect(&b, f, x0, y0, x1 - x0, y1 - y0, false);
+            put_rect(&b, f, 0, 0, SEQ_PATCH, SEQ_PATCH, true);
+        }
+        const uint32_t e[3] = { off, (uint32_t)b.n - off, f ? IMG_SEQ_KIND_DELTA : IMG_SEQ_KIND_RAW };
+        memcpy(b.p + table + (size_t)f * IMG_SEQ_ENTRY_LEN, e, sizeof(e));
+    }
+    return b;
+}
+
+int main(int argc, char **argv)
+{
+    demo_bench_cfg_t cfg = DEMO_BENCH_CFG_DEFAULT();
+    if (argc > 1) cfg.frames = (uint32_t)strtoul(argv[1], NULL, 10);
+    if (argc > 2) {
+        if      (strcmp(argv[2], "csv") == 0)  cfg.output = DEMO_BENCH_OUT_CSV;
+        else if (strcmp(argv[2], "json") == 0) cfg.output = DEMO_BENCH_OUT_JSON;
+    }
+    if (cfg.frames == 0) {
+        fprintf(stderr, "usage: %s [frames] [log|csv|json] [photo_dir]\n", argv[0]);
+        return 2;
+    }
+
+    (void)mem_init();
+    (void)arena_init(NULL);
+    (void)jobs_init(NULL);
+
+    blob_t anim = make_anim();
+    (void)esp_shim_partition_add("anim", anim.p, anim.n);
+
+    static const uint8_t *const kPhotos[] = { k_q444_jpg, k_q422_jpg, k_q420_jpg, k_gray_jpg, k_rst_jpg };
+    static const size_t kPhotoLen[] = {
+        sizeof(k_q444_jpg), sizeof(k_q422_jpg), sizeof(k_q420_jpg), sizeof(k_gray_jpg), sizeof(k_rst_jpg),
+    };
+    size_t photos_len = 0;
+    uint8_t *photos = phot_blob(kPhotos, kPhotoLen, 5, &photos_len);
+    if (photos) (void)esp_shim_partition_add("photos", photos, photos_len);
+    if (argc > 3) demo_slideshow_set_dir(argv[3]);
+
+    display_handle_t d = NULL;
+    if (display_init(&d) != ESP_OK) return 1;
+    const int W = display_width(d), H = display_height(d);
+    uint16_t *fb = util_malloc_psram_dma((size_t)W * H * sizeof(uint16_t));
+    if (!fb) return 1;
+    memset(fb, 0, (size_t)W * H * sizeof(uint16_t));
+
+    demo_bench_run_all(d, fb, &cfg);
+
+    display_host_stats_t st;
+    display_host_get_stats(d, &st);
+    fprintf(stderr, "display: %u presents, %.1f Mpx\n", (unsigned)st.presents, (double)st.px / 1e6);
+    return st.presents ? 0 : 1;
+}
@@ -0,0 +1,36 @@
+/*
+ * Host menu benchmark: the canned touch sessions of ui_menu/menu_bench
+ * replayed through the real menu state machine, demos and drawing code
+ * against the headless display. Render times are host CPU times; present
+ * times are memcpy into the fake panel.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "display_host.h"
+#include "ui_menu/menu_bench.h"
+#include "util/arena.h"
+#include "util/fb.h"
+#include "util/jobs.h"
+#include "util/mem.h"
+
+int main(void)
+{
+    (void)mem_init();
+    (void)arena_init(NULL);
+    (void)jobs_init(NULL);
+
+    display_handle_t d = NULL;
+    if (display_init(&d) != ESP_OK) return 1;
+    const int W = display_width(d), H = display_height(d);
+    uint16_t *fb = util_malloc_psram_dma((size_t)W * H * sizeof(uint16_t));
+    if (!fb) return 1;
+    memset(fb, 0, (size_t)W * H * sizeof(uint16_t));
+
+    const esp_err_t err = menu_bench_run(d, fb);
+
+    display_host_stats_t st;
+    display_host_get_stats(d, &st);
+    printf("display: %u presents, %.1f Mpx\n", (unsigned)st.presents, (double)st.px / 1e6);
+    return (err == ESP_OK && st.presents) ? 0 : 1;
+}
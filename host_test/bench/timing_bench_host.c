@@ -0,0 +1,89 @@
+/*
+ * Host timing bench: util/timing_bench's jitter run for both sleep modes,
+ * plus the two timer-mode guarantees it relies on:
+ *   - the wake uses its own notification index, so a pending index-0
+ *     notification (jobs.c, drivers) survives a sleep;
+ *   - sleeper slots come back when their task is deleted, so more than
+ *     TIMING_MAX_SLEEPERS short-lived tasks all get timer mode.
+ * Lateness is host scheduler lateness, not the target's.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "util/mem.h"
+#include "util/timing.h"
+#include "util/timing_bench.h"
+
+#define SHORT_PERIOD_US 2000
+#define SHORT_SAMPLES   20
+
+typedef struct {
+    SemaphoreHandle_t      done;
+    timing_jitter_result_t r;
+    esp_err_t              err;
+} worker_t;
+
+static void worker(void *arg)
+{
+    worker_t *w = arg;
+    w->err = timing_jitter_run(TIMING_SLEEP_TIMER, SHORT_PERIOD_US, SHORT_SAMPLES, &w->r);
+    xSemaphoreGive(w->done);
+}
+
+/* Timer mode spins at most the final spin per wake; the tick+spin fallback spins up to a tick. */
+static bool got_timer_mode(const timing_jitter_result_t *r)
+{
+    return r->spin_us_per_wake <= TIMING_FINAL_SPIN_US;
+}
+
+static int check_notify_index(void)
+{
+    (void)ulTaskNotifyTake(pdTRUE, 0);
+    (void)xTaskNotifyGive(xTaskGetCurrentTaskHandle());
+    timing_jitter_result_t r;
+    if (timing_jitter_run(TIMING_SLEEP_TIMER, SHORT_PERIOD_US, SHORT_SAMPLES, &r) != ESP_OK) return 1;
+    const uint32_t kept = ulTaskNotifyTake(pdTRUE, 0);
+    printf("notify index: index-0 notification %s a timer-mode sleep\n", kept ? "survived" : "was eaten by");
+    return kept == 1 && got_timer_mode(&r) ? 0 : 1;
+}
+
+static int check_slot_release(void)
+{
+    worker_t w = { .done = xSemaphoreCreateBinary() };
+    if (!w.done) return 1;
+    const uint32_t held = timing_sleepers_in_use();
+    const int tasks = 2 * TIMING_MAX_SLEEPERS + 1;
+    int timer_mode = 0;
+    for (int i = 0; i < tasks; ++i) {
+        if (xTaskCreate(worker, "sleeper", 4096, &w, 5, NULL) != pdPASS) break;
+        (void)xSemaphoreTake(w.done, portMAX_DELAY);
+        if (w.err == ESP_OK && got_timer_mode(&w.r)) timer_mode++;
+        vTaskDelay(1);  // let the previous task finish deleting
+    }
+    vSemaphoreDelete(w.done);
+    const uint32_t left = timing_sleepers_in_use();
+    printf("slot release: %d/%d short-lived tasks got timer mode, %u/%d slots held after (%u before)\n",
+           timer_mode, tasks, (unsigned)left, TIMING_MAX_SLEEPERS, (unsigned)held);
+    return timer_mode == tasks && left == held ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    const uint32_t period_us = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : 1000;
+    const uint32_t samples   = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 10) : 1000;
+    if (period_us == 0 || samples == 0) {
+        fprintf(stderr, "usage: %s [period_us] [samples]\n", argv[0]);
+        return 2;
+    }
+    (void)mem_init();
+
+    timing_jitter_bench(period_us, samples);
+
+    int fails = 0;
+    fails += check_notify_index();
+    fails += check_slot_release();
+    return fails ? 1 : 0;
+}
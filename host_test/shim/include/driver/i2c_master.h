@@ -0,0 +1,44 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Host I2C: there is no bus. Types match the IDF driver; every call fails. */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef int i2c_port_t;
+#define I2C_NUM_0 0
+#define I2C_NUM_1 1
+
+typedef struct i2c_master_bus_t *i2c_master_bus_handle_t;
+typedef struct i2c_master_dev_t *i2c_master_dev_handle_t;
+
+typedef struct {
+    uint16_t device_address;
+    uint32_t scl_speed_hz;
+} i2c_device_config_t;
+
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus, const i2c_device_config_t *cfg,
+                                    i2c_master_dev_handle_t *out);
+esp_err_t i2c_master_bus_rm_device(i2c_master_dev_handle_t dev);
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t dev, const uint8_t *buf, size_t len, int timeout_ms);
+esp_err_t i2c_master_receive(i2c_master_dev_handle_t dev, uint8_t *buf, size_t len, int timeout_ms);
+
+/* Legacy config struct used by the i2c_bus wrapper component. */
+typedef enum { I2C_MODE_SLAVE, I2C_MODE_MASTER } i2c_mode_t;
+typedef struct {
+    i2c_mode_t mode;
+    int        sda_io_num, scl_io_num;
+    bool       sda_pullup_en, scl_pullup_en;
+    struct { uint32_t clk_speed; } master;
+    uint32_t   clk_flags;
+} i2c_config_t;
+#define LP_I2C_SCLK_DEFAULT 0
+
+#ifdef __cplusplus
+}
+#endif
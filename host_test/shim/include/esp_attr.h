@@ -0,0 +1,8 @@
+#pragma once
+/* Placement attributes have no meaning on the host. */
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define EXT_RAM_BSS_ATTR
+#define RTC_DATA_ATTR
+#define DMA_ATTR
+#define WORD_ALIGNED_ATTR __attribute__((aligned(4)))
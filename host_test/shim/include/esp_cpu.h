@@ -0,0 +1,4 @@
+#pragma once
+#include <stdint.h>
+/* Host: nanoseconds since start, truncated to 32 bits like CCOUNT. */
+uint32_t esp_cpu_get_cycle_count(void);
@@ -0,0 +1,51 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Host heap with capability bookkeeping. Blocks come from the C heap
+ * (cache-line aligned); a side table remembers size and whether the block
+ * would have landed in PSRAM, so heap_caps_get_allocated_size() and
+ * esp_ptr_external_ram() answer as on target. Free sizes are simulated
+ * against fixed pools, and allocations can be made to fail on demand.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_EXEC           (1 << 0)
+#define MALLOC_CAP_32BIT          (1 << 1)
+#define MALLOC_CAP_8BIT           (1 << 2)
+#define MALLOC_CAP_DMA            (1 << 3)
+#define MALLOC_CAP_SPIRAM         (1 << 10)
+#define MALLOC_CAP_INTERNAL       (1 << 11)
+#define MALLOC_CAP_DEFAULT        (1 << 12)
+#define MALLOC_CAP_CACHE_ALIGNED  (1 << 19)
+#define MALLOC_CAP_SIMD           (1 << 20)
+
+/* Simulated pool sizes (ESP32-P4: 768 KB HP SRAM, 32 MB PSRAM). */
+#define ESP_SHIM_HEAP_INTERNAL_BYTES (768u * 1024u)
+#define ESP_SHIM_HEAP_PSRAM_BYTES    (32u * 1024u * 1024u)
+/* MALLOC_CAP_DEFAULT requests at least this large go to PSRAM (SPIRAM_MALLOC_ALWAYSINTERNAL). */
+#define ESP_SHIM_HEAP_ALWAYSINTERNAL 16384u
+
+typedef void (*esp_alloc_failed_hook_t)(size_t size, uint32_t caps, const char *function_name);
+
+void  *heap_caps_malloc(size_t size, uint32_t caps);
+void  *heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void  *heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps);
+void  *heap_caps_aligned_calloc(size_t alignment, size_t n, size_t size, uint32_t caps);
+void   heap_caps_free(void *p);
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_minimum_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+size_t heap_caps_get_allocated_size(void *p);
+int    heap_caps_register_failed_alloc_callback(esp_alloc_failed_hook_t cb);
+
+/** Host only: fail the next n allocations whose caps include all of caps_mask (0 = any). */
+void esp_shim_heap_fail_next(uint32_t caps_mask, int n);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,3 @@
+#pragma once
+/* Host: the esp_lcd subset display.c needs lives in one header. */
+#include "esp_lcd_panel_ops.h"
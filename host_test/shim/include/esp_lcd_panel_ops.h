@@ -0,0 +1,111 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Host esp_lcd: just the types and calls display_panel/src/display.c uses
+ * (DSI bus, DBI IO, DPI panel, JD9365 vendor config), so the real driver can
+ * build on the host. There is no implementation here: a test that links
+ * display.c supplies a simulated panel. The other esp_lcd headers include this.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef struct esp_lcd_dsi_bus_t   *esp_lcd_dsi_bus_handle_t;
+typedef struct esp_lcd_panel_io_t  *esp_lcd_panel_io_handle_t;
+typedef struct esp_lcd_panel_t     *esp_lcd_panel_handle_t;
+
+typedef struct {
+    int bus_id;
+    int num_data_lanes;
+    uint32_t lane_bit_rate_mbps;
+} esp_lcd_dsi_bus_config_t;
+
+typedef struct {
+    int virtual_channel;
+    int lcd_cmd_bits;
+    int lcd_param_bits;
+} esp_lcd_dbi_io_config_t;
+
+typedef enum { MIPI_DSI_DPI_CLK_SRC_DEFAULT } mipi_dsi_dpi_clock_source_t;
+typedef enum { LCD_COLOR_PIXEL_FORMAT_RGB565, LCD_COLOR_PIXEL_FORMAT_RGB888 } lcd_color_rgb_pixel_format_t;
+typedef enum { LCD_RGB_ELEMENT_ORDER_RGB, LCD_RGB_ELEMENT_ORDER_BGR } lcd_rgb_element_order_t;
+
+typedef struct {
+    uint32_t h_size, v_size;
+    uint32_t hsync_pulse_width, hsync_back_porch, hsync_front_porch;
+    uint32_t vsync_pulse_width, vsync_back_porch, vsync_front_porch;
+} esp_lcd_video_timing_t;
+
+typedef struct {
+    uint8_t                      virtual_channel;
+    mipi_dsi_dpi_clock_source_t  dpi_clk_src;
+    uint32_t                     dpi_clock_freq_mhz;
+    lcd_color_rgb_pixel_format_t pixel_format;
+    uint8_t                      num_fbs;
+    esp_lcd_video_timing_t       video_timing;
+    struct {
+        uint32_t use_dma2d : 1;
+    } flags;
+} esp_lcd_dpi_panel_config_t;
+
+typedef struct {
+    int                     reset_gpio_num;
+    lcd_rgb_element_order_t rgb_ele_order;
+    uint32_t                bits_per_pixel;
+    void                   *vendor_config;
+} esp_lcd_panel_dev_config_t;
+
+typedef struct {
+    void *reserved;
+} esp_lcd_dpi_panel_event_data_t;
+
+typedef bool (*esp_lcd_dpi_panel_color_trans_done_cb_t)(esp_lcd_panel_handle_t panel,
+                                                        esp_lcd_dpi_panel_event_data_t *edata, void *ctx);
+typedef bool (*esp_lcd_dpi_panel_refresh_done_cb_t)(esp_lcd_panel_handle_t panel,
+                                                    esp_lcd_dpi_panel_event_data_t *edata, void *ctx);
+
+typedef struct {
+    esp_lcd_dpi_panel_color_trans_done_cb_t on_color_trans_done;
+    esp_lcd_dpi_panel_refresh_done_cb_t     on_refresh_done;
+} esp_lcd_dpi_panel_event_callbacks_t;
+
+/* JD9365 vendor component (esp_lcd_jd9365_10_1). */
+typedef struct {
+    const void *init_cmds;
+    uint16_t    init_cmds_size;
+    struct {
+        esp_lcd_dsi_bus_handle_t          dsi_bus;
+        const esp_lcd_dpi_panel_config_t *dpi_config;
+        uint8_t                           lane_num;
+    } mipi_config;
+    struct {
+        unsigned int use_mipi_interface : 1;
+        unsigned int mirror_by_cmd      : 1;
+    } flags;
+} jd9365_vendor_config_t;
+
+#define JD9365_PANEL_BUS_DSI_2CH_CONFIG() { .bus_id = 0, .num_data_lanes = 2, .lane_bit_rate_mbps = 1500 }
+#define JD9365_PANEL_IO_DBI_CONFIG()      { .virtual_channel = 0, .lcd_cmd_bits = 8, .lcd_param_bits = 8 }
+
+esp_err_t esp_lcd_new_dsi_bus(const esp_lcd_dsi_bus_config_t *cfg, esp_lcd_dsi_bus_handle_t *out);
+esp_err_t esp_lcd_new_panel_io_dbi(esp_lcd_dsi_bus_handle_t bus, const esp_lcd_dbi_io_config_t *cfg,
+                                   esp_lcd_panel_io_handle_t *out);
+esp_err_t esp_lcd_new_panel_jd9365(esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *cfg,
+                                   esp_lcd_panel_handle_t *out);
+esp_err_t esp_lcd_panel_reset(esp_lcd_panel_handle_t panel);
+esp_err_t esp_lcd_panel_init(esp_lcd_panel_handle_t panel);
+esp_err_t esp_lcd_panel_disp_on_off(esp_lcd_panel_handle_t panel, bool on);
+esp_err_t esp_lcd_panel_draw_bitmap(esp_lcd_panel_handle_t panel, int x0, int y0, int x1, int y1,
+                                    const void *color_data);
+esp_err_t esp_lcd_dpi_panel_get_frame_buffer(esp_lcd_panel_handle_t panel, uint32_t fb_num, void **fb0, ...);
+esp_err_t esp_lcd_dpi_panel_register_event_callbacks(esp_lcd_panel_handle_t panel,
+                                                     const esp_lcd_dpi_panel_event_callbacks_t *cbs, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
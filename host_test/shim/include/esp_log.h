@@ -0,0 +1,31 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Host stand-in for esp_log.h: everything goes to stderr with level and tag. */
+
+#include <stdio.h>
+
+typedef enum { ESP_LOG_NONE, ESP_LOG_ERROR, ESP_LOG_WARN, ESP_LOG_INFO, ESP_LOG_DEBUG, ESP_LOG_VERBOSE } esp_log_level_t;
+
+/* Lowest level printed (default ESP_LOG_INFO); tests can quiet expected errors. */
+extern esp_log_level_t esp_shim_log_level;
+
+#define ESP_SHIM_LOG(lvl, c, tag, fmt, ...) do {                                   \
+        if ((lvl) <= esp_shim_log_level) fprintf(stderr, c " (%s) " fmt "\n", tag, ##__VA_ARGS__); \
+    } while (0)
+
+#define ESP_LOGE(tag, fmt, ...) ESP_SHIM_LOG(ESP_LOG_ERROR,   "E", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) ESP_SHIM_LOG(ESP_LOG_WARN,    "W", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) ESP_SHIM_LOG(ESP_LOG_INFO,    "I", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGD(tag, fmt, ...) ESP_SHIM_LOG(ESP_LOG_DEBUG,   "D", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGV(tag, fmt, ...) ESP_SHIM_LOG(ESP_LOG_VERBOSE, "V", tag, fmt, ##__VA_ARGS__)
+
+#define ESP_EARLY_LOGE ESP_LOGE
+#define ESP_EARLY_LOGW ESP_LOGW
+#define ESP_EARLY_LOGI ESP_LOGI
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,7 @@
+#pragma once
+#include <stdbool.h>
+/* Host: answered from the esp_heap_caps shim's allocation table. */
+bool esp_ptr_external_ram(const void *p);
+bool esp_ptr_internal(const void *p);
+bool esp_ptr_dma_capable(const void *p);
+bool esp_ptr_dma_ext_capable(const void *p);
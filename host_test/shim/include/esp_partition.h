@@ -0,0 +1,57 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Host partitions: an in-memory table filled by the test or bench before the
+ * code under test looks anything up. mmap hands out the backing buffer.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef enum {
+    ESP_PARTITION_TYPE_APP  = 0x00,
+    ESP_PARTITION_TYPE_DATA = 0x01,
+    ESP_PARTITION_TYPE_ANY  = 0xff,
+} esp_partition_type_t;
+
+typedef enum {
+    ESP_PARTITION_SUBTYPE_DATA_UNDEFINED = 0x06,
+    ESP_PARTITION_SUBTYPE_ANY            = 0xff,
+} esp_partition_subtype_t;
+
+typedef enum { ESP_PARTITION_MMAP_DATA, ESP_PARTITION_MMAP_INST } esp_partition_mmap_memory_t;
+typedef uint32_t esp_partition_mmap_handle_t;
+
+typedef struct {
+    void                   *flash_chip;
+    esp_partition_type_t    type;
+    esp_partition_subtype_t subtype;
+    uint32_t                address;
+    uint32_t                size;
+    uint32_t                erase_size;
+    char                    label[17];
+    bool                    encrypted;
+    bool                    readonly;
+} esp_partition_t;
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char *label);
+esp_err_t esp_partition_read(const esp_partition_t *p, size_t offset, void *dst, size_t size);
+esp_err_t esp_partition_mmap(const esp_partition_t *p, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory, const void **out_ptr,
+                             esp_partition_mmap_handle_t *out_handle);
+void      esp_partition_munmap(esp_partition_mmap_handle_t handle);
+
+/** Host only: register a data partition backed by data (not copied; must outlive it). */
+esp_err_t esp_shim_partition_add(const char *label, const void *data, size_t size);
+/** Host only: drop every registered partition. */
+void      esp_shim_partition_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
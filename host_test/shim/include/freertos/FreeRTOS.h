@@ -0,0 +1,58 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Host stand-in for the ESP-IDF FreeRTOS port, on pthreads.
+ * Tasks are threads; "cores" are a per-thread id taken from the pinning
+ * argument. Critical sections are recursive mutexes, so they exclude other
+ * threads but (unlike the real port) do not stop preemption.
+ */
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int          BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t     TickType_t;
+typedef uint32_t     StackType_t;
+
+#define pdTRUE   1
+#define pdFALSE  0
+#define pdPASS   pdTRUE
+#define pdFAIL   pdFALSE
+
+#define portMAX_DELAY        ((TickType_t)0xFFFFFFFFu)
+#define configTICK_RATE_HZ   100
+#define portTICK_PERIOD_MS   (1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)    ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000u))
+#define configMAX_PRIORITIES 25
+#define configASSERT(x)      assert(x)
+
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES 2
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 2
+
+#define portNUM_PROCESSORS   2
+#define tskNO_AFFINITY       (-1)
+
+typedef pthread_mutex_t portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP
+void shim_mux_init(portMUX_TYPE *m);
+#define portMUX_INITIALIZE(m)        shim_mux_init(m)
+#define portENTER_CRITICAL(m)        pthread_mutex_lock(m)
+#define portEXIT_CRITICAL(m)         pthread_mutex_unlock(m)
+#define portENTER_CRITICAL_ISR(m)    pthread_mutex_lock(m)
+#define portEXIT_CRITICAL_ISR(m)     pthread_mutex_unlock(m)
+#define portENTER_CRITICAL_SAFE(m)   pthread_mutex_lock(m)
+#define portEXIT_CRITICAL_SAFE(m)    pthread_mutex_unlock(m)
+#define portYIELD_FROM_ISR(...)      ((void)0)
+
+BaseType_t xPortGetCoreID(void);
+
+#ifdef __cplusplus
+}
+#endif
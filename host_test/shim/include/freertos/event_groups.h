@@ -0,0 +1,21 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct shim_event_group *EventGroupHandle_t;
+typedef uint32_t EventBits_t;
+
+EventGroupHandle_t xEventGroupCreate(void);
+void               vEventGroupDelete(EventGroupHandle_t g);
+EventBits_t        xEventGroupSetBits(EventGroupHandle_t g, EventBits_t bits);
+EventBits_t        xEventGroupClearBits(EventGroupHandle_t g, EventBits_t bits);
+EventBits_t        xEventGroupGetBits(EventGroupHandle_t g);
+EventBits_t        xEventGroupWaitBits(EventGroupHandle_t g, EventBits_t bits, BaseType_t clear,
+                                       BaseType_t wait_all, TickType_t ticks);
+
+#ifdef __cplusplus
+}
+#endif
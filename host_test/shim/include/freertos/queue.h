@@ -0,0 +1,22 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct shim_queue *QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+void          vQueueDelete(QueueHandle_t q);
+BaseType_t    xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks);
+BaseType_t    xQueueSendToFront(QueueHandle_t q, const void *item, TickType_t ticks);
+BaseType_t    xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks);
+BaseType_t    xQueueReset(QueueHandle_t q);
+UBaseType_t   uxQueueMessagesWaiting(QueueHandle_t q);
+#define xQueueSendToBack(q, item, ticks)    xQueueSend((q), (item), (ticks))
+#define xQueueSendFromISR(q, item, woken)   xQueueSend((q), (item), 0)
+
+#ifdef __cplusplus
+}
+#endif
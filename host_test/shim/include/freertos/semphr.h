@@ -0,0 +1,25 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct shim_sem *SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void);
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial);
+void              vSemaphoreDelete(SemaphoreHandle_t s);
+
+BaseType_t  xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks);
+BaseType_t  xSemaphoreGive(SemaphoreHandle_t s);
+BaseType_t  xSemaphoreTakeRecursive(SemaphoreHandle_t s, TickType_t ticks);
+BaseType_t  xSemaphoreGiveRecursive(SemaphoreHandle_t s);
+BaseType_t  xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t *woken);
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t s);
+
+#ifdef __cplusplus
+}
+#endif
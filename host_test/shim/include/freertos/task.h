@@ -0,0 +1,41 @@
+#pragma once
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct shim_task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *arg);
+typedef void (*TlsDeleteCallbackFunction_t)(int index, void *value);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_bytes,
+                                   void *arg, UBaseType_t prio, TaskHandle_t *out, BaseType_t core);
+#define xTaskCreate(fn, name, stack, arg, prio, out) \
+    xTaskCreatePinnedToCore((fn), (name), (stack), (arg), (prio), (out), tskNO_AFFINITY)
+
+/** Only self-deletion (NULL or the caller's own handle) is supported. */
+void         vTaskDelete(TaskHandle_t t);
+void         vTaskDelay(TickType_t ticks);
+TickType_t   xTaskGetTickCount(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+UBaseType_t  uxTaskPriorityGet(TaskHandle_t t);
+void         vTaskPrioritySet(TaskHandle_t t, UBaseType_t prio);
+const char  *pcTaskGetName(TaskHandle_t t);
+
+/* Notifications: counting semantics only (Give/Take), per index. */
+BaseType_t xTaskNotifyGiveIndexed(TaskHandle_t t, UBaseType_t index);
+void       vTaskNotifyGiveIndexedFromISR(TaskHandle_t t, UBaseType_t index, BaseType_t *woken);
+uint32_t   ulTaskNotifyTakeIndexed(UBaseType_t index, BaseType_t clear, TickType_t ticks);
+#define xTaskNotifyGive(t)                 xTaskNotifyGiveIndexed((t), 0)
+#define vTaskNotifyGiveFromISR(t, woken)   vTaskNotifyGiveIndexedFromISR((t), 0, (woken))
+#define ulTaskNotifyTake(clear, ticks)     ulTaskNotifyTakeIndexed(0, (clear), (ticks))
+
+void *pvTaskGetThreadLocalStoragePointer(TaskHandle_t t, BaseType_t index);
+void  vTaskSetThreadLocalStoragePointer(TaskHandle_t t, BaseType_t index, void *value);
+void  vTaskSetThreadLocalStoragePointerAndDelCallback(TaskHandle_t t, BaseType_t index, void *value,
+                                                      TlsDeleteCallbackFunction_t cb);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,7 @@
+#pragma once
+#include "driver/i2c_master.h"
+/* Host: bus creation fails, so hardware touch init reports an error cleanly. */
+typedef struct i2c_bus_t *i2c_bus_handle_t;
+i2c_bus_handle_t        i2c_bus_create(i2c_port_t port, const i2c_config_t *conf);
+i2c_master_bus_handle_t i2c_bus_get_internal_bus_handle(i2c_bus_handle_t bus);
+esp_err_t               i2c_bus_delete(i2c_bus_handle_t bus);
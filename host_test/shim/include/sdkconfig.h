@@ -0,0 +1,4 @@
+#pragma once
+/* Host build configuration: the options the components test for. */
+#define CONFIG_ESP_TIMER_SUPPORTS_ISR_DISPATCH_METHOD 1
+#define CONFIG_FREERTOS_HZ 100
@@ -0,0 +1,105 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "esp_cache.h"
+#include "esp_cpu.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+#include "i2c_bus.h"
+
+esp_log_level_t esp_shim_log_level = ESP_LOG_INFO;
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    switch (code) {
+    case ESP_OK:                   return "ESP_OK";
+    case ESP_FAIL:                 return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:           return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:      return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE:    return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE:     return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND:        return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_NOT_SUPPORTED:    return "ESP_ERR_NOT_SUPPORTED";
+    case ESP_ERR_TIMEOUT:          return "ESP_ERR_TIMEOUT";
+    case ESP_ERR_INVALID_RESPONSE: return "ESP_ERR_INVALID_RESPONSE";
+    case ESP_ERR_INVALID_CRC:      return "ESP_ERR_INVALID_CRC";
+    case ESP_ERR_INVALID_VERSION:  return "ESP_ERR_INVALID_VERSION";
+    case ESP_ERR_NOT_FINISHED:     return "ESP_ERR_NOT_FINISHED";
+    default:                       return "UNKNOWN ERROR";
+    }
+}
+
+void esp_shim_abort(const char *file, int line, const char *expr, esp_err_t err)
+{
+    fprintf(stderr, "%s:%d: ESP_ERROR_CHECK(%s) failed: %s (0x%x)\n",
+            file, line, expr, esp_err_to_name(err), err);
+    abort();
+}
+
+/* ---- small leaf APIs ---- */
+
+uint32_t esp_cpu_get_cycle_count(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec);
+}
+
+void esp_rom_delay_us(uint32_t us)
+{
+    const int64_t until = esp_timer_get_time() + us;
+    while (esp_timer_get_time() < until) {}
+}
+
+esp_err_t esp_cache_msync(void *addr, size_t size, int flags)
+{
+    return addr ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_cache_get_alignment(uint32_t heap_caps, size_t *out_alignment)
+{
+    if (!out_alignment) return ESP_ERR_INVALID_ARG;
+    *out_alignment = 64;
+    return ESP_OK;
+}
+
+/* ---- I2C: no bus on the host ---- */
+
+i2c_bus_handle_t i2c_bus_create(i2c_port_t port, const i2c_config_t *conf)
+{
+    return NULL;
+}
+
+i2c_master_bus_handle_t i2c_bus_get_internal_bus_handle(i2c_bus_handle_t bus)
+{
+    return NULL;
+}
+
+esp_err_t i2c_bus_delete(i2c_bus_handle_t bus)
+{
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus, const i2c_device_config_t *cfg,
+                                    i2c_master_dev_handle_t *out)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t i2c_master_bus_rm_device(i2c_master_dev_handle_t dev)
+{
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t dev, const uint8_t *buf, size_t len, int timeout_ms)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t i2c_master_receive(i2c_master_dev_handle_t dev, uint8_t *buf, size_t len, int timeout_ms)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
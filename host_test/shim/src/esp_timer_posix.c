@@ -0,0 +1,173 @@
+/*
+ * esp_timer on one dispatcher thread. Callbacks of both dispatch methods run
+ * there, one at a time, in deadline order; a periodic timer is re-armed from
+ * its previous deadline so it does not drift.
+ */
+#include "esp_timer.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+struct esp_timer {
+    esp_timer_create_args_t args;
+    uint64_t                due_us;
+    uint64_t                period_us;    // 0 = one-shot
+    bool                    armed;
+    struct esp_timer       *next;         // armed list, sorted by due_us
+};
+
+static pthread_mutex_t   s_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t    s_cond;
+static pthread_once_t    s_once = PTHREAD_ONCE_INIT;
+static struct esp_timer *s_armed;
+static uint64_t          s_epoch_ns;
+
+static uint64_t mono_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void set_epoch(void)
+{
+    s_epoch_ns = mono_ns();
+}
+
+int64_t esp_timer_get_time(void)
+{
+    static pthread_once_t epoch_once = PTHREAD_ONCE_INIT;
+    pthread_once(&epoch_once, set_epoch);
+    return (int64_t)((mono_ns() - s_epoch_ns) / 1000u);
+}
+
+static void unlink_locked(struct esp_timer *t)
+{
+    for (struct esp_timer **pp = &s_armed; *pp; pp = &(*pp)->next) {
+        if (*pp == t) {
+            *pp = t->next;
+            break;
+        }
+    }
+    t->next  = NULL;
+    t->armed = false;
+}
+
+static void insert_locked(struct esp_timer *t)
+{
+    struct esp_timer **pp = &s_armed;
+    while (*pp && (*pp)->due_us <= t->due_us) pp = &(*pp)->next;
+    t->next  = *pp;
+    *pp      = t;
+    t->armed = true;
+    pthread_cond_signal(&s_cond);
+}
+
+static void *dispatcher(void *arg)
+{
+    pthread_mutex_lock(&s_lock);
+    for (;;) {
+        if (!s_armed) {
+            pthread_cond_wait(&s_cond, &s_lock);
+            continue;
+        }
+        struct esp_timer *t = s_armed;
+        const uint64_t now = (uint64_t)esp_timer_get_time();
+        if (t->due_us > now) {
+            const uint64_t abs_ns = s_epoch_ns + t->due_us * 1000u;
+            const struct timespec ts = { .tv_sec = (time_t)(abs_ns / 1000000000ull),
+                                         .tv_nsec = (long)(abs_ns % 1000000000ull) };
+            pthread_cond_timedwait(&s_cond, &s_lock, &ts);
+            continue;
+        }
+        unlink_locked(t);
+        if (t->period_us) {
+            t->due_us += t->period_us;
+            if (t->args.skip_unhandled_events && t->due_us <= now) t->due_us = now + t->period_us;
+            insert_locked(t);
+        }
+        const esp_timer_cb_t cb = t->args.callback;
+        void *cb_arg = t->args.arg;
+        pthread_mutex_unlock(&s_lock);
+        cb(cb_arg);
+        pthread_mutex_lock(&s_lock);
+    }
+    return NULL;
+}
+
+static void start_dispatcher(void)
+{
+    pthread_condattr_t a;
+    pthread_condattr_init(&a);
+    pthread_condattr_setclock(&a, CLOCK_MONOTONIC);
+    pthread_cond_init(&s_cond, &a);
+    pthread_condattr_destroy(&a);
+    (void)esp_timer_get_time();   // pin the epoch
+
+    pthread_t th;
+    pthread_create(&th, NULL, dispatcher, NULL);
+    pthread_detach(th);
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out)
+{
+    if (!args || !args->callback || !out) return ESP_ERR_INVALID_ARG;
+    pthread_once(&s_once, start_dispatcher);
+    struct esp_timer *t = calloc(1, sizeof(*t));
+    if (!t) return ESP_ERR_NO_MEM;
+    t->args = *args;
+    *out = t;
+    return ESP_OK;
+}
+
+static esp_err_t start(esp_timer_handle_t t, uint64_t us, uint64_t period)
+{
+    if (!t) return ESP_ERR_INVALID_ARG;
+    pthread_mutex_lock(&s_lock);
+    const bool busy = t->armed;
+    if (!busy) {
+        t->due_us    = (uint64_t)esp_timer_get_time() + us;
+        t->period_us = period;
+        insert_locked(t);
+    }
+    pthread_mutex_unlock(&s_lock);
+    return busy ? ESP_ERR_INVALID_STATE : ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t t, uint64_t timeout_us)  { return start(t, timeout_us, 0); }
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t t, uint64_t period_us) { return start(t, period_us, period_us); }
+
+esp_err_t esp_timer_stop(esp_timer_handle_t t)
+{
+    if (!t) return ESP_ERR_INVALID_ARG;
+    pthread_mutex_lock(&s_lock);
+    const bool armed = t->armed;
+    if (armed) unlink_locked(t);
+    pthread_mutex_unlock(&s_lock);
+    return armed ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t t)
+{
+    if (!t) return ESP_ERR_INVALID_ARG;
+    pthread_mutex_lock(&s_lock);
+    const bool armed = t->armed;
+    pthread_mutex_unlock(&s_lock);
+    if (armed) return ESP_ERR_INVALID_STATE;
+    free(t);
+    return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t t)
+{
+    pthread_mutex_lock(&s_lock);
+    const bool armed = t && t->armed;
+    pthread_mutex_unlock(&s_lock);
+    return armed;
+}
+
+void esp_timer_isr_dispatch_need_yield(void)
+{
+}
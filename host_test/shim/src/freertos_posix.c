@@ -0,0 +1,505 @@
+/*
+ * FreeRTOS subset on pthreads (see freertos/FreeRTOS.h for the model).
+ * Every primitive is a mutex + condition variable on CLOCK_MONOTONIC;
+ * tick-based timeouts are rounded the way the real scheduler rounds them.
+ */
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include <errno.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define TICK_NS (1000000000ull / configTICK_RATE_HZ)
+
+struct shim_task {
+    pthread_t       th;
+    char            name[16];
+    int             core;
+    UBaseType_t     prio;
+    TaskFunction_t  fn;
+    void           *arg;
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    uint32_t        notify[configTASK_NOTIFICATION_ARRAY_ENTRIES];
+    void           *tls[configNUM_THREAD_LOCAL_STORAGE_POINTERS];
+    TlsDeleteCallbackFunction_t tls_cb[configNUM_THREAD_LOCAL_STORAGE_POINTERS];
+};
+
+static __thread struct shim_task *t_self;
+static int s_next_core;   // unpinned tasks alternate cores, like the SMP scheduler spreading load
+
+static uint64_t mono_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void cond_init(pthread_cond_t *c)
+{
+    pthread_condattr_t a;
+    pthread_condattr_init(&a);
+    pthread_condattr_setclock(&a, CLOCK_MONOTONIC);
+    pthread_cond_init(c, &a);
+    pthread_condattr_destroy(&a);
+}
+
+/* Absolute deadline for a tick timeout; false means wait forever. */
+static bool deadline(TickType_t ticks, struct timespec *ts)
+{
+    if (ticks == portMAX_DELAY) return false;
+    const uint64_t t = mono_ns() + (uint64_t)ticks * TICK_NS;
+    ts->tv_sec  = (time_t)(t / 1000000000ull);
+    ts->tv_nsec = (long)(t % 1000000000ull);
+    return true;
+}
+
+/* Wait on c until woken; returns false once the deadline (if any) has passed. */
+static bool cond_wait_until(pthread_cond_t *c, pthread_mutex_t *m, bool timed, const struct timespec *ts)
+{
+    if (!timed) {
+        pthread_cond_wait(c, m);
+        return true;
+    }
+    return pthread_cond_timedwait(c, m, ts) != ETIMEDOUT;
+}
+
+void shim_mux_init(portMUX_TYPE *m)
+{
+    pthread_mutexattr_t a;
+    pthread_mutexattr_init(&a);
+    pthread_mutexattr_settype(&a, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(m, &a);
+    pthread_mutexattr_destroy(&a);
+}
+
+/* ---- tasks ---- */
+
+static struct shim_task *task_new(const char *name, int core, UBaseType_t prio)
+{
+    struct shim_task *t = calloc(1, sizeof(*t));
+    if (!t) return NULL;
+    strncpy(t->name, name ? name : "", sizeof(t->name) - 1);
+    t->core = core;
+    t->prio = prio;
+    pthread_mutex_init(&t->lock, NULL);
+    cond_init(&t->cond);
+    return t;
+}
+
+static struct shim_task *self(void)
+{
+    if (!t_self) t_self = task_new("main", 0, 1);   // threads not created through the shim
+    return t_self;
+}
+
+static void task_exit(struct shim_task *t)
+{
+    for (int i = 0; i < configNUM_THREAD_LOCAL_STORAGE_POINTERS; ++i) {
+        if (t->tls_cb[i]) t->tls_cb[i](i, t->tls[i]);
+    }
+    t_self = NULL;
+    pthread_mutex_destroy(&t->lock);
+    pthread_cond_destroy(&t->cond);
+    free(t);
+}
+
+static void *trampoline(void *p)
+{
+    struct shim_task *t = p;
+    t_self = t;
+    t->fn(t->arg);
+    task_exit(t);   // returning from a task function counts as deleting it
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_bytes,
+                                   void *arg, UBaseType_t prio, TaskHandle_t *out, BaseType_t core)
+{
+    if (core == tskNO_AFFINITY) core = __atomic_fetch_add(&s_next_core, 1, __ATOMIC_RELAXED) % portNUM_PROCESSORS;
+    struct shim_task *t = task_new(name, core, prio);
+    if (!t) return pdFAIL;
+    t->fn  = fn;
+    t->arg = arg;
+
+    pthread_attr_t a;
+    pthread_attr_init(&a);
+    pthread_attr_setdetachstate(&a, PTHREAD_CREATE_DETACHED);
+    if (stack_bytes < 64 * 1024) stack_bytes = 64 * 1024;   // host frames are larger than Xtensa/RISC-V ones
+    pthread_attr_setstacksize(&a, stack_bytes);
+    if (out) *out = t;   // published before the thread can run, as with the real API
+    const int rc = pthread_create(&t->th, &a, trampoline, t);
+    pthread_attr_destroy(&a);
+    if (rc != 0) {
+        if (out) *out = NULL;
+        free(t);
+        return pdFAIL;
+    }
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t t)
+{
+    configASSERT(t == NULL || t == t_self);
+    task_exit(self());
+    pthread_exit(NULL);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    if (ticks == 0) {
+        sched_yield();
+        return;
+    }
+    /* Wake on the ticks-th tick boundary from now, as the tick interrupt would. */
+    const uint64_t now = mono_ns();
+    const uint64_t until = (now / TICK_NS + ticks) * TICK_NS;
+    const struct timespec ts = { .tv_sec = (time_t)(until / 1000000000ull), .tv_nsec = (long)(until % 1000000000ull) };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {}
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(mono_ns() / TICK_NS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return self();
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t t)
+{
+    return (t ? t : self())->prio;
+}
+
+void vTaskPrioritySet(TaskHandle_t t, UBaseType_t prio)
+{
+    (t ? t : self())->prio = prio;
+}
+
+const char *pcTaskGetName(TaskHandle_t t)
+{
+    return (t ? t : self())->name;
+}
+
+BaseType_t xPortGetCoreID(void)
+{
+    return self()->core;
+}
+
+BaseType_t xTaskNotifyGiveIndexed(TaskHandle_t t, UBaseType_t index)
+{
+    configASSERT(t && index < configTASK_NOTIFICATION_ARRAY_ENTRIES);
+    pthread_mutex_lock(&t->lock);
+    t->notify[index]++;
+    pthread_cond_broadcast(&t->cond);
+    pthread_mutex_unlock(&t->lock);
+    return pdPASS;
+}
+
+void vTaskNotifyGiveIndexedFromISR(TaskHandle_t t, UBaseType_t index, BaseType_t *woken)
+{
+    (void)xTaskNotifyGiveIndexed(t, index);
+    if (woken) *woken = pdTRUE;
+}
+
+uint32_t ulTaskNotifyTakeIndexed(UBaseType_t index, BaseType_t clear, TickType_t ticks)
+{
+    configASSERT(index < configTASK_NOTIFICATION_ARRAY_ENTRIES);
+    struct shim_task *t = self();
+    struct timespec ts;
+    const bool timed = deadline(ticks, &ts);
+    pthread_mutex_lock(&t->lock);
+    while (t->notify[index] == 0 && ticks != 0 && cond_wait_until(&t->cond, &t->lock, timed, &ts)) {}
+    const uint32_t v = t->notify[index];
+    if (v) t->notify[index] = clear ? 0 : v - 1;
+    pthread_mutex_unlock(&t->lock);
+    return v;
+}
+
+void *pvTaskGetThreadLocalStoragePointer(TaskHandle_t t, BaseType_t index)
+{
+    configASSERT(index >= 0 && index < configNUM_THREAD_LOCAL_STORAGE_POINTERS);
+    return (t ? t : self())->tls[index];
+}
+
+void vTaskSetThreadLocalStoragePointerAndDelCallback(TaskHandle_t t, BaseType_t index, void *value,
+                                                      TlsDeleteCallbackFunction_t cb)
+{
+    configASSERT(index >= 0 && index < configNUM_THREAD_LOCAL_STORAGE_POINTERS);
+    t = t ? t : self();
+    t->tls[index]    = value;
+    t->tls_cb[index] = cb;
+}
+
+void vTaskSetThreadLocalStoragePointer(TaskHandle_t t, BaseType_t index, void *value)
+{
+    vTaskSetThreadLocalStoragePointerAndDelCallback(t, index, value, NULL);
+}
+
+/* ---- semaphores ---- */
+
+struct shim_sem {
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    UBaseType_t     count, max;
+    TaskHandle_t    owner;    // recursive mutexes
+    UBaseType_t     depth;
+};
+
+static SemaphoreHandle_t sem_new(UBaseType_t max, UBaseType_t initial)
+{
+    struct shim_sem *s = calloc(1, sizeof(*s));
+    if (!s) return NULL;
+    pthread_mutex_init(&s->lock, NULL);
+    cond_init(&s->cond);
+    s->max   = max;
+    s->count = initial;
+    return s;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)            { return sem_new(1, 1); }
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void)   { return sem_new(1, 1); }
+SemaphoreHandle_t xSemaphoreCreateBinary(void)           { return sem_new(1, 0); }
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial) { return sem_new(max, initial); }
+
+void vSemaphoreDelete(SemaphoreHandle_t s)
+{
+    if (!s) return;
+    pthread_mutex_destroy(&s->lock);
+    pthread_cond_destroy(&s->cond);
+    free(s);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks)
+{
+    struct timespec ts;
+    const bool timed = deadline(ticks, &ts);
+    pthread_mutex_lock(&s->lock);
+    while (s->count == 0 && ticks != 0 && cond_wait_until(&s->cond, &s->lock, timed, &ts)) {}
+    const bool ok = s->count > 0;
+    if (ok) s->count--;
+    pthread_mutex_unlock(&s->lock);
+    return ok ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s)
+{
+    pthread_mutex_lock(&s->lock);
+    const bool ok = s->count < s->max;
+    if (ok) {
+        s->count++;
+        pthread_cond_signal(&s->cond);
+    }
+    pthread_mutex_unlock(&s->lock);
+    return ok ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t *woken)
+{
+    const BaseType_t r = xSemaphoreGive(s);
+    if (woken) *woken = pdTRUE;
+    return r;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t s, TickType_t ticks)
+{
+    TaskHandle_t me = self();
+    pthread_mutex_lock(&s->lock);
+    if (s->owner == me) {
+        s->depth++;
+        pthread_mutex_unlock(&s->lock);
+        return pdTRUE;
+    }
+    pthread_mutex_unlock(&s->lock);
+    if (!xSemaphoreTake(s, ticks)) return pdFALSE;
+    pthread_mutex_lock(&s->lock);
+    s->owner = me;
+    s->depth = 1;
+    pthread_mutex_unlock(&s->lock);
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t s)
+{
+    pthread_mutex_lock(&s->lock);
+    if (s->owner != self()) {
+        pthread_mutex_unlock(&s->lock);
+        return pdFALSE;
+    }
+    const bool release = --s->depth == 0;
+    if (release) s->owner = NULL;
+    pthread_mutex_unlock(&s->lock);
+    return release ? xSemaphoreGive(s) : pdTRUE;
+}
+
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t s)
+{
+    pthread_mutex_lock(&s->lock);
+    const UBaseType_t n = s->count;
+    pthread_mutex_unlock(&s->lock);
+    return n;
+}
+
+/* ---- queues ---- */
+
+struct shim_queue {
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;     // any change; waiters re-check their own condition
+    UBaseType_t     len, size, head, count;
+    uint8_t        *buf;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    struct shim_queue *q = calloc(1, sizeof(*q));
+    if (!q) return NULL;
+    q->buf = malloc((size_t)length * item_size + 1);
+    if (!q->buf) {
+        free(q);
+        return NULL;
+    }
+    pthread_mutex_init(&q->lock, NULL);
+    cond_init(&q->cond);
+    q->len  = length;
+    q->size = item_size;
+    return q;
+}
+
+void vQueueDelete(QueueHandle_t q)
+{
+    if (!q) return;
+    pthread_mutex_destroy(&q->lock);
+    pthread_cond_destroy(&q->cond);
+    free(q->buf);
+    free(q);
+}
+
+static BaseType_t queue_put(QueueHandle_t q, const void *item, TickType_t ticks, bool front)
+{
+    struct timespec ts;
+    const bool timed = deadline(ticks, &ts);
+    pthread_mutex_lock(&q->lock);
+    while (q->count == q->len && ticks != 0 && cond_wait_until(&q->cond, &q->lock, timed, &ts)) {}
+    const bool ok = q->count < q->len;
+    if (ok) {
+        if (front) q->head = (q->head + q->len - 1) % q->len;
+        const UBaseType_t slot = front ? q->head : (q->head + q->count) % q->len;
+        memcpy(q->buf + (size_t)slot * q->size, item, q->size);
+        q->count++;
+        pthread_cond_broadcast(&q->cond);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return ok ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks)        { return queue_put(q, item, ticks, false); }
+BaseType_t xQueueSendToFront(QueueHandle_t q, const void *item, TickType_t ticks) { return queue_put(q, item, ticks, true); }
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks)
+{
+    struct timespec ts;
+    const bool timed = deadline(ticks, &ts);
+    pthread_mutex_lock(&q->lock);
+    while (q->count == 0 && ticks != 0 && cond_wait_until(&q->cond, &q->lock, timed, &ts)) {}
+    const bool ok = q->count > 0;
+    if (ok) {
+        memcpy(item, q->buf + (size_t)q->head * q->size, q->size);
+        q->head = (q->head + 1) % q->len;
+        q->count--;
+        pthread_cond_broadcast(&q->cond);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return ok ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xQueueReset(QueueHandle_t q)
+{
+    pthread_mutex_lock(&q->lock);
+    q->head = q->count = 0;
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->lock);
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q)
+{
+    pthread_mutex_lock(&q->lock);
+    const UBaseType_t n = q->count;
+    pthread_mutex_unlock(&q->lock);
+    return n;
+}
+
+/* ---- event groups ---- */
+
+struct shim_event_group {
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    EventBits_t     bits;
+};
+
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    struct shim_event_group *g = calloc(1, sizeof(*g));
+    if (!g) return NULL;
+    pthread_mutex_init(&g->lock, NULL);
+    cond_init(&g->cond);
+    return g;
+}
+
+void vEventGroupDelete(EventGroupHandle_t g)
+{
+    if (!g) return;
+    pthread_mutex_destroy(&g->lock);
+    pthread_cond_destroy(&g->cond);
+    free(g);
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t g, EventBits_t bits)
+{
+    pthread_mutex_lock(&g->lock);
+    g->bits |= bits;
+    const EventBits_t v = g->bits;
+    pthread_cond_broadcast(&g->cond);
+    pthread_mutex_unlock(&g->lock);
+    return v;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t g, EventBits_t bits)
+{
+    pthread_mutex_lock(&g->lock);
+    const EventBits_t v = g->bits;
+    g->bits &= ~bits;
+    pthread_mutex_unlock(&g->lock);
+    return v;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t g)
+{
+    pthread_mutex_lock(&g->lock);
+    const EventBits_t v = g->bits;
+    pthread_mutex_unlock(&g->lock);
+    return v;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t g, EventBits_t bits, BaseType_t clear,
+                                BaseType_t wait_all, TickType_t ticks)
+{
+    struct timespec ts;
+    const bool timed = deadline(ticks, &ts);
+    pthread_mutex_lock(&g->lock);
+#define MET() (wait_all ? (g->bits & bits) == bits : (g->bits & bits) != 0)
+    while (!MET() && ticks != 0 && cond_wait_until(&g->cond, &g->lock, timed, &ts)) {}
+    const EventBits_t v = g->bits;
+    if (MET() && clear) g->bits &= ~bits;
+#undef MET
+    pthread_mutex_unlock(&g->lock);
+    return v;
+}
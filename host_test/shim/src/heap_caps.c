@@ -0,0 +1,231 @@
+/*
+ * esp_heap_caps on the C heap (see esp_heap_caps.h). The allocation table is
+ * an open-addressed hash keyed by pointer; it only grows.
+ */
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ALIGN 64
+
+typedef struct {
+    const void *p;      // NULL = empty, TOMB = deleted
+    size_t      size;
+    bool        psram;
+} block_t;
+
+static const char TOMB_[1];
+#define TOMB ((const void *)TOMB_)
+
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static block_t *s_tab;
+static size_t   s_cap, s_used;                 // slots, occupied + tombstones
+static size_t   s_live[2], s_low_free[2] = { ESP_SHIM_HEAP_INTERNAL_BYTES, ESP_SHIM_HEAP_PSRAM_BYTES };
+static uint32_t s_fail_mask;
+static int      s_fail_count;
+static esp_alloc_failed_hook_t s_failed_cb;
+
+static const size_t kPool[2] = { ESP_SHIM_HEAP_INTERNAL_BYTES, ESP_SHIM_HEAP_PSRAM_BYTES };
+
+static size_t slot_of(const void *p)
+{
+    uintptr_t h = (uintptr_t)p / ALIGN;
+    h ^= h >> 17;
+    h *= 0x9E3779B97F4A7C15ull;
+    return (size_t)(h >> 7) & (s_cap - 1);
+}
+
+static block_t *find_locked(const void *p)
+{
+    if (!s_cap || !p) return NULL;
+    for (size_t i = slot_of(p), n = 0; n < s_cap; i = (i + 1) & (s_cap - 1), ++n) {
+        if (s_tab[i].p == p) return &s_tab[i];
+        if (!s_tab[i].p) return NULL;
+    }
+    return NULL;
+}
+
+static bool insert_locked(const void *p, size_t size, bool psram);
+
+static bool grow_locked(void)
+{
+    block_t *old = s_tab;
+    const size_t old_cap = s_cap;
+    s_cap  = old_cap ? old_cap * 2 : 1024;
+    s_tab  = calloc(s_cap, sizeof(*s_tab));
+    s_used = 0;
+    if (!s_tab) return false;
+    for (size_t i = 0; i < old_cap; ++i) {
+        if (old[i].p && old[i].p != TOMB) insert_locked(old[i].p, old[i].size, old[i].psram);
+    }
+    free(old);
+    return true;
+}
+
+static bool insert_locked(const void *p, size_t size, bool psram)
+{
+    if ((s_used + 1) * 2 > s_cap && !grow_locked()) return false;
+    size_t i = slot_of(p);
+    while (s_tab[i].p && s_tab[i].p != TOMB) i = (i + 1) & (s_cap - 1);
+    if (!s_tab[i].p) s_used++;
+    s_tab[i] = (block_t){ .p = p, .size = size, .psram = psram };
+    return true;
+}
+
+/* Where a request lands: PSRAM if asked, internal if asked, else by size (DEFAULT). */
+static bool lands_in_psram(size_t size, uint32_t caps)
+{
+    if (caps & MALLOC_CAP_SPIRAM) return true;
+    if (caps & (MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA | MALLOC_CAP_EXEC)) return false;
+    return size >= ESP_SHIM_HEAP_ALWAYSINTERNAL;
+}
+
+static void *alloc(size_t alignment, size_t size, uint32_t caps, const char *fn)
+{
+    const bool psram = lands_in_psram(size, caps);
+    void *p = NULL;
+
+    pthread_mutex_lock(&s_lock);
+    bool fail = s_live[psram] + size > kPool[psram];
+    if (!fail && s_fail_count && (caps & s_fail_mask) == s_fail_mask) {
+        s_fail_count--;
+        fail = true;
+    }
+    if (!fail) {
+        if (alignment < ALIGN) alignment = ALIGN;
+        if (posix_memalign(&p, alignment, size ? size : 1) != 0) p = NULL;
+        if (p && !insert_locked(p, size, psram)) {
+            free(p);
+            p = NULL;
+        }
+        if (p) {
+            s_live[psram] += size;
+            const size_t free_now = kPool[psram] - s_live[psram];
+            if (free_now < s_low_free[psram]) s_low_free[psram] = free_now;
+        }
+    }
+    const esp_alloc_failed_hook_t cb = s_failed_cb;
+    pthread_mutex_unlock(&s_lock);
+
+    if (!p && cb) cb(size, caps, fn);
+    return p;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    return alloc(0, size, caps, __func__);
+}
+
+void *heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps)
+{
+    return alloc(alignment, size, caps, __func__);
+}
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    if (size && n > SIZE_MAX / size) return NULL;
+    void *p = alloc(0, n * size, caps, __func__);
+    if (p) memset(p, 0, n * size);
+    return p;
+}
+
+void *heap_caps_aligned_calloc(size_t alignment, size_t n, size_t size, uint32_t caps)
+{
+    if (size && n > SIZE_MAX / size) return NULL;
+    void *p = alloc(alignment, n * size, caps, __func__);
+    if (p) memset(p, 0, n * size);
+    return p;
+}
+
+void heap_caps_free(void *p)
+{
+    if (!p) return;
+    pthread_mutex_lock(&s_lock);
+    block_t *b = find_locked(p);
+    if (b) {
+        s_live[b->psram] -= b->size;
+        b->p = TOMB;
+    }
+    pthread_mutex_unlock(&s_lock);
+    free(p);
+}
+
+static int pool_of(uint32_t caps)
+{
+    return (caps & MALLOC_CAP_SPIRAM) ? 1 : 0;
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    pthread_mutex_lock(&s_lock);
+    const int k = pool_of(caps);
+    const size_t v = kPool[k] - s_live[k];
+    pthread_mutex_unlock(&s_lock);
+    return v;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps)
+{
+    pthread_mutex_lock(&s_lock);
+    const size_t v = s_low_free[pool_of(caps)];
+    pthread_mutex_unlock(&s_lock);
+    return v;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    return heap_caps_get_free_size(caps);
+}
+
+size_t heap_caps_get_allocated_size(void *p)
+{
+    pthread_mutex_lock(&s_lock);
+    const block_t *b = find_locked(p);
+    const size_t v = b ? b->size : 0;
+    pthread_mutex_unlock(&s_lock);
+    return v;
+}
+
+int heap_caps_register_failed_alloc_callback(esp_alloc_failed_hook_t cb)
+{
+    pthread_mutex_lock(&s_lock);
+    s_failed_cb = cb;
+    pthread_mutex_unlock(&s_lock);
+    return 0;
+}
+
+void esp_shim_heap_fail_next(uint32_t caps_mask, int n)
+{
+    pthread_mutex_lock(&s_lock);
+    s_fail_mask  = caps_mask;
+    s_fail_count = n;
+    pthread_mutex_unlock(&s_lock);
+}
+
+bool esp_ptr_external_ram(const void *p)
+{
+    pthread_mutex_lock(&s_lock);
+    const block_t *b = find_locked(p);
+    const bool v = b && b->psram;
+    pthread_mutex_unlock(&s_lock);
+    return v;
+}
+
+bool esp_ptr_internal(const void *p)
+{
+    return !esp_ptr_external_ram(p);
+}
+
+bool esp_ptr_dma_capable(const void *p)
+{
+    return !esp_ptr_external_ram(p);
+}
+
+bool esp_ptr_dma_ext_capable(const void *p)
+{
+    return esp_ptr_external_ram(p);
+}
@@ -0,0 +1,83 @@
+/* esp_partition over an in-memory table (see esp_partition.h). */
+#include "esp_partition.h"
+
+#include <string.h>
+
+#define MAX_PARTS 8
+
+typedef struct {
+    esp_partition_t part;
+    const uint8_t  *data;
+} host_part_t;
+
+static host_part_t s_parts[MAX_PARTS];
+static int         s_count;
+
+esp_err_t esp_shim_partition_add(const char *label, const void *data, size_t size)
+{
+    if (!label || !data || size > UINT32_MAX) return ESP_ERR_INVALID_ARG;
+    if (s_count == MAX_PARTS) return ESP_ERR_NO_MEM;
+    host_part_t *h = &s_parts[s_count];
+    memset(h, 0, sizeof(*h));
+    h->part.type       = ESP_PARTITION_TYPE_DATA;
+    h->part.subtype    = ESP_PARTITION_SUBTYPE_DATA_UNDEFINED;
+    h->part.address    = 0x400000u + (uint32_t)s_count * 0x100000u;
+    h->part.size       = (uint32_t)size;
+    h->part.erase_size = 4096;
+    h->part.readonly   = true;
+    strncpy(h->part.label, label, sizeof(h->part.label) - 1);
+    h->data = data;
+    s_count++;
+    return ESP_OK;
+}
+
+void esp_shim_partition_clear(void)
+{
+    s_count = 0;
+}
+
+static const host_part_t *lookup(const esp_partition_t *p)
+{
+    for (int i = 0; i < s_count; ++i) {
+        if (&s_parts[i].part == p) return &s_parts[i];
+    }
+    return NULL;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char *label)
+{
+    for (int i = 0; i < s_count && i < MAX_PARTS; ++i) {
+        const esp_partition_t *p = &s_parts[i].part;
+        if (type != ESP_PARTITION_TYPE_ANY && p->type != type) continue;
+        if (subtype != ESP_PARTITION_SUBTYPE_ANY && p->subtype != subtype) continue;
+        if (label && strncmp(label, p->label, sizeof(p->label)) != 0) continue;
+        return p;
+    }
+    return NULL;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *p, size_t offset, void *dst, size_t size)
+{
+    const host_part_t *h = lookup(p);
+    if (!h || !dst) return ESP_ERR_INVALID_ARG;
+    if (offset > h->part.size || size > h->part.size - offset) return ESP_ERR_INVALID_SIZE;
+    memcpy(dst, h->data + offset, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *p, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory, const void **out_ptr,
+                             esp_partition_mmap_handle_t *out_handle)
+{
+    const host_part_t *h = lookup(p);
+    if (!h || !out_ptr || !out_handle) return ESP_ERR_INVALID_ARG;
+    if (offset > h->part.size || size > h->part.size - offset) return ESP_ERR_INVALID_SIZE;
+    *out_ptr    = h->data + offset;
+    *out_handle = (esp_partition_mmap_handle_t)(h - s_parts) + 1;
+    return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle)
+{
+}
@@ -0,0 +1,554 @@
+/* Generated by mkjpeg_fixtures.py; do not edit. */
+#pragma once
+#include <stdint.h>
+
+#define FIXTURE_W 75
+#define FIXTURE_H 53
+
+static const uint8_t k_q444_jpg[1893] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x06,
+    0x06, 0x05, 0x06, 0x09, 0x08, 0x0a, 0x0a, 0x09, 0x08, 0x09, 0x09, 0x0a, 0x0c, 0x0f, 0x0c, 0x0a,
+    0x0b, 0x0e, 0x0b, 0x09, 0x09, 0x0d, 0x11, 0x0d, 0x0e, 0x0f, 0x10, 0x10, 0x11, 0x10, 0x0a, 0x0c,
+    0x12, 0x13, 0x12, 0x10, 0x13, 0x0f, 0x10, 0x10, 0x10, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03, 0x03,
+    0x03, 0x04, 0x03, 0x04, 0x08, 0x04, 0x04, 0x08, 0x10, 0x0b, 0x09, 0x0b, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xff, 0xc0,
+    0x00, 0x11, 0x08, 0x00, 0x35, 0x00, 0x4b, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+    0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+    0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+    0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+    0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+    0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+    0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xfc,
+    0xd1, 0xb4, 0xd0, 0xfa, 0x7c, 0x94, 0xa1, 0x50, 0xc7, 0x0b, 0x8e, 0x36, 0xec, 0xf4, 0x2e, 0x9f,
+    0x2d, 0x74, 0xc2, 0xa1, 0xf4, 0x38, 0x6c, 0x71, 0xb7, 0x69, 0xa1, 0xf4, 0xf9, 0x2b, 0xa6, 0x15,
+    0x0f, 0xa2, 0xc3, 0x63, 0x8d, 0xbb, 0x4d, 0x0c, 0xf1, 0xf2, 0x57, 0x4c, 0x2a, 0x1f, 0x43, 0x86,
+    0xc6, 0x9b, 0x76, 0x9a, 0x11, 0xe3, 0xe4, 0xae, 0x98, 0x54, 0x3e, 0x87, 0x0d, 0x8e, 0x36, 0xec,
+    0xf4, 0x3e, 0x9f, 0x25, 0x75, 0x42, 0xa1, 0xf4, 0x38, 0x6c, 0x69, 0xb7, 0x67, 0xa1, 0xf4, 0xf9,
+    0x2b, 0xa6, 0x15, 0x0f, 0xa1, 0xc3, 0x63, 0x4d, 0xab, 0x3d, 0x0f, 0xa7, 0xc9, 0x5d, 0x30, 0xa8,
+    0x7d, 0x16, 0x17, 0x1a, 0x6d, 0xd9, 0xe8, 0x47, 0x8f, 0x92, 0xba, 0x61, 0x50, 0xfa, 0x1c, 0x2e,
+    0x38, 0xd5, 0x4d, 0x08, 0xed, 0x1f, 0x25, 0x6d, 0xed, 0x0f, 0x6a, 0x38, 0xdd, 0x37, 0x3e, 0x55,
+    0xb4, 0xd0, 0xfa, 0x7c, 0x9f, 0xa5, 0x7e, 0x45, 0x0a, 0x87, 0xf9, 0x59, 0x85, 0xc6, 0x9b, 0x76,
+    0x9a, 0x1f, 0x4f, 0x92, 0xba, 0x63, 0x50, 0xfa, 0x1c, 0x36, 0x37, 0xcc, 0xdf, 0xd3, 0xfc, 0x3b,
+    0x2c, 0xc0, 0x98, 0xe2, 0x07, 0x6e, 0x33, 0xc8, 0x14, 0xea, 0xe3, 0xa8, 0xe1, 0x6d, 0xed, 0x65,
+    0x6b, 0xfa, 0xfe, 0x87, 0xde, 0xf0, 0xee, 0x53, 0x99, 0xf1, 0x07, 0x3b, 0xcb, 0xa9, 0xf3, 0xf2,
+    0x5b, 0x9b, 0xde, 0x8a, 0xb5, 0xef, 0x6f, 0x89, 0xab, 0xde, 0xcf, 0x63, 0x66, 0xdb, 0x40, 0x68,
+    0xf1, 0xbd, 0x00, 0xfc, 0x45, 0x11, 0xce, 0xb0, 0x4b, 0x79, 0xfe, 0x0f, 0xfc, 0x8f, 0xb6, 0xa1,
+    0xc1, 0xbc, 0x45, 0x0f, 0x8b, 0x0f, 0xff, 0x00, 0x93, 0xc3, 0xff, 0x00, 0x92, 0x35, 0x2d, 0xb4,
+    0xd8, 0x23, 0xc6, 0xf2, 0x07, 0xe1, 0x5b, 0xc7, 0x3e, 0xc0, 0xaf, 0xf9, 0x79, 0xf8, 0x4b, 0xfc,
+    0x8f, 0x66, 0x87, 0x0c, 0x67, 0x90, 0xf8, 0xa8, 0xff, 0x00, 0xe4, 0xd0, 0xff, 0x00, 0xe4, 0x8d,
+    0xbd, 0x37, 0x4d, 0x82, 0xe0, 0x91, 0x09, 0x0d, 0xb3, 0x19, 0xe0, 0xf1, 0x9a, 0xf4, 0xb0, 0x79,
+    0x96, 0x1f, 0x1b, 0x7f, 0x61, 0x2b, 0xdb, 0x7d, 0x1a, 0xdf, 0xd5, 0x23, 0xaa, 0xb6, 0x1b, 0x19,
+    0x95, 0xf2, 0xac, 0x5c, 0x79, 0x79, 0xaf, 0x6d, 0x53, 0xda, 0xd7, 0xd9, 0xbe, 0xe7, 0x41, 0x67,
+    0xa1, 0xf4, 0xf9, 0x2b, 0xd4, 0x85, 0x43, 0xd0, 0xc2, 0xe3, 0x7c, 0xcd, 0xbb, 0x3d, 0x0c, 0xf1,
+    0xf2, 0x7e, 0x95, 0xd3, 0x1a, 0x87, 0xd0, 0xe1, 0x71, 0xbe, 0x66, 0xd5, 0x9e, 0x87, 0xd3, 0xe4,
+    0xae, 0x98, 0x4c, 0xfa, 0x2c, 0x36, 0x37, 0xcc, 0xd6, 0x5d, 0x0c, 0xed, 0x1f, 0x27, 0xe9, 0x5d,
+    0x0a, 0x67, 0xb3, 0x1c, 0x6e, 0x9b, 0x9f, 0x2a, 0xda, 0x68, 0x7d, 0x3e, 0x4a, 0xfc, 0x86, 0x33,
+    0x3f, 0xca, 0xcc, 0x2e, 0x37, 0xcc, 0xdb, 0xb4, 0xd0, 0xfa, 0x7c, 0x9f, 0xa5, 0x74, 0xc2, 0xa1,
+    0xf4, 0x58, 0x6c, 0x6f, 0x99, 0xa8, 0x2c, 0x7e, 0xc4, 0x8b, 0xf2, 0xe3, 0x7f, 0xf4, 0xff, 0x00,
+    0xf5, 0xd7, 0x99, 0x9b, 0xcb, 0x9b, 0x93, 0xe7, 0xfa, 0x1f, 0xd3, 0xde, 0x02, 0xd7, 0xf6, 0xd1,
+    0xc7, 0xf9, 0x7b, 0x2f, 0xfd, 0xc8, 0x25, 0x78, 0xa7, 0xf4, 0x28, 0x50, 0x07, 0x61, 0xf0, 0xf6,
+    0xc7, 0xed, 0xaf, 0x7d, 0xf2, 0xe7, 0x67, 0x95, 0xfa, 0xee, 0xff, 0x00, 0x0a, 0xfa, 0xae, 0x18,
+    0x97, 0x2f, 0xb5, 0xff, 0x00, 0xb7, 0x7f, 0x53, 0xf3, 0x4f, 0x10, 0xeb, 0xfb, 0x19, 0x61, 0x7c,
+    0xf9, 0xff, 0x00, 0xf6, 0xc3, 0xd0, 0xec, 0xf4, 0x3e, 0x9f, 0x27, 0xe9, 0x5f, 0x63, 0x1a, 0x87,
+    0xc6, 0xe1, 0x71, 0xbe, 0x66, 0xdd, 0x9e, 0x87, 0xd3, 0xe4, 0xae, 0x98, 0x4c, 0xfa, 0x1c, 0x2e,
+    0x37, 0xcc, 0xdb, 0xb3, 0xd0, 0xfa, 0x7c, 0x95, 0xd5, 0x09, 0x9f, 0x43, 0x85, 0xc6, 0xf9, 0x9a,
+    0xab, 0xa1, 0xfc, 0xa3, 0xe4, 0xad, 0xd4, 0xcf, 0x6a, 0x38, 0xdd, 0x0f, 0x95, 0x6c, 0xf4, 0x2e,
+    0x9f, 0x27, 0xe9, 0x5f, 0x90, 0xc2, 0xa1, 0xfe, 0x56, 0x61, 0xb1, 0xde, 0x66, 0xdd, 0x9e, 0x85,
+    0xd3, 0xe4, 0xae, 0x98, 0x54, 0x3e, 0x87, 0x0d, 0x8e, 0xf3, 0x0d, 0x6b, 0xc2, 0xfa, 0x95, 0xda,
+    0xdb, 0x8d, 0x3a, 0xd0, 0xcb, 0xb7, 0x7e, 0xff, 0x00, 0x99, 0x57, 0x1d, 0x31, 0xd4, 0x8f, 0x7a,
+    0xe7, 0xc6, 0xd3, 0x9d, 0x7e, 0x5e, 0x45, 0x7b, 0x5f, 0xf4, 0x3f, 0xa3, 0xfc, 0x13, 0xe3, 0xac,
+    0x93, 0x86, 0x16, 0x35, 0x67, 0x35, 0xfd, 0x9f, 0xb4, 0xf6, 0x5c, 0xbe, 0xec, 0xe5, 0x7e, 0x5f,
+    0x69, 0x7f, 0x82, 0x32, 0xb5, 0xb9, 0x96, 0xf6, 0xdf, 0x4e, 0xa5, 0x04, 0xf0, 0x17, 0x8b, 0x24,
+    0xfb, 0x9a, 0x49, 0x3f, 0xf6, 0xda, 0x3f, 0xfe, 0x2a, 0xb8, 0x96, 0x03, 0x10, 0xfe, 0xcf, 0xe2,
+    0xbf, 0xcc, 0xfd, 0xee, 0x3e, 0x2e, 0xf0, 0x64, 0xfe, 0x1c, 0x67, 0xfe, 0x53, 0xab, 0xff, 0x00,
+    0xc8, 0x13, 0xa7, 0xc3, 0x5f, 0x1b, 0x49, 0xf7, 0x34, 0x42, 0x7f, 0xed, 0xe2, 0x2f, 0xfe, 0x2a,
+    0xad, 0x65, 0xd8, 0x97, 0xf6, 0x7f, 0x15, 0xfe, 0x67, 0x4c, 0x7c, 0x53, 0xe1, 0x29, 0xfc, 0x38,
+    0xbf, 0xfc, 0x92, 0xa7, 0xff, 0x00, 0x20, 0x77, 0xff, 0x00, 0x0b, 0x7c, 0x0f, 0xaf, 0x68, 0xed,
+    0xa8, 0x9d, 0x6f, 0x4e, 0x36, 0xe2, 0x6f, 0x27, 0xca, 0xfd, 0xe2, 0x3e, 0xec, 0x6f, 0xcf, 0xdd,
+    0x27, 0x1d, 0x47, 0x5a, 0xf7, 0x72, 0x5c, 0x3d, 0x5c, 0x27, 0x3f, 0xb5, 0x56, 0xbd, 0xbb, 0x79,
+    0xf6, 0x3f, 0x3f, 0xe3, 0xee, 0x2c, 0xca, 0xf3, 0xc7, 0x86, 0x79, 0x65, 0x5e, 0x7e, 0x5e, 0x7e,
+    0x6f, 0x76, 0x4a, 0xd7, 0xe4, 0xb7, 0xc4, 0x96, 0xf6, 0x7b, 0x1e, 0xa1, 0x69, 0xa1, 0x74, 0xf9,
+    0x2b, 0xe8, 0xe1, 0x50, 0xf9, 0x2c, 0x2e, 0x3b, 0xcc, 0xdb, 0xb3, 0xd0, 0xba, 0x7c, 0x95, 0xd5,
+    0x0a, 0x87, 0xd0, 0xe1, 0x71, 0xde, 0x66, 0xdd, 0x9e, 0x85, 0xd3, 0xe4, 0xfd, 0x2b, 0xa6, 0x15,
+    0x0f, 0xa2, 0xc2, 0xe3, 0xbc, 0xcd, 0x44, 0xd0, 0xbe, 0x51, 0xfb, 0xbf, 0xd2, 0xb7, 0x55, 0x0f,
+    0x6a, 0x38, 0xdd, 0x0f, 0x95, 0x6c, 0xf4, 0x2e, 0x9f, 0x25, 0x7e, 0x43, 0x0a, 0x87, 0xf9, 0x59,
+    0x86, 0xc7, 0x79, 0x9b, 0x76, 0x7a, 0x17, 0x4f, 0x92, 0xba, 0xa1, 0x50, 0xfa, 0x1c, 0x36, 0x3b,
+    0xcc, 0xdb, 0xb4, 0xd0, 0xba, 0x7c, 0x95, 0xd3, 0x0a, 0x87, 0xd0, 0xe1, 0xb1, 0xde, 0x66, 0xdd,
+    0xa6, 0x85, 0xd3, 0xe4, 0xfd, 0x2b, 0xa6, 0x15, 0x0f, 0xa1, 0xc3, 0x63, 0x8d, 0xbb, 0x3d, 0x0b,
+    0xa7, 0xc9, 0x5d, 0x30, 0xa8, 0x7d, 0x16, 0x1b, 0x1d, 0xe6, 0x6d, 0xd9, 0xe8, 0x5d, 0x3e, 0x4a,
+    0xe9, 0x85, 0x43, 0xe8, 0x70, 0xd8, 0xef, 0x33, 0x6e, 0xcf, 0x42, 0xe9, 0xf2, 0x7e, 0x95, 0xd3,
+    0x0a, 0x87, 0xd0, 0xe1, 0x71, 0xde, 0x66, 0xdd, 0x9e, 0x85, 0xd3, 0xe4, 0xae, 0xa8, 0xd4, 0x3e,
+    0x87, 0x0b, 0x8e, 0xf3, 0x36, 0xec, 0xf4, 0x2e, 0x9f, 0x25, 0x74, 0xc6, 0xa1, 0xf4, 0x38, 0x5c,
+    0x77, 0x99, 0xa8, 0x9a, 0x10, 0xda, 0x32, 0x95, 0xb2, 0xa8, 0x7b, 0x71, 0xc7, 0x69, 0xb9, 0xf2,
+    0xb5, 0x9e, 0x86, 0x78, 0xf9, 0x3f, 0x4a, 0xfc, 0x8a, 0x15, 0x0f, 0xf2, 0xaf, 0x0b, 0x8d, 0x36,
+    0xed, 0x34, 0x3e, 0x9f, 0x25, 0x74, 0xc2, 0xa1, 0xf4, 0x58, 0x6c, 0x69, 0xb7, 0x69, 0xa1, 0x9e,
+    0x3e, 0x4f, 0xd2, 0xba, 0x61, 0x50, 0xfa, 0x1c, 0x36, 0x34, 0xda, 0xb4, 0xd0, 0xfa, 0x7c, 0x9f,
+    0xa5, 0x74, 0xc2, 0xa1, 0xf4, 0x38, 0x6c, 0x69, 0xb7, 0x69, 0xa1, 0x9e, 0x3e, 0x4f, 0xd2, 0xba,
+    0x61, 0x50, 0xfa, 0x1c, 0x36, 0x34, 0xdb, 0xb4, 0xd0, 0xcf, 0x1f, 0x27, 0xe9, 0x5d, 0x50, 0x99,
+    0xf4, 0x38, 0x5c, 0x6f, 0x99, 0xb7, 0x67, 0xa1, 0xf4, 0xf9, 0x3f, 0x4a, 0xe9, 0x85, 0x43, 0xe8,
+    0xb0, 0xb8, 0xd3, 0x6e, 0xcf, 0x43, 0x3c, 0x7c, 0x9f, 0xa5, 0x74, 0xc6, 0xa1, 0xf4, 0x38, 0x5c,
+    0x6f, 0x99, 0xb7, 0x67, 0xa1, 0xf4, 0xf9, 0x3f, 0x4a, 0xe9, 0x8d, 0x43, 0xe8, 0x70, 0xd8, 0xdf,
+    0x33, 0x55, 0x34, 0x33, 0xb4, 0x7c, 0xbf, 0xa5, 0x6f, 0xed, 0x0f, 0x6a, 0x38, 0xdd, 0x37, 0x3e,
+    0x50, 0xb4, 0xd3, 0xa0, 0x18, 0xe3, 0xf4, 0xaf, 0xc8, 0xe1, 0x26, 0x7f, 0x96, 0x18, 0x5c, 0x44,
+    0x8d, 0xab, 0x4d, 0x3a, 0x0e, 0x3f, 0xc2, 0xba, 0x61, 0x26, 0x7d, 0x0e, 0x1b, 0x11, 0x33, 0x6e,
+    0xd3, 0x4e, 0x83, 0x8e, 0x3f, 0x4a, 0xe9, 0x84, 0x99, 0xf4, 0x58, 0x6c, 0x44, 0x8d, 0xbb, 0x4d,
+    0x3a, 0x0e, 0x3f, 0xc2, 0xba, 0x61, 0x26, 0x7d, 0x0e, 0x1b, 0x11, 0x33, 0x6e, 0xd3, 0x4e, 0x83,
+    0x8e, 0x3f, 0x4a, 0xea, 0x84, 0x99, 0xf4, 0x38, 0x6c, 0x44, 0xcd, 0xbb, 0x4d, 0x3a, 0x0e, 0x38,
+    0xfd, 0x2b, 0xa6, 0x12, 0x67, 0xd0, 0xe1, 0xb1, 0x13, 0x36, 0xec, 0xf4, 0xe8, 0x38, 0xff, 0x00,
+    0x0a, 0xe9, 0x8c, 0x99, 0xf4, 0x58, 0x5c, 0x44, 0xcd, 0xbb, 0x3d, 0x3a, 0x0e, 0x38, 0xfd, 0x2b,
+    0xa6, 0x12, 0x67, 0xd0, 0xe1, 0x71, 0x13, 0x36, 0xec, 0xf4, 0xe8, 0x38, 0xe3, 0xf4, 0xae, 0x98,
+    0x49, 0x9f, 0x43, 0x85, 0xc4, 0x4c, 0xd5, 0x4d, 0x3a, 0x0d, 0xa3, 0x8a, 0xdd, 0x49, 0x9e, 0xd4,
+    0x71, 0x13, 0xb1, 0xff, 0xd9,
+};
+
+static const uint8_t k_q422_jpg[1558] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03,
+    0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07,
+    0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d,
+    0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f,
+    0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03, 0x04,
+    0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0,
+    0x00, 0x11, 0x08, 0x00, 0x35, 0x00, 0x4b, 0x03, 0x01, 0x21, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+    0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+    0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+    0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+    0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+    0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+    0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xfc,
+    0xd1, 0xb4, 0xd0, 0xfa, 0x7c, 0xb5, 0xb7, 0x67, 0xa1, 0x74, 0xf9, 0x6a, 0xe9, 0xcc, 0xeb, 0xc0,
+    0xe2, 0xb6, 0x36, 0xed, 0x34, 0x3e, 0x9f, 0x2d, 0x6d, 0xda, 0x68, 0x7d, 0x3e, 0x5a, 0xf4, 0xa9,
+    0xcc, 0xfd, 0x0b, 0x03, 0x8a, 0xd8, 0xdb, 0xb4, 0xd0, 0xba, 0x7c, 0xb5, 0xb7, 0x67, 0xa1, 0xf4,
+    0xf9, 0x6b, 0xd3, 0xa7, 0x33, 0xf4, 0x2c, 0x0e, 0x2b, 0x63, 0x6e, 0xcf, 0x43, 0xe9, 0xf2, 0xd6,
+    0xd5, 0x9e, 0x87, 0xd3, 0xe5, 0xaf, 0x4a, 0x9c, 0xcf, 0xd0, 0xf0, 0x38, 0xad, 0x8d, 0xbb, 0x3d,
+    0x0b, 0xa7, 0xcb, 0x5a, 0xa9, 0xa1, 0x7c, 0xa3, 0xe5, 0xaf, 0x46, 0x13, 0xd0, 0xfb, 0xfc, 0x26,
+    0x2b, 0xdd, 0x3e, 0x55, 0xb4, 0xd0, 0xfa, 0x7c, 0xb5, 0xb7, 0x69, 0xa1, 0xf4, 0xf9, 0x6b, 0xf2,
+    0xaa, 0x73, 0x3f, 0xcc, 0x9c, 0x0e, 0x2b, 0x63, 0x7f, 0x4f, 0xf0, 0xeb, 0xcc, 0x09, 0x44, 0x07,
+    0x1d, 0x79, 0x02, 0xb6, 0x6d, 0xb4, 0x06, 0x8f, 0x1b, 0x94, 0x0f, 0xc4, 0x56, 0xaf, 0x1f, 0x42,
+    0x8c, 0xb9, 0x27, 0x2b, 0x35, 0xe4, 0xff, 0x00, 0xc8, 0xfd, 0xa7, 0x26, 0xc9, 0x33, 0x5c, 0x76,
+    0x1e, 0x18, 0xbc, 0x3d, 0x2e, 0x68, 0x4b, 0x67, 0xcd, 0x15, 0xb3, 0xb3, 0xd1, 0xb4, 0xf7, 0x4f,
+    0xa1, 0xa9, 0x6d, 0xa6, 0xc5, 0x1e, 0x37, 0x10, 0x3f, 0x0a, 0xdb, 0xd3, 0x74, 0xd8, 0xae, 0x09,
+    0x11, 0x90, 0xdb, 0x71, 0x9e, 0x3a, 0x57, 0xa1, 0x86, 0xcc, 0xb0, 0xd5, 0xa6, 0xa9, 0xc2, 0x57,
+    0x6f, 0xc9, 0xff, 0x00, 0x91, 0xf7, 0x30, 0xcb, 0x73, 0x0c, 0x0d, 0x37, 0x57, 0x11, 0x4f, 0x96,
+    0x2b, 0xad, 0xe2, 0xfc, 0xba, 0x36, 0x74, 0x16, 0x7a, 0x1f, 0x4f, 0x96, 0xb6, 0xec, 0xf4, 0x3e,
+    0x9f, 0x2f, 0xe9, 0x5f, 0x45, 0x4e, 0x67, 0xd3, 0x60, 0x71, 0x5b, 0x1b, 0x56, 0x7a, 0x1f, 0x4f,
+    0x96, 0xb5, 0x97, 0x43, 0xf9, 0x47, 0xcb, 0xfa, 0x57, 0xa3, 0x09, 0xe8, 0x7d, 0xf6, 0x13, 0x15,
+    0xee, 0xee, 0x7c, 0xab, 0x69, 0xa1, 0xf4, 0xf9, 0x6b, 0x6e, 0xd3, 0x43, 0xe9, 0xf2, 0xfe, 0x95,
+    0xf9, 0x55, 0x39, 0x9f, 0xe6, 0x56, 0x07, 0x15, 0xb6, 0xa6, 0xa0, 0xb1, 0xfb, 0x12, 0x2f, 0x18,
+    0xdd, 0xfd, 0x29, 0x2b, 0xc3, 0xc6, 0x3b, 0xd7, 0x93, 0xf4, 0xfc, 0x91, 0xfd, 0xe3, 0xe1, 0xfc,
+    0xb9, 0xf8, 0x6b, 0x0b, 0x2f, 0xf1, 0xff, 0x00, 0xe9, 0xc9, 0x05, 0x76, 0x1f, 0x0f, 0x6c, 0x7e,
+    0xda, 0xf7, 0xdc, 0x67, 0x6f, 0x97, 0xff, 0x00, 0xb3, 0x57, 0x46, 0x56, 0xed, 0x8c, 0x87, 0xcf,
+    0xf2, 0x67, 0xbd, 0xc4, 0x93, 0xe4, 0xca, 0xaa, 0xcb, 0xfc, 0x3f, 0xfa, 0x54, 0x4f, 0x43, 0xb3,
+    0xd0, 0xfa, 0x7c, 0xb5, 0xb7, 0x67, 0xa1, 0xf4, 0xf9, 0x6b, 0xf4, 0xba, 0x73, 0x3f, 0x38, 0xc0,
+    0xe2, 0xb6, 0xd4, 0xdb, 0xb3, 0xd0, 0xfa, 0x7c, 0xb5, 0xaa, 0xba, 0x1f, 0xca, 0x3e, 0x5a, 0xf4,
+    0x61, 0x3d, 0x0f, 0xbe, 0xc2, 0x62, 0xbd, 0xd3, 0xe5, 0x5b, 0x3d, 0x0b, 0xa7, 0xcb, 0x5b, 0x76,
+    0x7a, 0x17, 0x4f, 0x96, 0xbf, 0x29, 0xa7, 0x33, 0xfc, 0xc9, 0xc0, 0xe2, 0xb6, 0x0d, 0x6b, 0xc2,
+    0xf7, 0x97, 0x6b, 0x6e, 0x2c, 0xe0, 0xf3, 0x71, 0xbb, 0x77, 0xcc, 0x17, 0x1d, 0x31, 0xd4, 0xfd,
+    0x6a, 0x82, 0x78, 0x0b, 0x5d, 0x93, 0xee, 0xd8, 0x13, 0xff, 0x00, 0x6d, 0x53, 0xff, 0x00, 0x8a,
+    0xae, 0x6a, 0xd4, 0x2a, 0x55, 0xa8, 0xe5, 0x14, 0x7f, 0x6e, 0xf0, 0x27, 0x1c, 0xe4, 0x19, 0x6f,
+    0x0f, 0xe1, 0xb0, 0x58, 0xcc, 0x4f, 0x2d, 0x58, 0xf3, 0x5d, 0x72, 0xcd, 0xda, 0xf3, 0x93, 0x5a,
+    0xa8, 0xb5, 0xb3, 0x4f, 0x46, 0x4e, 0x9f, 0x0d, 0x7c, 0x49, 0x27, 0xdd, 0xd3, 0x49, 0xff, 0x00,
+    0xb6, 0xd1, 0xff, 0x00, 0xf1, 0x55, 0xdf, 0xfc, 0x2d, 0xf0, 0x3e, 0xa9, 0xa3, 0xb6, 0xa2, 0x75,
+    0x2b, 0x4f, 0xb3, 0x89, 0x7c, 0xbf, 0x2f, 0xe7, 0x56, 0xdd, 0x8d, 0xd9, 0xfb, 0xa4, 0xe3, 0xa8,
+    0xae, 0xac, 0x0e, 0x16, 0xb5, 0x2c, 0x44, 0x6a, 0x4a, 0x3a, 0x2b, 0xf5, 0x5d, 0x8f, 0xa7, 0xcf,
+    0xf8, 0xc3, 0x25, 0xcc, 0xb2, 0xba, 0xb8, 0x7c, 0x1d, 0x7e, 0x69, 0xcb, 0x96, 0xcb, 0x96, 0x6b,
+    0x69, 0x26, 0xf5, 0x71, 0x4b, 0x64, 0x7a, 0x85, 0xa6, 0x85, 0xd3, 0xe5, 0xad, 0xbb, 0x3d, 0x0b,
+    0xa7, 0xcb, 0x5f, 0x6f, 0x4e, 0x67, 0xc1, 0xe0, 0x71, 0x5b, 0x1b, 0x76, 0x7a, 0x17, 0x4f, 0x96,
+    0xb5, 0x13, 0x42, 0xf9, 0x47, 0xcb, 0xfa, 0x57, 0xa3, 0x09, 0xe8, 0x7d, 0xfe, 0x13, 0x15, 0xee,
+    0x9f, 0x2a, 0xd9, 0xe8, 0x5d, 0x3e, 0x5a, 0xdb, 0xb3, 0xd0, 0xba, 0x7c, 0xb5, 0xf9, 0x55, 0x39,
+    0x9f, 0xe6, 0x4e, 0x07, 0x15, 0xb1, 0xb7, 0x69, 0xa1, 0x74, 0xf9, 0x6b, 0x6e, 0xd3, 0x42, 0xe9,
+    0xf2, 0xd7, 0xa5, 0x4e, 0x67, 0xe8, 0x78, 0x1c, 0x56, 0xc6, 0xdd, 0x9e, 0x85, 0xd3, 0xe5, 0xad,
+    0xbb, 0x3d, 0x0b, 0xa7, 0xcb, 0x5e, 0x95, 0x39, 0x9f, 0xa1, 0x60, 0x71, 0x5b, 0x6a, 0x6d, 0xd9,
+    0xe8, 0x5d, 0x3e, 0x5a, 0xdb, 0xb3, 0xd0, 0xba, 0x7c, 0xb5, 0xe9, 0xd3, 0x99, 0xfa, 0x1e, 0x07,
+    0x15, 0xb1, 0xb7, 0x67, 0xa1, 0x74, 0xf9, 0x6b, 0x51, 0x34, 0x2f, 0x94, 0x7c, 0xb5, 0xe8, 0xc2,
+    0x7a, 0x1f, 0x7f, 0x84, 0xc5, 0x7b, 0xbb, 0x9f, 0x2b, 0x59, 0xe8, 0x7d, 0x3e, 0x5f, 0xd2, 0xb6,
+    0xed, 0x34, 0x3e, 0x9f, 0x2d, 0x7e, 0x55, 0x4e, 0x67, 0xf9, 0x93, 0x81, 0xc5, 0x6c, 0x6d, 0xda,
+    0x68, 0x7d, 0x3e, 0x5a, 0xda, 0xb4, 0xd0, 0xfa, 0x7c, 0xb5, 0xe9, 0x53, 0x99, 0xfa, 0x1e, 0x07,
+    0x15, 0xb1, 0xb7, 0x69, 0xa1, 0xf4, 0xf9, 0x6b, 0x6e, 0xd3, 0x43, 0xe9, 0xf2, 0xfe, 0x95, 0xe9,
+    0x53, 0x99, 0xfa, 0x16, 0x07, 0x15, 0xb1, 0xb7, 0x67, 0xa1, 0xf4, 0xf9, 0x6b, 0x6e, 0xcf, 0x43,
+    0xe9, 0xf2, 0xd7, 0xa7, 0x4e, 0x67, 0xe8, 0x58, 0x1c, 0x56, 0xc6, 0xdd, 0x9e, 0x87, 0xd3, 0xe5,
+    0xad, 0x54, 0xd0, 0xce, 0xd1, 0xc7, 0xe9, 0x5e, 0x8c, 0x27, 0xa1, 0xf7, 0xf8, 0x4c, 0x57, 0xba,
+    0x7c, 0xa1, 0x69, 0xa7, 0x44, 0x31, 0x5b, 0x56, 0x9a, 0x74, 0x5c, 0x57, 0xe5, 0x54, 0xe4, 0xcf,
+    0xf3, 0x3b, 0x03, 0x5a, 0x5a, 0x1b, 0x76, 0x9a, 0x74, 0x5c, 0x56, 0xdd, 0xa6, 0x9d, 0x17, 0x15,
+    0xe9, 0x53, 0x93, 0x3f, 0x42, 0xc0, 0xd6, 0x96, 0x86, 0xdd, 0xa6, 0x9d, 0x17, 0x15, 0xb7, 0x69,
+    0xa7, 0x45, 0xc5, 0x7a, 0x74, 0xe4, 0xcf, 0xd0, 0xf0, 0x35, 0xa5, 0xa1, 0xb7, 0x67, 0xa7, 0x45,
+    0xc5, 0x6d, 0xd9, 0xe9, 0xd1, 0x71, 0x5e, 0x95, 0x39, 0x33, 0xf4, 0x2c, 0x0d, 0x69, 0x68, 0x6d,
+    0xd9, 0xe9, 0xd1, 0x71, 0x5a, 0xa9, 0xa7, 0x45, 0xb4, 0x71, 0x5e, 0x8c, 0x24, 0xec, 0x7d, 0xfe,
+    0x12, 0xb4, 0xb9, 0x4f, 0xff, 0xd9,
+};
+
+static const uint8_t k_q420_jpg[1418] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03,
+    0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07,
+    0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d,
+    0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f,
+    0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03, 0x04,
+    0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0,
+    0x00, 0x11, 0x08, 0x00, 0x35, 0x00, 0x4b, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+    0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+    0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+    0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+    0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+    0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+    0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xfc,
+    0xd1, 0xb4, 0xd0, 0xfa, 0x7c, 0xb5, 0xb7, 0x67, 0xa1, 0x74, 0xf9, 0x6b, 0xa7, 0xb4, 0xd0, 0xfa,
+    0x7c, 0xb5, 0xb7, 0x69, 0xa1, 0xf4, 0xf9, 0x6a, 0x29, 0xd6, 0x38, 0xb0, 0x39, 0xa6, 0xda, 0x9c,
+    0xc5, 0xa6, 0x87, 0xd3, 0xe5, 0xad, 0xbb, 0x4d, 0x0f, 0xa7, 0xcb, 0x5d, 0x5e, 0x9f, 0xe1, 0xd7,
+    0x98, 0x12, 0x88, 0x0e, 0x3a, 0xf2, 0x05, 0x6c, 0xdb, 0x68, 0x0d, 0x1e, 0x37, 0x28, 0x1f, 0x88,
+    0xae, 0xb8, 0xe3, 0x29, 0x41, 0xda, 0x53, 0x49, 0xf9, 0xb4, 0x7e, 0xad, 0x95, 0xfd, 0x7e, 0xbd,
+    0x38, 0xd6, 0xa3, 0x42, 0x72, 0x8b, 0xd9, 0xa8, 0xc9, 0xa7, 0xd3, 0x46, 0x95, 0xb7, 0x39, 0x6b,
+    0x4d, 0x0b, 0xa7, 0xcb, 0x5b, 0x76, 0x7a, 0x1f, 0x4f, 0x96, 0xba, 0x2b, 0x6d, 0x36, 0x28, 0xf1,
+    0xb8, 0x81, 0xf8, 0x56, 0xde, 0x9b, 0xa6, 0xc5, 0x70, 0x48, 0x8c, 0x86, 0xdb, 0x8c, 0xf1, 0xd2,
+    0xbd, 0x1a, 0x38, 0xea, 0x33, 0x92, 0x8c, 0x66, 0x9b, 0xf5, 0x47, 0xde, 0xe1, 0xaa, 0xe2, 0xe8,
+    0x47, 0x9e, 0xb5, 0x29, 0x45, 0x2e, 0xae, 0x2d, 0x2f, 0xc5, 0x1c, 0xed, 0x9e, 0x87, 0xd3, 0xe5,
+    0xad, 0xab, 0x3d, 0x0f, 0xa7, 0xcb, 0x5d, 0x45, 0x9e, 0x87, 0xd3, 0xe5, 0xad, 0xbb, 0x3d, 0x0f,
+    0xa7, 0xcb, 0xfa, 0x57, 0xb7, 0x4e, 0xb1, 0xf6, 0x98, 0x1c, 0xd3, 0x6d, 0x4e, 0x5e, 0xcf, 0x42,
+    0xe9, 0xf2, 0xd6, 0xaa, 0x68, 0x5f, 0x28, 0xf9, 0x6b, 0xad, 0xb3, 0xd0, 0xfa, 0x7c, 0xb5, 0xac,
+    0xba, 0x1f, 0xca, 0x3e, 0x5f, 0xd2, 0xbd, 0x18, 0x55, 0xd0, 0xfb, 0xfc, 0x26, 0x69, 0xee, 0xee,
+    0x7c, 0xab, 0x69, 0xa1, 0xf4, 0xf9, 0x6b, 0x6e, 0xd3, 0x43, 0xe9, 0xf2, 0xfe, 0x95, 0xd3, 0xd9,
+    0xe8, 0x5d, 0x3e, 0x5a, 0xdb, 0xb3, 0xd0, 0xba, 0x7c, 0xb5, 0xf8, 0xe5, 0x3a, 0xc7, 0xf9, 0x35,
+    0x81, 0xcd, 0x36, 0xd4, 0xe4, 0x45, 0x8f, 0xd8, 0x91, 0x78, 0xc6, 0xef, 0xe9, 0x49, 0x5d, 0x7e,
+    0xb5, 0xe1, 0x7b, 0xcb, 0xb5, 0xb7, 0x16, 0x70, 0x79, 0xb8, 0xdd, 0xbb, 0xe6, 0x0b, 0x8e, 0x98,
+    0xea, 0x7e, 0xb5, 0x41, 0x3c, 0x05, 0xae, 0xc9, 0xf7, 0x6c, 0x09, 0xff, 0x00, 0xb6, 0xa9, 0xff,
+    0x00, 0xc5, 0x57, 0x99, 0x89, 0x84, 0xea, 0x56, 0x72, 0x8a, 0x6f, 0x6f, 0xc8, 0xfe, 0xe7, 0xe0,
+    0x1e, 0x22, 0xca, 0x69, 0x70, 0xe6, 0x16, 0x9e, 0x27, 0x17, 0x4e, 0x13, 0x5c, 0xf7, 0x8c, 0xa7,
+    0x14, 0xd7, 0xbf, 0x2b, 0x5d, 0x37, 0x75, 0x75, 0x67, 0xe8, 0x73, 0xf5, 0xd8, 0x7c, 0x3d, 0xb1,
+    0xfb, 0x6b, 0xdf, 0x71, 0x9d, 0xbe, 0x5f, 0xfe, 0xcd, 0x55, 0x93, 0xe1, 0xaf, 0x89, 0x24, 0xfb,
+    0xba, 0x69, 0x3f, 0xf6, 0xda, 0x3f, 0xfe, 0x2a, 0xbb, 0xff, 0x00, 0x85, 0xbe, 0x07, 0xd5, 0x34,
+    0x76, 0xd4, 0x4e, 0xa5, 0x69, 0xf6, 0x71, 0x2f, 0x97, 0xe5, 0xfc, 0xea, 0xdb, 0xb1, 0xbb, 0x3f,
+    0x74, 0x9c, 0x75, 0x15, 0xd5, 0x97, 0x53, 0xa9, 0x4f, 0x15, 0x09, 0xca, 0x2d, 0x2d, 0x7a, 0x79,
+    0x33, 0xe8, 0xb8, 0x87, 0x3d, 0xcb, 0x6a, 0xe5, 0x75, 0x56, 0x1b, 0x13, 0x09, 0xcb, 0xdd, 0xb2,
+    0x8c, 0xe2, 0xdb, 0xf7, 0x97, 0x44, 0xef, 0xb1, 0x76, 0xcf, 0x43, 0xe9, 0xf2, 0xd6, 0xdd, 0x9e,
+    0x87, 0xd3, 0xe5, 0xae, 0xa2, 0xd3, 0x42, 0xe9, 0xf2, 0xd6, 0xdd, 0x9e, 0x85, 0xd3, 0xe5, 0xaf,
+    0xd0, 0x29, 0xd5, 0x3f, 0x3e, 0xc0, 0xe6, 0x9b, 0x6a, 0x72, 0xf6, 0x7a, 0x1f, 0x4f, 0x96, 0xb5,
+    0x57, 0x43, 0xf9, 0x47, 0xcb, 0x5d, 0x75, 0x9e, 0x85, 0xd3, 0xe5, 0xad, 0x44, 0xd0, 0xbe, 0x51,
+    0xf2, 0xfe, 0x95, 0xe9, 0x42, 0xb6, 0x87, 0xdf, 0x61, 0x33, 0x4f, 0x77, 0x73, 0xe5, 0x5b, 0x3d,
+    0x0b, 0xa7, 0xcb, 0x5b, 0x76, 0x7a, 0x17, 0x4f, 0x96, 0xba, 0x8b, 0x3d, 0x0f, 0xa7, 0xcb, 0xfa,
+    0x56, 0xdd, 0xa6, 0x87, 0xd3, 0xe5, 0xaf, 0xc7, 0x29, 0xd6, 0x3f, 0xc9, 0xbc, 0x0e, 0x69, 0xb6,
+    0xa7, 0x2f, 0x69, 0xa1, 0x74, 0xf9, 0x6b, 0x6e, 0xd3, 0x42, 0xe9, 0xf2, 0xd7, 0x51, 0x69, 0xa1,
+    0xf4, 0xf9, 0x6b, 0x6a, 0xd3, 0x43, 0xe9, 0xf2, 0xd7, 0xa5, 0x4e, 0xb1, 0xfa, 0x16, 0x07, 0x34,
+    0xdb, 0x53, 0x98, 0xb3, 0xd0, 0xba, 0x7c, 0xb5, 0xb7, 0x67, 0xa1, 0x74, 0xf9, 0x6b, 0xa7, 0xb4,
+    0xd0, 0xfa, 0x7c, 0xb5, 0xb7, 0x69, 0xa1, 0xf4, 0xf9, 0x7f, 0x4a, 0xf4, 0xe9, 0xd5, 0x3f, 0x43,
+    0xc0, 0xe6, 0x9b, 0x6a, 0x73, 0x16, 0x7a, 0x17, 0x4f, 0x96, 0xb6, 0xec, 0xf4, 0x2e, 0x9f, 0x2d,
+    0x74, 0xf6, 0x7a, 0x1f, 0x4f, 0x96, 0xb6, 0xec, 0xf4, 0x3e, 0x9f, 0x2d, 0x7a, 0x54, 0xeb, 0x1f,
+    0xa1, 0x60, 0x73, 0x4d, 0xb5, 0x39, 0x8b, 0x3d, 0x0b, 0xa7, 0xcb, 0x5a, 0x89, 0xa1, 0x7c, 0xa3,
+    0xe5, 0xae, 0xba, 0xcf, 0x43, 0xe9, 0xf2, 0xd6, 0xaa, 0x68, 0x67, 0x68, 0xe3, 0xf4, 0xaf, 0x46,
+    0x15, 0xb4, 0x3e, 0xff, 0x00, 0x09, 0x9a, 0x7b, 0xbb, 0x9f, 0x28, 0x5a, 0x69, 0xd1, 0x0c, 0x56,
+    0xd5, 0xa6, 0x9d, 0x17, 0x14, 0x51, 0x5f, 0x91, 0xd3, 0x6c, 0xff, 0x00, 0x2c, 0xb0, 0x35, 0x25,
+    0xa6, 0xa6, 0xdd, 0xa6, 0x9d, 0x17, 0x15, 0xb7, 0x69, 0xa7, 0x45, 0xc5, 0x14, 0x57, 0xa5, 0x4d,
+    0xb3, 0xf4, 0x2c, 0x0d, 0x49, 0x69, 0xa9, 0xb7, 0x69, 0xa7, 0x45, 0xc5, 0x6d, 0xda, 0x69, 0xd1,
+    0x71, 0x45, 0x15, 0xe9, 0xd3, 0x6c, 0xfd, 0x0f, 0x03, 0x52, 0x5a, 0x6a, 0x6d, 0xd9, 0xe9, 0xd1,
+    0x71, 0x5b, 0x76, 0x7a, 0x74, 0x5c, 0x51, 0x45, 0x7a, 0x54, 0xdb, 0x3f, 0x42, 0xc0, 0xd4, 0x96,
+    0x9a, 0x9b, 0x76, 0x7a, 0x74, 0x5c, 0x56, 0xaa, 0x69, 0xd1, 0x6d, 0x1c, 0x51, 0x45, 0x7a, 0x30,
+    0x6c, 0xfb, 0xfc, 0x25, 0x49, 0x72, 0xee, 0x7f, 0xff, 0xd9,
+};
+
+static const uint8_t k_gray_jpg[829] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03,
+    0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07,
+    0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d,
+    0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f,
+    0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xc0, 0x00, 0x0b, 0x08, 0x00, 0x35,
+    0x00, 0x4b, 0x01, 0x01, 0x11, 0x00, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03,
+    0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00,
+    0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32,
+    0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72,
+    0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94,
+    0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2,
+    0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9,
+    0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda,
+    0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3f, 0x00, 0xfc, 0xd1, 0xb4, 0xd0, 0xfa, 0x7c, 0xb5, 0xb7,
+    0x67, 0xa1, 0x74, 0xf9, 0x6b, 0x6e, 0xd3, 0x43, 0xe9, 0xf2, 0xd6, 0xdd, 0xa6, 0x87, 0xd3, 0xe5,
+    0xad, 0xbb, 0x4d, 0x0b, 0xa7, 0xcb, 0x5b, 0x76, 0x7a, 0x1f, 0x4f, 0x96, 0xb6, 0xec, 0xf4, 0x3e,
+    0x9f, 0x2d, 0x6d, 0x59, 0xe8, 0x7d, 0x3e, 0x5a, 0xdb, 0xb3, 0xd0, 0xba, 0x7c, 0xb5, 0xaa, 0x9a,
+    0x17, 0xca, 0x3e, 0x5a, 0xf9, 0x56, 0xd3, 0x43, 0xe9, 0xf2, 0xd6, 0xdd, 0xa6, 0x87, 0xd3, 0xe5,
+    0xad, 0xfd, 0x3f, 0xc3, 0xaf, 0x30, 0x25, 0x10, 0x1c, 0x75, 0xe4, 0x0a, 0xd9, 0xb6, 0xd0, 0x1a,
+    0x3c, 0x6e, 0x50, 0x3f, 0x11, 0x5a, 0x96, 0xda, 0x6c, 0x51, 0xe3, 0x71, 0x03, 0xf0, 0xad, 0xbd,
+    0x37, 0x4d, 0x8a, 0xe0, 0x91, 0x19, 0x0d, 0xb7, 0x19, 0xe3, 0xa5, 0x74, 0x16, 0x7a, 0x1f, 0x4f,
+    0x96, 0xb6, 0xec, 0xf4, 0x3e, 0x9f, 0x2f, 0xe9, 0x5b, 0x56, 0x7a, 0x1f, 0x4f, 0x96, 0xb5, 0x97,
+    0x43, 0xf9, 0x47, 0xcb, 0xfa, 0x57, 0xca, 0xb6, 0x9a, 0x1f, 0x4f, 0x96, 0xb6, 0xed, 0x34, 0x3e,
+    0x9f, 0x2f, 0xe9, 0x5a, 0x82, 0xc7, 0xec, 0x48, 0xbc, 0x63, 0x77, 0xf4, 0xa4, 0xa2, 0xbb, 0x0f,
+    0x87, 0xb6, 0x3f, 0x6d, 0x7b, 0xee, 0x33, 0xb7, 0xcb, 0xff, 0x00, 0xd9, 0xab, 0xd0, 0xec, 0xf4,
+    0x3e, 0x9f, 0x2d, 0x6d, 0xd9, 0xe8, 0x7d, 0x3e, 0x5a, 0xdb, 0xb3, 0xd0, 0xfa, 0x7c, 0xb5, 0xaa,
+    0xba, 0x1f, 0xca, 0x3e, 0x5a, 0xf9, 0x56, 0xcf, 0x42, 0xe9, 0xf2, 0xd6, 0xdd, 0x9e, 0x85, 0xd3,
+    0xe5, 0xa3, 0x5a, 0xf0, 0xbd, 0xe5, 0xda, 0xdb, 0x8b, 0x38, 0x3c, 0xdc, 0x6e, 0xdd, 0xf3, 0x05,
+    0xc7, 0x4c, 0x75, 0x3f, 0x5a, 0xa0, 0x9e, 0x02, 0xd7, 0x64, 0xfb, 0xb6, 0x04, 0xff, 0x00, 0xdb,
+    0x54, 0xff, 0x00, 0xe2, 0xaa, 0x74, 0xf8, 0x6b, 0xe2, 0x49, 0x3e, 0xee, 0x9a, 0x4f, 0xfd, 0xb6,
+    0x8f, 0xff, 0x00, 0x8a, 0xae, 0xff, 0x00, 0xe1, 0x6f, 0x81, 0xf5, 0x4d, 0x1d, 0xb5, 0x13, 0xa9,
+    0x5a, 0x7d, 0x9c, 0x4b, 0xe5, 0xf9, 0x7f, 0x3a, 0xb6, 0xec, 0x6e, 0xcf, 0xdd, 0x27, 0x1d, 0x45,
+    0x7a, 0x85, 0xa6, 0x85, 0xd3, 0xe5, 0xad, 0xbb, 0x3d, 0x0b, 0xa7, 0xcb, 0x5b, 0x76, 0x7a, 0x17,
+    0x4f, 0x96, 0xb5, 0x13, 0x42, 0xf9, 0x47, 0xcb, 0xfa, 0x57, 0xca, 0xb6, 0x7a, 0x17, 0x4f, 0x96,
+    0xb6, 0xec, 0xf4, 0x2e, 0x9f, 0x2d, 0x6d, 0xda, 0x68, 0x5d, 0x3e, 0x5a, 0xdb, 0xb4, 0xd0, 0xba,
+    0x7c, 0xb5, 0xb7, 0x67, 0xa1, 0x74, 0xf9, 0x6b, 0x6e, 0xcf, 0x42, 0xe9, 0xf2, 0xd6, 0xdd, 0x9e,
+    0x85, 0xd3, 0xe5, 0xad, 0xbb, 0x3d, 0x0b, 0xa7, 0xcb, 0x5b, 0x76, 0x7a, 0x17, 0x4f, 0x96, 0xb5,
+    0x13, 0x42, 0xf9, 0x47, 0xcb, 0x5f, 0x2b, 0x59, 0xe8, 0x7d, 0x3e, 0x5f, 0xd2, 0xb6, 0xed, 0x34,
+    0x3e, 0x9f, 0x2d, 0x6d, 0xda, 0x68, 0x7d, 0x3e, 0x5a, 0xda, 0xb4, 0xd0, 0xfa, 0x7c, 0xb5, 0xb7,
+    0x69, 0xa1, 0xf4, 0xf9, 0x6b, 0x6e, 0xd3, 0x43, 0xe9, 0xf2, 0xfe, 0x95, 0xb7, 0x67, 0xa1, 0xf4,
+    0xf9, 0x6b, 0x6e, 0xcf, 0x43, 0xe9, 0xf2, 0xd6, 0xdd, 0x9e, 0x87, 0xd3, 0xe5, 0xad, 0x54, 0xd0,
+    0xce, 0xd1, 0xc7, 0xe9, 0x5f, 0x28, 0x5a, 0x69, 0xd1, 0x0c, 0x56, 0xd5, 0xa6, 0x9d, 0x17, 0x15,
+    0xb7, 0x69, 0xa7, 0x45, 0xc5, 0x6d, 0xda, 0x69, 0xd1, 0x71, 0x5b, 0x76, 0x9a, 0x74, 0x5c, 0x56,
+    0xdd, 0xa6, 0x9d, 0x17, 0x15, 0xb7, 0x67, 0xa7, 0x45, 0xc5, 0x6d, 0xd9, 0xe9, 0xd1, 0x71, 0x5b,
+    0x76, 0x7a, 0x74, 0x5c, 0x56, 0xaa, 0x69, 0xd1, 0x6d, 0x1c, 0x57, 0xff, 0xd9,
+};
+
+static const uint8_t k_rst_jpg[1473] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03,
+    0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07,
+    0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d,
+    0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f,
+    0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03, 0x04,
+    0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0,
+    0x00, 0x11, 0x08, 0x00, 0x35, 0x00, 0x4b, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+    0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+    0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+    0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+    0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+    0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+    0xfa, 0xff, 0xdd, 0x00, 0x04, 0x00, 0x01, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11,
+    0x03, 0x11, 0x00, 0x3f, 0x00, 0xfc, 0xd1, 0xb4, 0xd0, 0xfa, 0x7c, 0xb5, 0xb7, 0x67, 0xa1, 0x74,
+    0xf9, 0x6b, 0xa7, 0xb4, 0xd0, 0xfa, 0x7c, 0xb5, 0xb7, 0x69, 0xa1, 0xf4, 0xf9, 0x6a, 0x29, 0xd6,
+    0x38, 0xb0, 0x39, 0xa6, 0xda, 0x9f, 0xff, 0xd0, 0xf8, 0x1e, 0xd3, 0x43, 0xe9, 0xf2, 0xd6, 0xdd,
+    0xa6, 0x87, 0xd3, 0xe5, 0xae, 0xaf, 0x4f, 0xf0, 0xeb, 0xcc, 0x09, 0x44, 0x07, 0x1d, 0x79, 0x02,
+    0xb6, 0x6d, 0xb4, 0x06, 0x8f, 0x1b, 0x94, 0x0f, 0xc4, 0x57, 0x44, 0x71, 0x94, 0xa0, 0xed, 0x29,
+    0xa4, 0xfc, 0xda, 0x3f, 0x49, 0xca, 0xfe, 0xbf, 0x5e, 0x9c, 0x6b, 0x51, 0xa1, 0x39, 0x45, 0xec,
+    0xd4, 0x64, 0xd3, 0xe9, 0xa3, 0x4a, 0xdb, 0x9f, 0xff, 0xd1, 0xf8, 0xf6, 0xd3, 0x42, 0xe9, 0xf2,
+    0xd6, 0xdd, 0x9e, 0x87, 0xd3, 0xe5, 0xae, 0x8a, 0xdb, 0x4d, 0x8a, 0x3c, 0x6e, 0x20, 0x7e, 0x15,
+    0xb7, 0xa6, 0xe9, 0xb1, 0x5c, 0x12, 0x23, 0x21, 0xb6, 0xe3, 0x3c, 0x74, 0xaf, 0x66, 0x8e, 0x3a,
+    0x8c, 0xe4, 0xa3, 0x19, 0xa6, 0xfd, 0x51, 0xfd, 0x0d, 0x86, 0xab, 0x8b, 0xa1, 0x1e, 0x7a, 0xd4,
+    0xa5, 0x14, 0xba, 0xb8, 0xb4, 0xbf, 0x14, 0x7f, 0xff, 0xd2, 0xf9, 0xce, 0xcf, 0x43, 0xe9, 0xf2,
+    0xd6, 0xd5, 0x9e, 0x87, 0xd3, 0xe5, 0xae, 0xa2, 0xcf, 0x43, 0xe9, 0xf2, 0xd6, 0xdd, 0x9e, 0x87,
+    0xd3, 0xe5, 0xfd, 0x2b, 0xed, 0x29, 0xd6, 0x3f, 0xae, 0xb0, 0x39, 0xa6, 0xda, 0x9f, 0xff, 0xd3,
+    0xf2, 0x8b, 0x3d, 0x0b, 0xa7, 0xcb, 0x5a, 0xa9, 0xa1, 0x7c, 0xa3, 0xe5, 0xae, 0xb6, 0xcf, 0x43,
+    0xe9, 0xf2, 0xd6, 0xb2, 0xe8, 0x7f, 0x28, 0xf9, 0x7f, 0x4a, 0xfd, 0x16, 0x15, 0x74, 0x3f, 0xbe,
+    0x70, 0x99, 0xa7, 0xbb, 0xb9, 0xff, 0xd4, 0xf9, 0x5a, 0xd3, 0x43, 0xe9, 0xf2, 0xd6, 0xdd, 0xa6,
+    0x87, 0xd3, 0xe5, 0xfd, 0x2b, 0xa7, 0xb3, 0xd0, 0xba, 0x7c, 0xb5, 0xb7, 0x67, 0xa1, 0x74, 0xf9,
+    0x6b, 0xc1, 0xa7, 0x58, 0xfc, 0x4f, 0x03, 0x9a, 0x6d, 0xa9, 0xff, 0xd5, 0xf0, 0x51, 0x63, 0xf6,
+    0x24, 0x5e, 0x31, 0xbb, 0xfa, 0x52, 0x57, 0x5f, 0xad, 0x78, 0x5e, 0xf2, 0xed, 0x6d, 0xc5, 0x9c,
+    0x1e, 0x6e, 0x37, 0x6e, 0xf9, 0x82, 0xe3, 0xa6, 0x3a, 0x9f, 0xad, 0x50, 0x4f, 0x01, 0x6b, 0xb2,
+    0x7d, 0xdb, 0x02, 0x7f, 0xed, 0xaa, 0x7f, 0xf1, 0x55, 0xf1, 0xd8, 0x98, 0x4e, 0xa5, 0x67, 0x28,
+    0xa6, 0xf6, 0xfc, 0x8f, 0xde, 0xf8, 0x07, 0x88, 0xb2, 0x9a, 0x5c, 0x39, 0x85, 0xa7, 0x89, 0xc5,
+    0xd3, 0x84, 0xd7, 0x3d, 0xe3, 0x29, 0xc5, 0x35, 0xef, 0xca, 0xd7, 0x4d, 0xdd, 0x5d, 0x59, 0xfa,
+    0x1f, 0xff, 0xd6, 0xf0, 0x4a, 0xec, 0x3e, 0x1e, 0xd8, 0xfd, 0xb5, 0xef, 0xb8, 0xce, 0xdf, 0x2f,
+    0xff, 0x00, 0x66, 0xaa, 0xc9, 0xf0, 0xd7, 0xc4, 0x92, 0x7d, 0xdd, 0x34, 0x9f, 0xfb, 0x6d, 0x1f,
+    0xff, 0x00, 0x15, 0x5d, 0xff, 0x00, 0xc2, 0xdf, 0x03, 0xea, 0x9a, 0x3b, 0x6a, 0x27, 0x52, 0xb4,
+    0xfb, 0x38, 0x97, 0xcb, 0xf2, 0xfe, 0x75, 0x6d, 0xd8, 0xdd, 0x9f, 0xba, 0x4e, 0x3a, 0x8a, 0xf9,
+    0x8c, 0xba, 0x9d, 0x4a, 0x78, 0xa8, 0x4e, 0x51, 0x69, 0x6b, 0xd3, 0xc9, 0x9f, 0xd3, 0xbc, 0x43,
+    0x9e, 0xe5, 0xb5, 0x72, 0xba, 0xab, 0x0d, 0x89, 0x84, 0xe5, 0xee, 0xd9, 0x46, 0x71, 0x6d, 0xfb,
+    0xcb, 0xa2, 0x77, 0xd8, 0xff, 0xd7, 0xaf, 0x67, 0xa1, 0xf4, 0xf9, 0x6b, 0x6e, 0xcf, 0x43, 0xe9,
+    0xf2, 0xd7, 0x51, 0x69, 0xa1, 0x74, 0xf9, 0x6b, 0x6e, 0xcf, 0x42, 0xe9, 0xf2, 0xd7, 0xb3, 0x4e,
+    0xa9, 0xfa, 0xe6, 0x07, 0x34, 0xdb, 0x53, 0xff, 0xd0, 0xeb, 0xac, 0xf4, 0x3e, 0x9f, 0x2d, 0x6a,
+    0xae, 0x87, 0xf2, 0x8f, 0x96, 0xba, 0xeb, 0x3d, 0x0b, 0xa7, 0xcb, 0x5a, 0x89, 0xa1, 0x7c, 0xa3,
+    0xe5, 0xfd, 0x2b, 0xea, 0xe1, 0x5b, 0x43, 0xfa, 0x6b, 0x09, 0x9a, 0x7b, 0xbb, 0x9f, 0xff, 0xd1,
+    0xe6, 0xac, 0xf4, 0x2e, 0x9f, 0x2d, 0x6d, 0xd9, 0xe8, 0x5d, 0x3e, 0x5a, 0xea, 0x2c, 0xf4, 0x3e,
+    0x9f, 0x2f, 0xe9, 0x5b, 0x76, 0x9a, 0x1f, 0x4f, 0x96, 0xbe, 0x1e, 0x9d, 0x63, 0xf8, 0xd7, 0x03,
+    0x9a, 0x6d, 0xa9, 0xff, 0xd2, 0xd1, 0xb4, 0xd0, 0xba, 0x7c, 0xb5, 0xb7, 0x69, 0xa1, 0x74, 0xf9,
+    0x6b, 0xa8, 0xb4, 0xd0, 0xfa, 0x7c, 0xb5, 0xb5, 0x69, 0xa1, 0xf4, 0xf9, 0x6b, 0xe6, 0x69, 0xd6,
+    0x3f, 0x9d, 0xf0, 0x39, 0xa6, 0xda, 0x9f, 0xff, 0xd3, 0xf4, 0x7b, 0x3d, 0x0b, 0xa7, 0xcb, 0x5b,
+    0x76, 0x7a, 0x17, 0x4f, 0x96, 0xba, 0x7b, 0x4d, 0x0f, 0xa7, 0xcb, 0x5b, 0x76, 0x9a, 0x1f, 0x4f,
+    0x97, 0xf4, 0xaf, 0x32, 0x9d, 0x53, 0xf3, 0xac, 0x0e, 0x69, 0xb6, 0xa7, 0xff, 0xd4, 0xf7, 0xdb,
+    0x3d, 0x0b, 0xa7, 0xcb, 0x5b, 0x76, 0x7a, 0x17, 0x4f, 0x96, 0xba, 0x7b, 0x3d, 0x0f, 0xa7, 0xcb,
+    0x5b, 0x76, 0x7a, 0x1f, 0x4f, 0x96, 0x95, 0x3a, 0xc4, 0x60, 0x73, 0x4d, 0xb5, 0x3f, 0xff, 0xd5,
+    0xfa, 0xce, 0xcf, 0x42, 0xe9, 0xf2, 0xd6, 0xa2, 0x68, 0x5f, 0x28, 0xf9, 0x6b, 0xae, 0xb3, 0xd0,
+    0xfa, 0x7c, 0xb5, 0xaa, 0x9a, 0x19, 0xda, 0x38, 0xfd, 0x2b, 0xd0, 0x85, 0x6d, 0x0f, 0xbc, 0xc2,
+    0x66, 0x9e, 0xee, 0xe7, 0xff, 0xd6, 0xf5, 0xbb, 0x4d, 0x3a, 0x21, 0x8a, 0xda, 0xb4, 0xd3, 0xa2,
+    0xe2, 0x8a, 0x2b, 0xf3, 0x3a, 0x6d, 0x9f, 0xe7, 0x76, 0x06, 0xa4, 0xb4, 0xd4, 0xff, 0xd7, 0xfa,
+    0x42, 0xd3, 0x4e, 0x8b, 0x8a, 0xdb, 0xb4, 0xd3, 0xa2, 0xe2, 0x8a, 0x2b, 0xe1, 0x69, 0xb6, 0x7f,
+    0x18, 0x60, 0x6a, 0x4b, 0x4d, 0x4f, 0xff, 0xd0, 0xfb, 0x1a, 0xd3, 0x4e, 0x8b, 0x8a, 0xdb, 0xb4,
+    0xd3, 0xa2, 0xe2, 0x8a, 0x2b, 0xe6, 0x29, 0xb6, 0x7f, 0x39, 0xe0, 0x6a, 0x4b, 0x4d, 0x4f, 0xff,
+    0xd1, 0xfb, 0xf2, 0xcf, 0x4e, 0x8b, 0x8a, 0xdb, 0xb3, 0xd3, 0xa2, 0xe2, 0x8a, 0x2b, 0xca, 0xa6,
+    0xd9, 0xf9, 0xae, 0x06, 0xa4, 0xb4, 0xd4, 0xff, 0xd2, 0xfd, 0x32, 0xb3, 0xd3, 0xa2, 0xe2, 0xb5,
+    0x53, 0x4e, 0x8b, 0x68, 0xe2, 0x8a, 0x2b, 0x38, 0x36, 0x72, 0x61, 0x2a, 0x4b, 0x97, 0x73, 0xff,
+    0xd9,
+};
+
+static const uint8_t k_prog_jpg[1238] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03,
+    0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07,
+    0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d,
+    0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f,
+    0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03, 0x04,
+    0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc2,
+    0x00, 0x11, 0x08, 0x00, 0x35, 0x00, 0x4b, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xff, 0xc4, 0x00, 0x1a, 0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x01, 0x03, 0x07, 0x08, 0xff, 0xc4, 0x00,
+    0x1a, 0x01, 0x00, 0x03, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x05, 0x06, 0x02, 0x03, 0x08, 0x07, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00,
+    0x02, 0x10, 0x03, 0x10, 0x00, 0x00, 0x01, 0xf9, 0xa1, 0xb5, 0x1b, 0x8e, 0x89, 0x8d, 0xac, 0xcd,
+    0xd5, 0x72, 0xdb, 0x45, 0xc4, 0x3f, 0x9c, 0xda, 0x8d, 0x39, 0xd4, 0xb5, 0xd6, 0x59, 0x0f, 0xfc,
+    0xa9, 0xd4, 0xdd, 0x1d, 0xc9, 0xb2, 0x38, 0xb0, 0x71, 0x7d, 0xce, 0x7d, 0x8e, 0xbb, 0xfb, 0x58,
+    0xf7, 0xb6, 0xa3, 0xa8, 0x27, 0xe5, 0xaa, 0xba, 0x89, 0x7f, 0xe5, 0x4e, 0xa8, 0xd8, 0xee, 0x4d,
+    0x96, 0xea, 0x8d, 0x26, 0x86, 0x5b, 0xa9, 0xb8, 0x9a, 0x19, 0x6e, 0xa6, 0xe2, 0x68, 0x65, 0xaa,
+    0xba, 0xc9, 0xa0, 0xf2, 0x76, 0xed, 0x23, 0xcb, 0x0e, 0x6e, 0xc4, 0xd0, 0xb9, 0xbb, 0x13, 0x44,
+    0xe6, 0xec, 0x4d, 0x0b, 0x95, 0xb1, 0x2f, 0xff, 0x00, 0xff, 0xc4, 0x00, 0x1f, 0x10, 0x00, 0x03,
+    0x01, 0x00, 0x02, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x03, 0x01, 0x04, 0x13, 0x05, 0x11, 0x12, 0x10, 0x14, 0x15, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01,
+    0x00, 0x01, 0x05, 0x02, 0x58, 0x09, 0x01, 0x60, 0x2c, 0x05, 0x80, 0x90, 0x12, 0x02, 0x40, 0x48,
+    0x1d, 0x02, 0xc0, 0x58, 0x13, 0xe3, 0xfb, 0x16, 0x1e, 0x85, 0x9e, 0x61, 0x39, 0xe3, 0x09, 0x01,
+    0x20, 0x24, 0x0e, 0x81, 0x60, 0x2c, 0x0f, 0x8f, 0x8f, 0xcf, 0x8f, 0x4f, 0xb1, 0x20, 0x24, 0x04,
+    0x81, 0xd0, 0x24, 0x04, 0x81, 0x6e, 0x2b, 0xb1, 0xfa, 0x17, 0xd3, 0xf9, 0xbc, 0x9d, 0x3c, 0x5f,
+    0x06, 0xb1, 0x16, 0x02, 0x40, 0x48, 0x1d, 0x02, 0x40, 0x48, 0x0b, 0x01, 0x60, 0x24, 0x04, 0x80,
+    0x90, 0x12, 0x02, 0x40, 0xe8, 0x12, 0x02, 0xc0, 0x58, 0x0b, 0x01, 0x60, 0x2c, 0x04, 0x80, 0x90,
+    0x12, 0x07, 0x40, 0xb3, 0xc1, 0x67, 0x82, 0xcf, 0x05, 0x9e, 0x0b, 0x3c, 0x16, 0x78, 0x24, 0xf0,
+    0x49, 0xe0, 0x93, 0xc3, 0xaf, 0x0f, 0xff, 0xc4, 0x00, 0x20, 0x11, 0x00, 0x02, 0x03, 0x00, 0x02,
+    0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x02, 0x04,
+    0x05, 0x21, 0x11, 0x13, 0x51, 0x31, 0x71, 0x81, 0xff, 0xda, 0x00, 0x08, 0x01, 0x03, 0x01, 0x01,
+    0x3f, 0x01, 0x46, 0xa9, 0x97, 0xdf, 0x7a, 0x8b, 0xd2, 0x84, 0x8f, 0xd1, 0x8b, 0xb3, 0x68, 0x3c,
+    0xde, 0xa4, 0x7f, 0x22, 0x35, 0x45, 0x6a, 0xea, 0x23, 0x54, 0xe0, 0x39, 0x1c, 0x95, 0xe3, 0x95,
+    0x56, 0x36, 0xa0, 0xf7, 0xd1, 0x23, 0xe9, 0x9c, 0x86, 0xec, 0xd6, 0xcb, 0x6f, 0x5b, 0x01, 0x3d,
+    0x7e, 0x08, 0xfb, 0x11, 0xaa, 0x2b, 0x57, 0x51, 0x1a, 0xa2, 0x35, 0x44, 0x6a, 0x88, 0xd5, 0x15,
+    0xab, 0xa8, 0x8b, 0x18, 0x8b, 0x18, 0x8b, 0x18, 0x8b, 0x18, 0xab, 0x1f, 0x13, 0xff, 0xc4, 0x00,
+    0x1a, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x01, 0x03, 0x11, 0x04, 0x31, 0xff, 0xda, 0x00, 0x08, 0x01, 0x02, 0x01,
+    0x01, 0x3f, 0x01, 0x2e, 0xce, 0xc7, 0x3f, 0x76, 0x1d, 0xc6, 0xef, 0x99, 0xb1, 0x76, 0x28, 0xbb,
+    0xa6, 0x6a, 0x7e, 0xe5, 0xf3, 0x94, 0x7a, 0xe6, 0xee, 0x45, 0x58, 0xe2, 0xe2, 0xe2, 0xa2, 0xec,
+    0x71, 0x8c, 0x63, 0x65, 0xff, 0xc4, 0x00, 0x22, 0x10, 0x00, 0x00, 0x04, 0x04, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x11, 0x03, 0x12, 0x30,
+    0xa1, 0x13, 0x20, 0x21, 0x32, 0x33, 0x50, 0x81, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x06,
+    0x3f, 0x02, 0xaf, 0xa5, 0x25, 0xf9, 0x9d, 0x32, 0x13, 0x8d, 0x97, 0x1c, 0x77, 0x21, 0x13, 0x11,
+    0x32, 0xbb, 0x37, 0x47, 0xff, 0xc4, 0x00, 0x20, 0x10, 0x01, 0x01, 0x00, 0x02, 0x02, 0x02, 0x02,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x01, 0x31, 0x11, 0x21, 0x51,
+    0x71, 0x10, 0xd1, 0x30, 0xa1, 0xf0, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x3f, 0x21,
+    0x92, 0x09, 0x24, 0x92, 0x08, 0x20, 0x83, 0x1d, 0x34, 0x92, 0x4c, 0xba, 0xe1, 0x97, 0x6c, 0x36,
+    0x8f, 0x38, 0xe1, 0x04, 0x10, 0x63, 0xa6, 0x92, 0x49, 0xd5, 0x8b, 0xf3, 0xce, 0x9f, 0xb2, 0x08,
+    0x20, 0xc7, 0x4d, 0x20, 0x83, 0x13, 0xe4, 0xb9, 0xef, 0x86, 0x34, 0x3f, 0x57, 0xdb, 0x1a, 0x9f,
+    0xdb, 0xdb, 0x31, 0xed, 0x86, 0x33, 0xce, 0xfc, 0x24, 0x82, 0x0c, 0x74, 0xd2, 0x08, 0x24, 0x92,
+    0x08, 0x20, 0x82, 0x0c, 0x74, 0xd2, 0x09, 0x24, 0x92, 0x49, 0x20, 0x82, 0x0c, 0x74, 0xfc, 0x52,
+    0x49, 0x20, 0x03, 0x1c, 0x0f, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x10, 0x5d, 0x56, 0x84, 0xbe, 0x85, 0xf7, 0x69, 0xe9, 0x20, 0xae, 0xbe, 0x3d, 0x75,
+    0xe7, 0x9d, 0xff, 0xc4, 0x00, 0x1c, 0x11, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x31, 0x11, 0x41, 0x51, 0x71, 0xa1,
+    0xff, 0xda, 0x00, 0x08, 0x01, 0x03, 0x01, 0x01, 0x3f, 0x10, 0xc2, 0x9d, 0x61, 0x98, 0xd3, 0x13,
+    0xf2, 0x34, 0xb9, 0xa7, 0x3d, 0x45, 0xeb, 0x64, 0xbf, 0xa8, 0xc2, 0x9f, 0x61, 0x85, 0x10, 0xcd,
+    0xda, 0x26, 0xb2, 0xea, 0x6f, 0xab, 0xab, 0x8f, 0xf0, 0x5a, 0xe7, 0x89, 0xa6, 0xe3, 0xc4, 0xfb,
+    0x86, 0x14, 0xfb, 0x0c, 0x29, 0x85, 0x30, 0xa6, 0x14, 0xfb, 0x08, 0x29, 0x05, 0x20, 0xa4, 0x14,
+    0xf6, 0x0f, 0xff, 0xc4, 0x00, 0x1e, 0x11, 0x01, 0x01, 0x00, 0x02, 0x01, 0x05, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x21, 0x61, 0x11, 0x20, 0x31, 0x41,
+    0x71, 0xb1, 0xff, 0xda, 0x00, 0x08, 0x01, 0x02, 0x01, 0x01, 0x3f, 0x10, 0x84, 0xfa, 0x08, 0xf2,
+    0x90, 0x20, 0xaf, 0xd3, 0x06, 0xbc, 0x0f, 0x01, 0x7c, 0x7e, 0x4c, 0x30, 0x37, 0xeb, 0x87, 0x0e,
+    0xae, 0xd0, 0x4d, 0x52, 0x64, 0xc9, 0x93, 0x36, 0xff, 0xc4, 0x00, 0x20, 0x10, 0x00, 0x02, 0x03,
+    0x01, 0x00, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x01,
+    0x11, 0x21, 0xc1, 0x81, 0x10, 0x41, 0x61, 0x71, 0xa1, 0xd1, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01,
+    0x00, 0x01, 0x3f, 0x10, 0x50, 0x48, 0x50, 0x50, 0x58, 0x40, 0x40, 0x40, 0x48, 0xcc, 0x14, 0x14,
+    0x20, 0xa6, 0x63, 0x9a, 0x7b, 0x10, 0x56, 0x51, 0x1e, 0x60, 0xaa, 0xb4, 0x47, 0x82, 0x4a, 0x62,
+    0x51, 0x85, 0xe2, 0x10, 0x11, 0xc0, 0x81, 0x83, 0x81, 0x41, 0x5c, 0x10, 0x9a, 0xbf, 0x8f, 0x54,
+    0x6b, 0x02, 0x02, 0x02, 0x06, 0x00, 0x90, 0x91, 0x02, 0x63, 0xf6, 0x14, 0x54, 0xe7, 0xec, 0x7c,
+    0xc9, 0x9c, 0x12, 0x09, 0x06, 0x97, 0xc4, 0x8d, 0x34, 0xd3, 0x81, 0x61, 0x21, 0x23, 0x37, 0x02,
+    0x42, 0x42, 0xc2, 0xc2, 0x42, 0x42, 0x42, 0x42, 0x46, 0x60, 0x8e, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x70, 0x20, 0x20, 0x20, 0x4d, 0x4c, 0xfc, 0x23, 0xd1, 0x9c, 0xce, 0x67, 0x33, 0x99, 0xcc, 0x66,
+    0x33, 0x19, 0x5d, 0x87, 0xff, 0xd9,
+};
+
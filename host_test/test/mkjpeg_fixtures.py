@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+"""Regenerate jpeg_fixtures.h for test_jpeg_dec (needs Pillow).
+
+    host_test/test/mkjpeg_fixtures.py > host_test/test/jpeg_fixtures.h
+
+Every fixture encodes the same synthetic image, which test_jpeg_dec.c
+recomputes as its reference (fixture_px there must match src_px here). The
+size is odd on purpose so the right and bottom MCUs are partial.
+"""
+import io
+
+from PIL import Image
+
+W, H = 75, 53
+
+
+def src_px(x, y):
+    """Smooth ramps plus a hard-edged block, in 0..255 integers only."""
+    if 20 <= x < 44 and 14 <= y < 30:
+        return (200, 30, 40)
+    return (x * 255 // (W - 1), y * 255 // (H - 1), (x + y) * 255 // (W + H - 2))
+
+
+def encode(img, **kw):
+    buf = io.BytesIO()
+    img.save(buf, "JPEG", **kw)
+    return buf.getvalue()
+
+
+def main():
+    img = Image.new("RGB", (W, H))
+    img.putdata([src_px(x, y) for y in range(H) for x in range(W)])
+    fixtures = [
+        ("q444", encode(img, quality=92, subsampling=0)),
+        ("q422", encode(img, quality=90, subsampling=1)),
+        ("q420", encode(img, quality=90, subsampling=2)),
+        ("gray", encode(img.convert("L"), quality=90)),
+        ("rst",  encode(img, quality=90, subsampling=2, restart_marker_blocks=1)),
+        ("prog", encode(img, quality=90, progressive=True)),
+    ]
+    print("/* Generated by mkjpeg_fixtures.py; do not edit. */")
+    print("#pragma once")
+    print("#include <stdint.h>\n")
+    print("#define FIXTURE_W %d" % W)
+    print("#define FIXTURE_H %d\n" % H)
+    for name, data in fixtures:
+        print("static const uint8_t k_%s_jpg[%d] = {" % (name, len(data)))
+        for i in range(0, len(data), 16):
+            print("    " + " ".join("0x%02x," % b for b in data[i:i + 16]))
+        print("};\n")
+
+
+if __name__ == "__main__":
+    main()
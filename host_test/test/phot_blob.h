@@ -0,0 +1,34 @@
+#pragma once
+
+/*
+ * Pack JPEGs into a PHOT blob (image/slideshow.h) the way tools/mkphotos.py
+ * does, for registering as a host "photos" partition. Returns a malloc'd
+ * blob (caller frees) or NULL.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "image/slideshow.h"
+
+static inline uint8_t *phot_blob(const uint8_t *const *files, const size_t *sizes, int n, size_t *out_len)
+{
+    size_t off = SLIDESHOW_HEADER_LEN + (size_t)n * SLIDESHOW_ENTRY_LEN;
+    size_t len = off;
+    for (int i = 0; i < n; ++i) len += (sizes[i] + 3) & ~(size_t)3;
+    uint8_t *b = calloc(1, len);
+    if (!b) return NULL;
+
+    memcpy(b, SLIDESHOW_MAGIC, 4);
+    const uint16_t hdr[2] = { SLIDESHOW_VERSION, (uint16_t)n };
+    memcpy(b + 4, hdr, sizeof(hdr));
+    for (int i = 0; i < n; ++i) {
+        const uint32_t e[2] = { (uint32_t)off, (uint32_t)sizes[i] };
+        memcpy(b + SLIDESHOW_HEADER_LEN + (size_t)i * SLIDESHOW_ENTRY_LEN, e, sizeof(e));
+        memcpy(b + off, files[i], sizes[i]);
+        off += (sizes[i] + 3) & ~(size_t)3;
+    }
+    *out_len = len;
+    return b;
+}
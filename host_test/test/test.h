@@ -0,0 +1,34 @@
+#pragma once
+
+/* Minimal assertions for host tests: report every failure, exit non-zero at the end. */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+static int test_failures;
+
+#define CHECK(cond) do {                                                         \
+        if (!(cond)) {                                                           \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            ++test_failures;                                                     \
+        }                                                                        \
+    } while (0)
+
+#define CHECK_EQ(a, b) do {                                                      \
+        const long long a_ = (long long)(a), b_ = (long long)(b);                \
+        if (a_ != b_) {                                                          \
+            fprintf(stderr, "%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n",    \
+                    __FILE__, __LINE__, #a, #b, a_, b_);                         \
+            ++test_failures;                                                     \
+        }                                                                        \
+    } while (0)
+
+#define RUN_TEST(fn) do {                                                        \
+        const int before_ = test_failures;                                       \
+        fn();                                                                    \
+        fprintf(stderr, "%s %s\n", test_failures == before_ ? "PASS" : "FAIL", #fn); \
+    } while (0)
+
+#define TEST_EXIT() (test_failures ? 1 : 0)
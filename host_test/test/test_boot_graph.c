@@ -0,0 +1,137 @@
+/*
+ * util/boot_graph on the pthreads shim: a stage starts only after all of its
+ * deps have finished, independent stages overlap, a failure skips everything
+ * downstream of it (transitively) and nothing else, and malformed graphs are
+ * rejected before anything runs.
+ */
+#include <stdatomic.h>
+#include <unistd.h>
+
+#include "test.h"
+#include "util/boot_graph.h"
+
+#define RERUNS 8
+
+typedef struct {
+    const boot_stage_t *stages;
+    atomic_uint         done;         // BOOT_DEP bits of stages whose fn returned
+    atomic_uint         ran;          // BOOT_DEP bits of stages whose fn was called
+    atomic_int          early;        // stages that started before a dep had finished
+    uint32_t            fail_mask;    // stages that return an error
+    int                 sleep_ms;
+} ctx_t;
+
+/* Every stage records when it ran and whether its deps had all finished by then. */
+static esp_err_t stage_fn(void *arg, int i)
+{
+    ctx_t *c = arg;
+    atomic_fetch_or(&c->ran, BOOT_DEP(i));
+    const uint32_t deps = c->stages[i].deps;
+    if ((atomic_load(&c->done) & deps) != deps) atomic_fetch_add(&c->early, 1);
+    if (c->sleep_ms) usleep((useconds_t)c->sleep_ms * 1000);
+    atomic_fetch_or(&c->done, BOOT_DEP(i));
+    return (c->fail_mask & BOOT_DEP(i)) ? ESP_FAIL : ESP_OK;
+}
+
+static esp_err_t s0(void *a) { return stage_fn(a, 0); }
+static esp_err_t s1(void *a) { return stage_fn(a, 1); }
+static esp_err_t s2(void *a) { return stage_fn(a, 2); }
+static esp_err_t s3(void *a) { return stage_fn(a, 3); }
+static esp_err_t s4(void *a) { return stage_fn(a, 4); }
+static esp_err_t s5(void *a) { return stage_fn(a, 5); }
+
+/* Shaped like main.c's: two roots fanning into a join, plus an independent leaf. */
+static const boot_stage_t kGraph[] = {
+    { "a",    s0, 0, 0 },
+    { "b",    s1, 0, 0 },
+    { "c",    s2, BOOT_DEP(0), 0 },
+    { "d",    s3, BOOT_DEP(1), 0 },
+    { "join", s4, BOOT_DEP(2) | BOOT_DEP(3), 0 },
+    { "leaf", s5, 0, 0 },
+};
+#define N_GRAPH ((int)(sizeof(kGraph) / sizeof(kGraph[0])))
+
+static void test_order(void)
+{
+    ctx_t c = { .stages = kGraph, .sleep_ms = 5 };
+    boot_report_t r;
+    CHECK_EQ(boot_graph_run(kGraph, N_GRAPH, &c, &r), ESP_OK);
+    CHECK_EQ(atomic_load(&c.early), 0);
+    CHECK_EQ(atomic_load(&c.ran), BOOT_DEP(N_GRAPH) - 1);
+    for (int i = 0; i < N_GRAPH; ++i) {
+        CHECK_EQ(r.stage[i].status, BOOT_STAGE_OK);
+        CHECK(r.stage[i].end_us >= r.stage[i].start_us);
+        CHECK(r.stage[i].end_us <= r.t1_us);
+        for (uint32_t d = kGraph[i].deps, j = 0; d; d >>= 1, ++j) {
+            if (d & 1) CHECK(r.stage[i].start_us >= r.stage[j].end_us);
+        }
+    }
+    CHECK(r.t0_us <= r.stage[0].start_us);
+}
+
+static void test_overlap(void)
+{
+    // The critical path is three stages deep; six run serially would take twice that.
+    ctx_t c = { .stages = kGraph, .sleep_ms = 20 };
+    boot_report_t r;
+    CHECK_EQ(boot_graph_run(kGraph, N_GRAPH, &c, &r), ESP_OK);
+    const uint64_t wall = r.t1_us - r.t0_us;
+    CHECK(wall < (uint64_t)N_GRAPH * 20000 * 3 / 4);
+    CHECK(wall >= 3 * 20000);
+}
+
+static void test_failure_skips_downstream(void)
+{
+    ctx_t c = { .stages = kGraph, .fail_mask = BOOT_DEP(1) };
+    boot_report_t r;
+    CHECK_EQ(boot_graph_run(kGraph, N_GRAPH, &c, &r), ESP_OK);
+    CHECK_EQ(r.stage[1].status, BOOT_STAGE_FAILED);
+    CHECK_EQ(r.stage[1].err, ESP_FAIL);
+    CHECK_EQ(r.stage[3].status, BOOT_STAGE_SKIPPED);   // direct dependent
+    CHECK_EQ(r.stage[4].status, BOOT_STAGE_SKIPPED);   // through d
+    CHECK_EQ(r.stage[0].status, BOOT_STAGE_OK);
+    CHECK_EQ(r.stage[2].status, BOOT_STAGE_OK);
+    CHECK_EQ(r.stage[5].status, BOOT_STAGE_OK);
+    CHECK_EQ(atomic_load(&c.ran) & (BOOT_DEP(3) | BOOT_DEP(4)), 0);
+}
+
+static void test_rejects_malformed(void)
+{
+    ctx_t c = { .stages = kGraph };
+    boot_report_t r;
+    const boot_stage_t forward[] = { { "x", s0, BOOT_DEP(1), 0 }, { "y", s1, 0, 0 } };
+    const boot_stage_t self[]    = { { "x", s0, BOOT_DEP(0), 0 } };
+    const boot_stage_t no_fn[]   = { { "x", s0, 0, 0 }, { "y", NULL, 0, 0 } };
+
+    esp_shim_log_level = ESP_LOG_NONE;
+    CHECK_EQ(boot_graph_run(forward, 2, &c, &r), ESP_ERR_INVALID_ARG);
+    CHECK_EQ(boot_graph_run(self, 1, &c, &r), ESP_ERR_INVALID_ARG);
+    CHECK_EQ(boot_graph_run(no_fn, 2, &c, &r), ESP_ERR_INVALID_ARG);
+    CHECK_EQ(boot_graph_run(kGraph, 0, &c, &r), ESP_ERR_INVALID_ARG);
+    CHECK_EQ(boot_graph_run(kGraph, BOOT_GRAPH_MAX_STAGES + 1, &c, &r), ESP_ERR_INVALID_ARG);
+    CHECK_EQ(boot_graph_run(kGraph, N_GRAPH, &c, NULL), ESP_ERR_INVALID_ARG);
+    esp_shim_log_level = ESP_LOG_INFO;
+    CHECK_EQ(atomic_load(&c.ran), 0);
+}
+
+static void test_rerun(void)
+{
+    // Back-to-back graphs must not see the previous run's done bits.
+    for (int k = 0; k < RERUNS; ++k) {
+        ctx_t c = { .stages = kGraph };
+        boot_report_t r;
+        CHECK_EQ(boot_graph_run(kGraph, N_GRAPH, &c, &r), ESP_OK);
+        CHECK_EQ(atomic_load(&c.early), 0);
+        CHECK_EQ(atomic_load(&c.done), BOOT_DEP(N_GRAPH) - 1);
+    }
+}
+
+int main(void)
+{
+    RUN_TEST(test_order);
+    RUN_TEST(test_overlap);
+    RUN_TEST(test_failure_skips_downstream);
+    RUN_TEST(test_rejects_malformed);
+    RUN_TEST(test_rerun);
+    return TEST_EXIT();
+}
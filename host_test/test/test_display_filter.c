@@ -0,0 +1,208 @@
+/*
+ * display_panel's present filter (the real display.c) against a simulated
+ * DPI panel: repeated frames are skipped, changed tile rows go out as bands,
+ * and anything that changes the panel behind the filter's back (a partial
+ * present, a flip) makes the next full frame go out whole.
+ */
+#include <stdarg.h>
+#include <stdlib.h>
+
+#include "test.h"
+#include "display_panel/display.h"
+#include "esp_lcd_panel_ops.h"
+#include "util/mem.h"
+
+#define TILE 32
+
+/* Scanout side of the panel: two frame buffers, draws copy into the front one. */
+typedef struct {
+    int       w, h;
+    uint16_t *fbs[2];
+    int       front;
+    uint32_t  draws;      // copies (not flips)
+    uint64_t  px;         // pixels copied
+    uint32_t  flips;
+    esp_lcd_dpi_panel_event_callbacks_t cbs;
+    void     *cb_ctx;
+} panel_sim_t;
+
+static panel_sim_t s_panel;
+#define SIM ((esp_lcd_panel_handle_t)&s_panel)
+
+esp_err_t esp_lcd_new_dsi_bus(const esp_lcd_dsi_bus_config_t *cfg, esp_lcd_dsi_bus_handle_t *out)
+{
+    *out = (esp_lcd_dsi_bus_handle_t)&s_panel;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_new_panel_io_dbi(esp_lcd_dsi_bus_handle_t bus, const esp_lcd_dbi_io_config_t *cfg,
+                                   esp_lcd_panel_io_handle_t *out)
+{
+    *out = (esp_lcd_panel_io_handle_t)&s_panel;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_new_panel_jd9365(esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *cfg,
+                                   esp_lcd_panel_handle_t *out)
+{
+    const jd9365_vendor_config_t *v = cfg->vendor_config;
+    s_panel.w = (int)v->mipi_config.dpi_config->video_timing.h_size;
+    s_panel.h = (int)v->mipi_config.dpi_config->video_timing.v_size;
+    for (int i = 0; i < 2; ++i) s_panel.fbs[i] = calloc((size_t)s_panel.w * s_panel.h, sizeof(uint16_t));
+    *out = SIM;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_reset(esp_lcd_panel_handle_t panel) { return ESP_OK; }
+esp_err_t esp_lcd_panel_init(esp_lcd_panel_handle_t panel) { return ESP_OK; }
+esp_err_t esp_lcd_panel_disp_on_off(esp_lcd_panel_handle_t panel, bool on) { return ESP_OK; }
+
+esp_err_t esp_lcd_dpi_panel_get_frame_buffer(esp_lcd_panel_handle_t panel, uint32_t fb_num, void **fb0, ...)
+{
+    va_list ap;
+    va_start(ap, fb0);
+    *fb0 = s_panel.fbs[0];
+    if (fb_num > 1) *va_arg(ap, void **) = s_panel.fbs[1];
+    va_end(ap);
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_dpi_panel_register_event_callbacks(esp_lcd_panel_handle_t panel,
+                                                     const esp_lcd_dpi_panel_event_callbacks_t *cbs, void *ctx)
+{
+    s_panel.cbs    = *cbs;
+    s_panel.cb_ctx = ctx;
+    return ESP_OK;
+}
+
+/* A frame buffer retargets scanout; anything else is copied into the front buffer. Completes at once. */
+esp_err_t esp_lcd_panel_draw_bitmap(esp_lcd_panel_handle_t panel, int x0, int y0, int x1, int y1,
+                                    const void *color_data)
+{
+    panel_sim_t *p = (panel_sim_t *)panel;
+    if (color_data == p->fbs[0] || color_data == p->fbs[1]) {
+        p->front = (color_data == p->fbs[1]);
+        p->flips++;
+    } else {
+        const uint16_t *src = color_data;
+        const int w = x1 - x0;
+        for (int y = y0; y < y1; ++y) {
+            memcpy(p->fbs[p->front] + (size_t)y * p->w + x0, src + (size_t)(y - y0) * w, (size_t)w * 2);
+        }
+        p->draws++;
+        p->px += (uint64_t)w * (uint64_t)(y1 - y0);
+    }
+    if (p->cbs.on_color_trans_done) p->cbs.on_color_trans_done(panel, NULL, p->cb_ctx);
+    return ESP_OK;
+}
+
+static uint16_t *s_frame;   // the caller's full-frame buffer
+
+static display_handle_t setup(void)
+{
+    memset(&s_panel, 0, sizeof(s_panel));
+    display_handle_t d = NULL;
+    CHECK_EQ(display_init(&d), ESP_OK);
+    CHECK_EQ(display_set_present_filter(d, TILE), ESP_OK);
+    s_frame = calloc((size_t)s_panel.w * s_panel.h, sizeof(uint16_t));
+    for (size_t i = 0; i < (size_t)s_panel.w * s_panel.h; ++i) s_frame[i] = (uint16_t)(i * 2654435761u >> 16);
+    return d;
+}
+
+static void teardown(display_handle_t d)
+{
+    CHECK_EQ(display_set_present_filter(d, 0), ESP_OK);
+    free(s_frame);
+    free(s_panel.fbs[0]);
+    free(s_panel.fbs[1]);
+    // display_panel has no deinit; the handle is left to the process.
+}
+
+static void present(display_handle_t d)
+{
+    CHECK_EQ(display_draw_bitmap(d, 0, 0, s_panel.w, s_panel.h, s_frame), ESP_OK);
+}
+
+static bool front_matches_frame(void)
+{
+    return memcmp(s_panel.fbs[s_panel.front], s_frame, (size_t)s_panel.w * s_panel.h * 2) == 0;
+}
+
+static void test_repeat_and_band(void)
+{
+    display_handle_t d = setup();
+    const uint64_t frame_px = (uint64_t)s_panel.w * s_panel.h;
+
+    present(d);                       // first frame goes out whole
+    CHECK_EQ(s_panel.px, frame_px);
+    present(d);                       // unchanged: nothing sent
+    CHECK_EQ(s_panel.px, frame_px);
+
+    s_frame[(size_t)(3 * TILE + 5) * s_panel.w + 7] ^= 0xFFFF;   // one pixel in tile row 3
+    const uint32_t draws = s_panel.draws;
+    present(d);
+    CHECK_EQ(s_panel.draws, draws + 1);
+    CHECK_EQ(s_panel.px, frame_px + (uint64_t)s_panel.w * TILE);
+    CHECK(front_matches_frame());
+
+    display_filter_stats_t st;
+    display_get_present_filter_stats(d, &st);
+    CHECK_EQ(st.frames, 3);
+    CHECK_EQ(st.skipped, 1);
+    teardown(d);
+}
+
+static void test_partial_present_invalidates(void)
+{
+    display_handle_t d = setup();
+    present(d);
+
+    // A pass-through band over tile rows 1..2; the next full frame resends just those.
+    CHECK_EQ(display_draw_bitmap(d, 0, TILE, s_panel.w, 3 * TILE, s_frame), ESP_OK);
+    const uint64_t px = s_panel.px;
+    present(d);
+    CHECK_EQ(s_panel.px, px + (uint64_t)s_panel.w * 2 * TILE);
+    CHECK(front_matches_frame());
+    teardown(d);
+}
+
+static void test_flip_invalidates(void)
+{
+    display_handle_t d = setup();
+    const uint64_t frame_px = (uint64_t)s_panel.w * s_panel.h;
+    present(d);
+    present(d);
+    CHECK_EQ(s_panel.px, frame_px);
+
+    // Render something else straight into the back buffer and flip to it.
+    uint16_t *fbs[2];
+    CHECK_EQ(display_get_frame_buffers(d, fbs), ESP_OK);
+    uint16_t *back = fbs[s_panel.front ^ 1];
+    memset(back, 0x5A, (size_t)s_panel.w * s_panel.h * 2);
+    CHECK_EQ(display_flip(d, back), ESP_OK);
+    CHECK_EQ(s_panel.flips, 1);
+    CHECK(display_front_buffer(d) == back);
+
+    // The filter's hashes describe the old front buffer: the same frame must go out whole.
+    const uint32_t draws = s_panel.draws;
+    present(d);
+    CHECK(s_panel.draws > draws);
+    CHECK_EQ(s_panel.px, 2 * frame_px);
+    CHECK(front_matches_frame());
+
+    display_filter_stats_t st;
+    display_get_present_filter_stats(d, &st);
+    CHECK_EQ(st.skipped, 1);
+    teardown(d);
+}
+
+int main(void)
+{
+    CHECK_EQ(mem_init(), ESP_OK);
+    esp_shim_log_level = ESP_LOG_WARN;
+
+    RUN_TEST(test_repeat_and_band);
+    RUN_TEST(test_partial_present_invalidates);
+    RUN_TEST(test_flip_invalidates);
+    return TEST_EXIT();
+}
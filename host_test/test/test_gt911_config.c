@@ -0,0 +1,201 @@
+/*
+ * gt911_config against a simulated GT911 register file: checksum verify,
+ * patch validation, write-if-changed and the Config_Fresh commit.
+ */
+#include "test.h"
+
+#include "touch_gt9xx/gt911_config.h"
+
+typedef struct {
+    uint8_t reg[0x10000];
+    int     writes;          // write() calls
+    int     fresh_commits;   // writes that set Config_Fresh
+    bool    fail_reads;
+} regfile_t;
+
+static esp_err_t rf_read(void *ctx, uint16_t reg, void *buf, size_t len)
+{
+    regfile_t *rf = ctx;
+    if (rf->fail_reads) return ESP_ERR_TIMEOUT;
+    memcpy(buf, &rf->reg[reg], len);
+    return ESP_OK;
+}
+
+static esp_err_t rf_write(void *ctx, uint16_t reg, const void *buf, size_t len)
+{
+    regfile_t *rf = ctx;
+    memcpy(&rf->reg[reg], buf, len);
+    ++rf->writes;
+    if (reg <= GT911_CFG_REG_FRESH && reg + len > GT911_CFG_REG_FRESH && rf->reg[GT911_CFG_REG_FRESH] == 0x01) {
+        ++rf->fresh_commits;
+    }
+    return ESP_OK;
+}
+
+static regfile_t s_rf;
+
+/* A plausible factory block: 800×1280, 5 points, 10 ms refresh, valid checksum. */
+static gt911_regio_t setup(void)
+{
+    memset(&s_rf, 0, sizeof(s_rf));
+    uint8_t *c = &s_rf.reg[GT911_CFG_REG_START];
+    for (int i = 0; i < GT911_CFG_LEN; ++i) c[i] = (uint8_t)(i * 7 + 3);
+    c[GT911_CFG_OFF_VERSION]     = 0x41;
+    c[GT911_CFG_OFF_X_MAX]       = 800 & 0xFF;
+    c[GT911_CFG_OFF_X_MAX + 1]   = 800 >> 8;
+    c[GT911_CFG_OFF_Y_MAX]       = 1280 & 0xFF;
+    c[GT911_CFG_OFF_Y_MAX + 1]   = 1280 >> 8;
+    c[GT911_CFG_OFF_TOUCH_NUM]   = 0x30 | 5;
+    c[GT911_CFG_OFF_TOUCH_LEVEL] = 80;
+    c[GT911_CFG_OFF_LEAVE_LEVEL] = 50;
+    c[GT911_CFG_OFF_REFRESH]     = 0x20 | (10 - 5);
+    gt911_config_t cfg;
+    memcpy(cfg.raw, c, GT911_CFG_LEN);
+    s_rf.reg[GT911_CFG_REG_CHECKSUM] = gt911_config_checksum(&cfg);
+    return (gt911_regio_t){ .read = rf_read, .write = rf_write, .ctx = &s_rf };
+}
+
+static void test_checksum(void)
+{
+    gt911_config_t cfg = { 0 };
+    CHECK_EQ(gt911_config_checksum(&cfg), 0);
+
+    cfg.raw[0] = 1;
+    CHECK_EQ(gt911_config_checksum(&cfg), 0xFF);
+
+    /* Block plus checksum sums to zero mod 256. */
+    for (int i = 0; i < GT911_CFG_LEN; ++i) cfg.raw[i] = (uint8_t)(i * 13 + 5);
+    uint8_t sum = gt911_config_checksum(&cfg);
+    for (int i = 0; i < GT911_CFG_LEN; ++i) sum += cfg.raw[i];
+    CHECK_EQ(sum, 0);
+}
+
+static void test_read_verifies_checksum(void)
+{
+    const gt911_regio_t io = setup();
+    gt911_config_t cfg;
+    CHECK_EQ(gt911_config_read(&io, &cfg), ESP_OK);
+    CHECK(memcmp(cfg.raw, &s_rf.reg[GT911_CFG_REG_START], GT911_CFG_LEN) == 0);
+    CHECK_EQ(gt911_config_refresh_ms(&cfg), 10);
+    CHECK_EQ(gt911_config_max_points(&cfg), 5);
+
+    s_rf.reg[GT911_CFG_REG_CHECKSUM] ^= 0x01;
+    CHECK_EQ(gt911_config_read(&io, &cfg), ESP_ERR_INVALID_CRC);
+
+    s_rf.fail_reads = true;
+    CHECK_EQ(gt911_config_read(&io, &cfg), ESP_ERR_TIMEOUT);
+    CHECK_EQ(s_rf.writes, 0);
+}
+
+static void test_patch(void)
+{
+    const gt911_regio_t io = setup();
+    gt911_config_t cfg;
+    CHECK_EQ(gt911_config_read(&io, &cfg), ESP_OK);
+    const gt911_config_t orig = cfg;
+
+    gt911_config_patch_t p = GT911_CONFIG_PATCH_KEEP();
+    CHECK_EQ(gt911_config_apply_patch(&cfg, &p), ESP_OK);
+    CHECK(memcmp(cfg.raw, orig.raw, GT911_CFG_LEN) == 0);
+
+    p.refresh_ms = 5;
+    p.max_points = 2;
+    p.touch_level = 120;
+    CHECK_EQ(gt911_config_apply_patch(&cfg, &p), ESP_OK);
+    CHECK_EQ(gt911_config_refresh_ms(&cfg), 5);
+    CHECK_EQ(gt911_config_max_points(&cfg), 2);
+    CHECK_EQ(cfg.raw[GT911_CFG_OFF_TOUCH_LEVEL], 120);
+    CHECK_EQ(cfg.raw[GT911_CFG_OFF_LEAVE_LEVEL], 50);
+    /* High nibbles are preserved. */
+    CHECK_EQ(cfg.raw[GT911_CFG_OFF_REFRESH] & 0xF0, 0x20);
+    CHECK_EQ(cfg.raw[GT911_CFG_OFF_TOUCH_NUM] & 0xF0, 0x30);
+    for (int i = 0; i < GT911_CFG_LEN; ++i) {
+        if (i == GT911_CFG_OFF_REFRESH || i == GT911_CFG_OFF_TOUCH_NUM || i == GT911_CFG_OFF_TOUCH_LEVEL) continue;
+        CHECK_EQ(cfg.raw[i], orig.raw[i]);
+    }
+
+    /* Out-of-range values are rejected without touching the block. */
+    const gt911_config_t before = cfg;
+    const gt911_config_patch_t bad[] = {
+        { .refresh_ms = 4,  .max_points = -1, .touch_level = -1, .leave_level = -1 },
+        { .refresh_ms = 21, .max_points = -1, .touch_level = -1, .leave_level = -1 },
+        { .refresh_ms = 8,  .max_points = 6,  .touch_level = -1, .leave_level = -1 },
+        { .refresh_ms = 8,  .max_points = 0,  .touch_level = -1, .leave_level = -1 },
+        { .refresh_ms = 8,  .max_points = -1, .touch_level = 256, .leave_level = -1 },
+        { .refresh_ms = 8,  .max_points = -1, .touch_level = -1, .leave_level = 0 },
+    };
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); ++i) {
+        CHECK_EQ(gt911_config_apply_patch(&cfg, &bad[i]), ESP_ERR_INVALID_ARG);
+        CHECK(memcmp(cfg.raw, before.raw, GT911_CFG_LEN) == 0);
+    }
+}
+
+static void test_write_if_changed(void)
+{
+    const gt911_regio_t io = setup();
+    gt911_config_t cfg;
+    CHECK_EQ(gt911_config_read(&io, &cfg), ESP_OK);
+
+    /* Identical block: no bus write at all. */
+    bool written = true;
+    CHECK_EQ(gt911_config_write_if_changed(&io, &cfg, &written), ESP_OK);
+    CHECK(!written);
+    CHECK_EQ(s_rf.writes, 0);
+    CHECK_EQ(s_rf.reg[GT911_CFG_REG_FRESH], 0);
+
+    /* Changed block: data, then checksum + fresh flag in one write. */
+    gt911_config_patch_t p = GT911_CONFIG_PATCH_KEEP();
+    p.refresh_ms = 5;
+    CHECK_EQ(gt911_config_apply_patch(&cfg, &p), ESP_OK);
+    CHECK_EQ(gt911_config_write_if_changed(&io, &cfg, &written), ESP_OK);
+    CHECK(written);
+    CHECK_EQ(s_rf.writes, 2);
+    CHECK_EQ(s_rf.fresh_commits, 1);
+    CHECK_EQ(s_rf.reg[GT911_CFG_REG_FRESH], 0x01);
+    CHECK(memcmp(&s_rf.reg[GT911_CFG_REG_START], cfg.raw, GT911_CFG_LEN) == 0);
+
+    /* The device now verifies and reads back the patched value. */
+    gt911_config_t back;
+    CHECK_EQ(gt911_config_read(&io, &back), ESP_OK);
+    CHECK_EQ(gt911_config_refresh_ms(&back), 5);
+
+    /* Writing the same block again is a no-op. */
+    s_rf.reg[GT911_CFG_REG_FRESH] = 0;   // the controller clears it after loading
+    CHECK_EQ(gt911_config_write_if_changed(&io, &cfg, &written), ESP_OK);
+    CHECK(!written);
+    CHECK_EQ(s_rf.writes, 2);
+    CHECK_EQ(s_rf.reg[GT911_CFG_REG_FRESH], 0);
+}
+
+static void test_corrupt_block_is_rewritten(void)
+{
+    const gt911_regio_t io = setup();
+    gt911_config_t cfg;
+    CHECK_EQ(gt911_config_read(&io, &cfg), ESP_OK);
+
+    /* Same contents but a bad stored checksum: still rewritten. */
+    s_rf.reg[GT911_CFG_REG_CHECKSUM] ^= 0x55;
+    bool written = false;
+    CHECK_EQ(gt911_config_write_if_changed(&io, &cfg, &written), ESP_OK);
+    CHECK(written);
+    CHECK_EQ(s_rf.fresh_commits, 1);
+    CHECK_EQ(s_rf.reg[GT911_CFG_REG_CHECKSUM], gt911_config_checksum(&cfg));
+
+    /* Read errors are passed through without writing. */
+    s_rf.fail_reads = true;
+    s_rf.writes = 0;
+    CHECK_EQ(gt911_config_write_if_changed(&io, &cfg, &written), ESP_ERR_TIMEOUT);
+    CHECK(!written);
+    CHECK_EQ(s_rf.writes, 0);
+}
+
+int main(void)
+{
+    esp_shim_log_level = ESP_LOG_NONE;   // mismatch/failure paths log by design
+    RUN_TEST(test_checksum);
+    RUN_TEST(test_read_verifies_checksum);
+    RUN_TEST(test_patch);
+    RUN_TEST(test_write_if_changed);
+    RUN_TEST(test_corrupt_block_is_rewritten);
+    return TEST_EXIT();
+}
@@ -0,0 +1,201 @@
+/*
+ * util/jobs on the pthreads shim: every row of a batch runs exactly once
+ * whatever the range, grain or number of concurrent callers; the stats add
+ * up; an imbalanced batch gets stolen from; a heavy body scales.
+ */
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "test.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "util/jobs.h"
+
+#define ROWS_MAX 4096
+
+typedef struct {
+    atomic_int hits[ROWS_MAX];
+    int        slow_below;   // rows < this sleep a little (imbalance)
+} cover_t;
+
+static void cover_rows(int y0, int y1, void *arg)
+{
+    cover_t *c = arg;
+    for (int y = y0; y < y1; ++y) {
+        atomic_fetch_add(&c->hits[y], 1);
+        if (y < c->slow_below) usleep(50);
+    }
+}
+
+static int check_once(cover_t *c, int y0, int y1)
+{
+    int bad = 0;
+    for (int y = 0; y < ROWS_MAX; ++y) {
+        const int want = (y >= y0 && y < y1) ? 1 : 0;
+        if (atomic_load(&c->hits[y]) != want) ++bad;
+    }
+    return bad;
+}
+
+static void test_exact_coverage(void)
+{
+    static cover_t c;
+    unsigned seed = 1;
+    for (int it = 0; it < 500; ++it) {
+        const int y0 = rand_r(&seed) % 512;
+        const int y1 = y0 + rand_r(&seed) % (ROWS_MAX - 512);
+        const int grain = (it % 3 == 0) ? 0 : 1 + rand_r(&seed) % 64;
+        memset(&c, 0, sizeof(c));
+        parallel_for_rows(y0, y1, grain, cover_rows, &c);
+        const int bad = check_once(&c, y0, y1);
+        CHECK_EQ(bad, 0);
+        if (bad) {
+            fprintf(stderr, "  range [%d,%d) grain %d\n", y0, y1, grain);
+            return;
+        }
+    }
+}
+
+static void test_empty_and_small(void)
+{
+    static cover_t c;
+    memset(&c, 0, sizeof(c));
+    parallel_for_rows(10, 10, 0, cover_rows, &c);
+    parallel_for_rows(10, 5, 0, cover_rows, &c);
+    CHECK_EQ(check_once(&c, 0, 0), 0);
+
+    jobs_stats_t a, b;
+    jobs_get_stats(&a);
+    parallel_for_rows(0, JOBS_MIN_ROWS - 1, 0, cover_rows, &c);
+    jobs_get_stats(&b);
+    CHECK_EQ(check_once(&c, 0, JOBS_MIN_ROWS - 1), 0);
+    CHECK_EQ(b.inline_calls - a.inline_calls, 1);
+    CHECK_EQ(b.batches - a.batches, 0);
+}
+
+/* Several tasks hammer parallel_for_rows at once: one batch at a time, the rest inline. */
+#define CALLERS      4
+#define CALLER_ITERS 200
+
+typedef struct {
+    cover_t           cov;
+    int               failures;
+    SemaphoreHandle_t done;
+} caller_t;
+
+static void caller_task(void *arg)
+{
+    caller_t *t = arg;
+    for (int it = 0; it < CALLER_ITERS; ++it) {
+        memset(&t->cov, 0, sizeof(t->cov));
+        parallel_for_rows(0, 1024, 0, cover_rows, &t->cov);
+        if (check_once(&t->cov, 0, 1024)) t->failures++;
+    }
+    xSemaphoreGive(t->done);
+    vTaskDelete(NULL);
+}
+
+static void test_concurrent_callers(void)
+{
+    static caller_t callers[CALLERS];
+    jobs_stats_t a, b;
+    jobs_get_stats(&a);
+    for (int i = 0; i < CALLERS; ++i) {
+        callers[i].failures = 0;
+        callers[i].done = xSemaphoreCreateBinary();
+        CHECK(xTaskCreate(caller_task, "caller", 8192, &callers[i], 5, NULL) == pdPASS);
+    }
+    for (int i = 0; i < CALLERS; ++i) {
+        CHECK(xSemaphoreTake(callers[i].done, pdMS_TO_TICKS(60000)) == pdTRUE);
+        CHECK_EQ(callers[i].failures, 0);
+        vSemaphoreDelete(callers[i].done);
+    }
+    jobs_get_stats(&b);
+    /* Every call is counted exactly once, split or inline. */
+    CHECK_EQ((b.batches - a.batches) + (b.inline_calls - a.inline_calls), CALLERS * CALLER_ITERS);
+    fprintf(stderr, "  %d calls: %u split, %u inline\n", CALLERS * CALLER_ITERS,
+            (unsigned)(b.batches - a.batches), (unsigned)(b.inline_calls - a.inline_calls));
+}
+
+/* A job calling parallel_for_rows runs the inner range inline. */
+static cover_t s_nested;
+static void nested_rows(int y0, int y1, void *arg)
+{
+    parallel_for_rows(y0, y1, 0, cover_rows, &s_nested);
+}
+
+static void test_nested_runs_inline(void)
+{
+    memset(&s_nested, 0, sizeof(s_nested));
+    parallel_for_rows(0, 2048, 0, nested_rows, NULL);
+    CHECK_EQ(check_once(&s_nested, 0, 2048), 0);
+}
+
+/* All the slow rows sit in the first core's share: the other core must steal. */
+static void test_imbalance_steals(void)
+{
+    static cover_t c;
+    memset(&c, 0, sizeof(c));
+    c.slow_below = 512;
+    jobs_stats_t a, b;
+    jobs_get_stats(&a);
+    parallel_for_rows(0, 1024, 16, cover_rows, &c);
+    jobs_get_stats(&b);
+    CHECK_EQ(check_once(&c, 0, 1024), 0);
+    CHECK_EQ(b.batches - a.batches, 1);
+    CHECK_EQ(b.chunks - a.chunks, 1024 / 16);
+    CHECK(b.steals > a.steals);
+    fprintf(stderr, "  %u of %u chunks stolen\n", (unsigned)(b.steals - a.steals),
+            (unsigned)(b.chunks - a.chunks));
+}
+
+/* Scaling: CPU-bound body, split vs inline (reported; asserted only loosely). */
+typedef struct { volatile uint32_t sink[ROWS_MAX]; } burn_t;
+
+static void burn_rows(int y0, int y1, void *arg)
+{
+    burn_t *b = arg;
+    for (int y = y0; y < y1; ++y) {
+        uint32_t v = (uint32_t)y;
+        for (int k = 0; k < 20000; ++k) v = v * 1664525u + 1013904223u;
+        b->sink[y] = v;
+    }
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void test_scaling(void)
+{
+    static burn_t b;
+    const double t0 = now_s();
+    burn_rows(0, 2048, &b);
+    const double t1 = now_s();
+    parallel_for_rows(0, 2048, 0, burn_rows, &b);
+    const double t2 = now_s();
+    const double speedup = (t1 - t0) / (t2 - t1);
+    fprintf(stderr, "  inline %.1f ms, split %.1f ms: %.2fx on %d cores (%ld host CPUs)\n",
+            (t1 - t0) * 1e3, (t2 - t1) * 1e3, speedup, portNUM_PROCESSORS,
+            sysconf(_SC_NPROCESSORS_ONLN));
+    if (sysconf(_SC_NPROCESSORS_ONLN) >= 2) CHECK(speedup > 1.2);
+}
+
+int main(void)
+{
+    CHECK(jobs_init(NULL) == ESP_OK);
+    CHECK(jobs_ready());
+    RUN_TEST(test_exact_coverage);
+    RUN_TEST(test_empty_and_small);
+    RUN_TEST(test_concurrent_callers);
+    RUN_TEST(test_nested_runs_inline);
+    RUN_TEST(test_imbalance_steals);
+    RUN_TEST(test_scaling);
+    return TEST_EXIT();
+}
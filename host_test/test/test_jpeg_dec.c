@@ -0,0 +1,340 @@
+/*
+ * image/jpeg_dec on the host: every sampling mode and scale decodes close to
+ * the synthetic source the fixtures were encoded from, reader-fed and banded
+ * decodes are bit-identical to the one-shot ones, asynchronous sinks get two
+ * alternating bands, the display sink presents a clipped band in one transfer,
+ * and unsupported or broken files fail cleanly.
+ *
+ * Fixtures: jpeg_fixtures.h, regenerated by mkjpeg_fixtures.py.
+ */
+#include <math.h>
+#include <stdlib.h>
+
+#include "test.h"
+#include "display_host.h"
+#include "image/jpeg_dec.h"
+#include "jpeg_fixtures.h"
+#include "util/mem.h"
+
+#define READ_CHUNK 7      // small and odd, so markers and stuffed bytes straddle refills
+#define MAX_BANDS  64
+
+typedef struct {
+    const char    *name;
+    const uint8_t *data;
+    size_t         len;
+    int            comps, mcu_w, mcu_h, restart;
+    double         min_db;         // PSNR floor at full scale
+    double         min_db_scaled;  // at 1/2..1/8: box-averaged reference vs scaled IDCT and
+                                   // replicated chroma, which smears the block's hard edges
+} fixture_t;
+
+static const fixture_t kFixtures[] = {
+    { "q444", k_q444_jpg, sizeof(k_q444_jpg), 3,  8,  8, 0, 37.0, 37.0 },
+    { "q422", k_q422_jpg, sizeof(k_q422_jpg), 3, 16,  8, 0, 35.0, 26.0 },
+    { "q420", k_q420_jpg, sizeof(k_q420_jpg), 3, 16, 16, 0, 33.0, 25.0 },
+    { "gray", k_gray_jpg, sizeof(k_gray_jpg), 1,  8,  8, 0, 38.0, 37.0 },
+    { "rst",  k_rst_jpg,  sizeof(k_rst_jpg),  3, 16, 16, 1, 33.0, 25.0 },
+};
+#define N_FIXTURES ((int)(sizeof(kFixtures) / sizeof(kFixtures[0])))
+
+/* Must match src_px() in mkjpeg_fixtures.py. */
+static void fixture_px(int x, int y, int rgb[3])
+{
+    if (x >= 20 && x < 44 && y >= 14 && y < 30) {
+        rgb[0] = 200, rgb[1] = 30, rgb[2] = 40;
+        return;
+    }
+    rgb[0] = x * 255 / (FIXTURE_W - 1);
+    rgb[1] = y * 255 / (FIXTURE_H - 1);
+    rgb[2] = (x + y) * 255 / (FIXTURE_W + FIXTURE_H - 2);
+}
+
+/* Box average of the source over the output pixel's 2^s × 2^s footprint (Pillow's L for gray). */
+static void reference_px(int ox, int oy, int s, bool gray, double rgb[3])
+{
+    double acc[3] = { 0 };
+    int n = 0;
+    for (int y = oy << s; y < ((oy + 1) << s) && y < FIXTURE_H; ++y) {
+        for (int x = ox << s; x < ((ox + 1) << s) && x < FIXTURE_W; ++x, ++n) {
+            int p[3];
+            fixture_px(x, y, p);
+            if (gray) p[0] = p[1] = p[2] = (p[0] * 299 + p[1] * 587 + p[2] * 114) / 1000;
+            for (int c = 0; c < 3; ++c) acc[c] += p[c];
+        }
+    }
+    for (int c = 0; c < 3; ++c) rgb[c] = acc[c] / n;
+}
+
+static double psnr565(const uint16_t *fb, int w, int h, int s, bool gray)
+{
+    double se = 0;
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+            const uint16_t p = fb[y * w + x];
+            const double got[3] = { (p >> 11) * 255.0 / 31, ((p >> 5) & 63) * 255.0 / 63, (p & 31) * 255.0 / 31 };
+            double ref[3];
+            reference_px(x, y, s, gray, ref);
+            for (int c = 0; c < 3; ++c) se += (got[c] - ref[c]) * (got[c] - ref[c]);
+        }
+    }
+    return se == 0 ? 99.0 : 10.0 * log10(255.0 * 255.0 * 3 * w * h / se);
+}
+
+typedef struct {
+    const uint8_t *p;
+    size_t         len, off;
+} reader_t;
+
+static int read_chunked(void *ctx, uint8_t *buf, size_t len)
+{
+    reader_t *r = ctx;
+    size_t k = r->len - r->off;
+    if (k > len) k = len;
+    if (k > READ_CHUNK) k = READ_CHUNK;
+    memcpy(buf, r->p + r->off, k);
+    r->off += k;
+    return (int)k;
+}
+
+/* Decode a whole fixture into a fresh framebuffer of the output size; NULL on any error. */
+static uint16_t *decode_fb(const fixture_t *f, int s, bool reader, int band_rows, ui_dither_t dither,
+                           jpeg_dec_stats_t *st)
+{
+    reader_t r = { f->data, f->len, 0 };
+    jpeg_dec_handle_t h;
+    const esp_err_t err = reader ? jpeg_dec_open(read_chunked, &r, &h) : jpeg_dec_open_mem(f->data, f->len, &h);
+    CHECK_EQ(err, ESP_OK);
+    if (err != ESP_OK) return NULL;
+
+    const int ow = (FIXTURE_W + (1 << s) - 1) >> s, oh = (FIXTURE_H + (1 << s) - 1) >> s;
+    jpeg_fb_sink_t sink = { .fb = calloc((size_t)ow * oh, sizeof(uint16_t)), .w = ow, .h = oh };
+    const jpeg_out_t out = {
+        .scale_shift = s, .dither = dither, .band_mcu_rows = band_rows, .on_band = jpeg_sink_fb, .ctx = &sink,
+    };
+    const esp_err_t run = jpeg_dec_run(h, &out, st);
+    jpeg_dec_close(h);
+    CHECK_EQ(run, ESP_OK);
+    if (run != ESP_OK) {
+        free(sink.fb);
+        return NULL;
+    }
+    CHECK_EQ(st->out_w, ow);
+    CHECK_EQ(st->out_h, oh);
+    return sink.fb;
+}
+
+static void test_info(void)
+{
+    for (int i = 0; i < N_FIXTURES; ++i) {
+        const fixture_t *f = &kFixtures[i];
+        jpeg_dec_handle_t h;
+        CHECK_EQ(jpeg_dec_open_mem(f->data, f->len, &h), ESP_OK);
+        jpeg_info_t in;
+        jpeg_dec_get_info(h, &in);
+        jpeg_dec_close(h);
+        CHECK_EQ(in.width, FIXTURE_W);
+        CHECK_EQ(in.height, FIXTURE_H);
+        CHECK_EQ(in.components, f->comps);
+        CHECK_EQ(in.mcu_w, f->mcu_w);
+        CHECK_EQ(in.mcu_h, f->mcu_h);
+        CHECK_EQ(in.restart_interval != 0, f->restart != 0);
+    }
+
+    const jpeg_info_t big = { .width = 1000, .height = 750 };
+    CHECK_EQ(jpeg_dec_fit_shift(&big, 1000, 750), 0);
+    CHECK_EQ(jpeg_dec_fit_shift(&big, 800, 1280), 1);
+    CHECK_EQ(jpeg_dec_fit_shift(&big, 125, 94), 3);
+    CHECK_EQ(jpeg_dec_fit_shift(&big, 10, 10), 3);
+}
+
+static void test_matches_source(void)
+{
+    for (int i = 0; i < N_FIXTURES; ++i) {
+        const fixture_t *f = &kFixtures[i];
+        for (int s = 0; s <= 3; ++s) {
+            jpeg_dec_stats_t st;
+            uint16_t *fb = decode_fb(f, s, false, 1, UI_DITHER_NONE, &st);
+            if (!fb) continue;
+            const double db = psnr565(fb, st.out_w, st.out_h, s, f->comps == 1);
+            const double floor = s ? f->min_db_scaled : f->min_db;
+            if (db < floor) fprintf(stderr, "  %s 1/%d: %.1f dB < %.1f\n", f->name, 1 << s, db, floor);
+            CHECK(db >= floor);
+            CHECK_EQ(st.bands, (FIXTURE_H + f->mcu_h - 1) / f->mcu_h);
+            free(fb);
+        }
+    }
+}
+
+static void test_reader_and_bands_identical(void)
+{
+    for (int i = 0; i < N_FIXTURES; ++i) {
+        const fixture_t *f = &kFixtures[i];
+        for (int s = 0; s <= 3; s += 3) {
+            jpeg_dec_stats_t a, b, c;
+            uint16_t *one  = decode_fb(f, s, false, 1, UI_DITHER_BAYER8, &a);
+            uint16_t *rd   = decode_fb(f, s, true, 1, UI_DITHER_BAYER8, &b);
+            uint16_t *wide = decode_fb(f, s, false, 3, UI_DITHER_BAYER8, &c);
+            const size_t bytes = (size_t)a.out_w * a.out_h * sizeof(uint16_t);
+            CHECK(one && rd && memcmp(one, rd, bytes) == 0);
+            CHECK(one && wide && memcmp(one, wide, bytes) == 0);
+            CHECK_EQ(b.peak_bytes, a.peak_bytes + JPEG_DEC_IN_BUF);
+            CHECK_EQ(c.bands, (a.bands + 2) / 3);
+            free(one);
+            free(rd);
+            free(wide);
+        }
+    }
+}
+
+typedef struct {
+    const uint16_t *px[MAX_BANDS];
+    int             bands, idles;
+} record_t;
+
+static esp_err_t record_band(void *ctx, int x, int y, int w, int h, uint16_t *px)
+{
+    record_t *r = ctx;
+    if (r->bands < MAX_BANDS) r->px[r->bands] = px;
+    r->bands++;
+    return ESP_OK;
+}
+
+static esp_err_t record_idle(void *ctx)
+{
+    ((record_t *)ctx)->idles++;
+    return ESP_OK;
+}
+
+static void test_async_sink_double_buffered(void)
+{
+    const fixture_t *f = &kFixtures[2];   // q420: four bands
+    jpeg_dec_handle_t h;
+    jpeg_dec_stats_t sync_st, async_st;
+
+    record_t sync = { 0 };
+    CHECK_EQ(jpeg_dec_open_mem(f->data, f->len, &h), ESP_OK);
+    CHECK_EQ(jpeg_dec_run(h, &(jpeg_out_t){ .on_band = record_band, .ctx = &sync }, &sync_st), ESP_OK);
+    jpeg_dec_close(h);
+    CHECK(sync.bands >= 3);
+    for (int i = 1; i < sync.bands; ++i) CHECK(sync.px[i] == sync.px[0]);
+
+    // With on_idle the band just handed over is never the next one decoded into.
+    record_t async = { 0 };
+    CHECK_EQ(jpeg_dec_open_mem(f->data, f->len, &h), ESP_OK);
+    const jpeg_out_t out = { .on_band = record_band, .on_idle = record_idle, .ctx = &async };
+    CHECK_EQ(jpeg_dec_run(h, &out, &async_st), ESP_OK);
+    jpeg_dec_close(h);
+    CHECK_EQ(async.bands, sync.bands);
+    CHECK_EQ(async.idles, 1);
+    for (int i = 1; i < async.bands; ++i) CHECK(async.px[i] != async.px[i - 1]);
+    for (int i = 2; i < async.bands; ++i) CHECK(async.px[i] == async.px[i - 2]);
+    CHECK_EQ(async_st.peak_bytes - sync_st.peak_bytes, (size_t)FIXTURE_W * f->mcu_h * sizeof(uint16_t));
+}
+
+static void test_display_sink_clipped(void)
+{
+    // Panel smaller than the image, image offset up and left: every band is clipped on both sides.
+    enum { PW = 50, PH = 40, OX = -10, OY = -7 };
+    const fixture_t *f = &kFixtures[2];
+    display_handle_t d;
+    CHECK_EQ(display_host_init(PW, PH, &d), ESP_OK);
+
+    jpeg_dec_handle_t h;
+    jpeg_dec_stats_t st;
+    CHECK_EQ(jpeg_dec_open_mem(f->data, f->len, &h), ESP_OK);
+    const jpeg_out_t out = {
+        .dither = UI_DITHER_BAYER8, .x = OX, .y = OY,
+        .on_band = jpeg_sink_display, .on_idle = jpeg_sink_display_idle, .ctx = d,
+    };
+    CHECK_EQ(jpeg_dec_run(h, &out, &st), ESP_OK);
+    jpeg_dec_close(h);
+
+    int visible = 0;
+    for (int y = OY; y < OY + FIXTURE_H; y += f->mcu_h) visible += y < PH && y + f->mcu_h > 0;
+    display_host_stats_t ds;
+    display_host_get_stats(d, &ds);
+    CHECK_EQ(ds.presents, visible);   // one transfer per visible band, not one per row
+    CHECK_EQ(ds.px, (uint64_t)PW * PH);
+
+    // Same pixels as the framebuffer sink at the same origin (same dither phase).
+    uint16_t *fb = calloc((size_t)PW * PH, sizeof(uint16_t));
+    jpeg_fb_sink_t sink = { .fb = fb, .w = PW, .h = PH };
+    CHECK_EQ(jpeg_dec_open_mem(f->data, f->len, &h), ESP_OK);
+    const jpeg_out_t to_fb = { .dither = UI_DITHER_BAYER8, .x = OX, .y = OY, .on_band = jpeg_sink_fb, .ctx = &sink };
+    CHECK_EQ(jpeg_dec_run(h, &to_fb, NULL), ESP_OK);
+    jpeg_dec_close(h);
+    CHECK(memcmp(display_host_pixels(d), fb, (size_t)PW * PH * sizeof(uint16_t)) == 0);
+
+    free(fb);
+    display_host_deinit(d);
+}
+
+static void test_rejects(void)
+{
+    esp_shim_log_level = ESP_LOG_NONE;
+    jpeg_dec_handle_t h;
+    CHECK_EQ(jpeg_dec_open_mem(k_prog_jpg, sizeof(k_prog_jpg), &h), ESP_ERR_NOT_SUPPORTED);
+    CHECK(jpeg_dec_open_mem(k_q420_jpg, 100, &h) != ESP_OK);   // cut inside the headers
+
+    // Cut inside the scan: decodes as if EOI came early, without reading past the
+    // end. What was there is intact; the rest is filled.
+    static uint16_t fb[FIXTURE_W * FIXTURE_H], full[FIXTURE_W * FIXTURE_H];
+    jpeg_fb_sink_t sink = { .fb = full, .w = FIXTURE_W, .h = FIXTURE_H };
+    jpeg_out_t out = { .on_band = jpeg_sink_fb, .ctx = &sink };
+    CHECK_EQ(jpeg_dec_open_mem(k_q420_jpg, sizeof(k_q420_jpg), &h), ESP_OK);
+    CHECK_EQ(jpeg_dec_run(h, &out, NULL), ESP_OK);
+    jpeg_dec_close(h);
+    sink.fb = fb;
+    CHECK_EQ(jpeg_dec_open_mem(k_q420_jpg, sizeof(k_q420_jpg) * 2 / 3, &h), ESP_OK);
+    CHECK_EQ(jpeg_dec_run(h, &out, NULL), ESP_OK);
+    jpeg_dec_close(h);
+    CHECK(memcmp(fb, full, sizeof(uint16_t) * FIXTURE_W * 16) == 0);   // first MCU row
+    CHECK(memcmp(fb, full, sizeof(fb)) != 0);
+
+    // A marker other than RSTn where a restart is due fails the decode.
+    uint8_t bad[sizeof(k_rst_jpg)];
+    memcpy(bad, k_rst_jpg, sizeof(bad));
+    int rst = 0;
+    for (size_t i = 2; i + 1 < sizeof(bad); ++i) {
+        if (bad[i] == 0xFF && bad[i + 1] >= 0xD0 && bad[i + 1] <= 0xD7 && ++rst == 2) bad[i + 1] = 0xD9;
+    }
+    CHECK(rst > 2);
+    CHECK_EQ(jpeg_dec_open_mem(bad, sizeof(bad), &h), ESP_OK);
+    CHECK_EQ(jpeg_dec_run(h, &out, NULL), ESP_ERR_INVALID_RESPONSE);
+    jpeg_dec_close(h);
+
+    // A handle decodes once; bad args touch nothing.
+    CHECK_EQ(jpeg_dec_open_mem(k_gray_jpg, sizeof(k_gray_jpg), &h), ESP_OK);
+    CHECK_EQ(jpeg_dec_run(h, &out, NULL), ESP_OK);
+    CHECK_EQ(jpeg_dec_run(h, &out, NULL), ESP_ERR_INVALID_STATE);
+    const jpeg_out_t scaled = { .scale_shift = 4, .on_band = jpeg_sink_fb, .ctx = &sink };
+    CHECK_EQ(jpeg_dec_run(h, &scaled, NULL), ESP_ERR_INVALID_ARG);
+    jpeg_dec_close(h);
+    CHECK_EQ(jpeg_dec_open_mem(NULL, 10, &h), ESP_ERR_INVALID_ARG);
+    esp_shim_log_level = ESP_LOG_WARN;
+}
+
+static void test_no_leaks(void)
+{
+    mem_stats_t st;
+    for (int k = 0; k < MEM_CLASS_COUNT; ++k) {
+        mem_get_stats(MEM_TAG_IMAGE, (mem_class_t)k, &st);
+        CHECK_EQ(st.live_bytes, 0);
+    }
+}
+
+int main(void)
+{
+    CHECK_EQ(mem_init(), ESP_OK);
+    esp_shim_log_level = ESP_LOG_WARN;   // every decode logs its timing at INFO
+
+    RUN_TEST(test_info);
+    RUN_TEST(test_matches_source);
+    RUN_TEST(test_reader_and_bands_identical);
+    RUN_TEST(test_async_sink_double_buffered);
+    RUN_TEST(test_display_sink_clipped);
+    RUN_TEST(test_rejects);
+    RUN_TEST(test_no_leaks);
+    return TEST_EXIT();
+}
@@ -0,0 +1,206 @@
+/*
+ * util/mem on the shim heap: allocations and frees land in the class the
+ * block actually went to, peaks stick, failures are counted against the caps
+ * asked for (only the last fallback's for mem_alloc_prefer), try-allocs stay
+ * silent and bad tags touch nothing. Each test uses its own tag and compares
+ * against a snapshot, so the order doesn't matter.
+ */
+#include <stdint.h>
+
+#include "test.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "util/mem.h"
+
+typedef struct {
+    mem_stats_t c[MEM_CLASS_COUNT];
+} snap_t;
+
+static snap_t snap(mem_tag_t tag)
+{
+    snap_t s;
+    for (int k = 0; k < MEM_CLASS_COUNT; ++k) mem_get_stats(tag, (mem_class_t)k, &s.c[k]);
+    return s;
+}
+
+/* Expect only `cls` (and DMA when dma) of `tag` to have moved by the given deltas. */
+static void check_delta(const snap_t *before, mem_tag_t tag, mem_class_t cls, bool dma,
+                        long long live, uint32_t allocs, uint32_t frees, uint32_t failures)
+{
+    const snap_t now = snap(tag);
+    for (int k = 0; k < MEM_CLASS_COUNT; ++k) {
+        const bool hit = k == (int)cls || (dma && k == MEM_CLASS_DMA);
+        CHECK_EQ((long long)now.c[k].live_bytes - (long long)before->c[k].live_bytes, hit ? live : 0);
+        CHECK_EQ(now.c[k].allocs - before->c[k].allocs, hit ? allocs : 0);
+        CHECK_EQ(now.c[k].frees - before->c[k].frees, hit ? frees : 0);
+        CHECK_EQ(now.c[k].failures - before->c[k].failures, hit ? failures : 0);
+    }
+}
+
+static void test_internal_alloc_free(void)
+{
+    const snap_t s0 = snap(MEM_TAG_DISPLAY);
+    void *p = mem_malloc(MEM_TAG_DISPLAY, 1000, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+    CHECK(p != NULL);
+    CHECK(!esp_ptr_external_ram(p));
+    check_delta(&s0, MEM_TAG_DISPLAY, MEM_CLASS_INTERNAL, true, 1000, 1, 0, 0);
+
+    mem_free(MEM_TAG_DISPLAY, p);
+    check_delta(&s0, MEM_TAG_DISPLAY, MEM_CLASS_INTERNAL, true, 0, 1, 1, 0);
+    CHECK_EQ(snap(MEM_TAG_DISPLAY).c[MEM_CLASS_INTERNAL].peak_bytes,
+             s0.c[MEM_CLASS_INTERNAL].live_bytes + 1000);
+}
+
+static void test_classed_by_landing(void)
+{
+    // DEFAULT goes by size on the shim (and on target with SPIRAM_MALLOC_ALWAYSINTERNAL).
+    snap_t s0 = snap(MEM_TAG_TOUCH);
+    void *small = mem_malloc(MEM_TAG_TOUCH, 256, MALLOC_CAP_DEFAULT);
+    check_delta(&s0, MEM_TAG_TOUCH, MEM_CLASS_INTERNAL, true, 256, 1, 0, 0);
+    mem_free(MEM_TAG_TOUCH, small);
+
+    s0 = snap(MEM_TAG_TOUCH);
+    void *big = mem_malloc(MEM_TAG_TOUCH, 64 * 1024, MALLOC_CAP_DEFAULT);
+    CHECK(esp_ptr_external_ram(big));
+    check_delta(&s0, MEM_TAG_TOUCH, MEM_CLASS_SPIRAM, true, 64 * 1024, 1, 0, 0);
+    mem_free(MEM_TAG_TOUCH, big);
+    check_delta(&s0, MEM_TAG_TOUCH, MEM_CLASS_SPIRAM, true, 0, 1, 1, 0);
+}
+
+static void test_peak(void)
+{
+    const snap_t s0 = snap(MEM_TAG_DEMOS);
+    const size_t base = s0.c[MEM_CLASS_SPIRAM].live_bytes;
+    void *a = mem_malloc(MEM_TAG_DEMOS, 3000, MALLOC_CAP_SPIRAM);
+    void *b = mem_malloc(MEM_TAG_DEMOS, 5000, MALLOC_CAP_SPIRAM);
+    mem_free(MEM_TAG_DEMOS, a);
+    void *c = mem_malloc(MEM_TAG_DEMOS, 1000, MALLOC_CAP_SPIRAM);
+
+    mem_stats_t st;
+    mem_get_stats(MEM_TAG_DEMOS, MEM_CLASS_SPIRAM, &st);
+    CHECK_EQ(st.live_bytes, base + 6000);
+    CHECK_EQ(st.peak_bytes, base + 8000);
+
+    mem_free(MEM_TAG_DEMOS, b);
+    mem_free(MEM_TAG_DEMOS, c);
+    mem_get_stats(MEM_TAG_DEMOS, MEM_CLASS_SPIRAM, &st);
+    CHECK_EQ(st.live_bytes, base);
+    CHECK_EQ(st.peak_bytes, base + 8000);
+}
+
+static void test_calloc_aligned(void)
+{
+    const snap_t s0 = snap(MEM_TAG_UI_GFX);
+    uint8_t *z = mem_calloc(MEM_TAG_UI_GFX, 10, 100, MALLOC_CAP_INTERNAL);
+    CHECK(z != NULL);
+    int nonzero = 0;
+    for (int i = 0; z && i < 1000; ++i) nonzero += z[i] != 0;
+    CHECK_EQ(nonzero, 0);
+
+    void *a = mem_aligned_alloc(MEM_TAG_UI_GFX, 256, 500, MALLOC_CAP_INTERNAL);
+    CHECK(a != NULL && ((uintptr_t)a & 255) == 0);
+    check_delta(&s0, MEM_TAG_UI_GFX, MEM_CLASS_INTERNAL, true, 1500, 2, 0, 0);
+
+    mem_free(MEM_TAG_UI_GFX, z);
+    mem_free(MEM_TAG_UI_GFX, a);
+    check_delta(&s0, MEM_TAG_UI_GFX, MEM_CLASS_INTERNAL, true, 0, 2, 2, 0);
+}
+
+static void test_failure_counted(void)
+{
+    snap_t s0 = snap(MEM_TAG_IMAGE);
+    esp_shim_heap_fail_next(0, 1);
+    CHECK(mem_malloc(MEM_TAG_IMAGE, 4096, MALLOC_CAP_SPIRAM) == NULL);
+    check_delta(&s0, MEM_TAG_IMAGE, MEM_CLASS_SPIRAM, false, 0, 0, 0, 1);
+
+    // DMA requests also count against the DMA class.
+    s0 = snap(MEM_TAG_IMAGE);
+    esp_shim_heap_fail_next(0, 1);
+    CHECK(mem_calloc(MEM_TAG_IMAGE, 4, 64, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA) == NULL);
+    check_delta(&s0, MEM_TAG_IMAGE, MEM_CLASS_INTERNAL, true, 0, 0, 0, 1);
+
+    // A request bigger than the pool fails without any injection.
+    s0 = snap(MEM_TAG_IMAGE);
+    CHECK(mem_malloc(MEM_TAG_IMAGE, ESP_SHIM_HEAP_INTERNAL_BYTES + 1, MALLOC_CAP_INTERNAL) == NULL);
+    check_delta(&s0, MEM_TAG_IMAGE, MEM_CLASS_INTERNAL, false, 0, 0, 0, 1);
+}
+
+static void test_try_malloc_silent(void)
+{
+    const snap_t s0 = snap(MEM_TAG_LVGL);
+    esp_shim_heap_fail_next(0, 1);
+    CHECK(mem_try_malloc(MEM_TAG_LVGL, 128, MALLOC_CAP_INTERNAL) == NULL);
+    check_delta(&s0, MEM_TAG_LVGL, MEM_CLASS_INTERNAL, true, 0, 0, 0, 0);
+
+    void *p = mem_try_malloc(MEM_TAG_LVGL, 128, MALLOC_CAP_INTERNAL);
+    CHECK(p != NULL);
+    check_delta(&s0, MEM_TAG_LVGL, MEM_CLASS_INTERNAL, true, 128, 1, 0, 0);
+    mem_free(MEM_TAG_LVGL, p);
+}
+
+static void test_prefer_fallback(void)
+{
+    static const uint32_t kCaps[] = { MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA, MALLOC_CAP_SPIRAM };
+
+    // First choice misses: lands in PSRAM, no failure.
+    snap_t s0 = snap(MEM_TAG_UTIL);
+    esp_shim_heap_fail_next(MALLOC_CAP_INTERNAL, 1);
+    void *p = mem_alloc_prefer(MEM_TAG_UTIL, 0, 2048, kCaps, 2);
+    CHECK(p != NULL && esp_ptr_external_ram(p));
+    check_delta(&s0, MEM_TAG_UTIL, MEM_CLASS_SPIRAM, true, 2048, 1, 0, 0);
+    mem_free(MEM_TAG_UTIL, p);
+
+    // Both miss: one failure, against the last caps (PSRAM, not DMA).
+    s0 = snap(MEM_TAG_UTIL);
+    esp_shim_heap_fail_next(0, 2);
+    CHECK(mem_alloc_prefer(MEM_TAG_UTIL, 64, 2048, kCaps, 2) == NULL);
+    check_delta(&s0, MEM_TAG_UTIL, MEM_CLASS_SPIRAM, false, 0, 0, 0, 1);
+
+    // Aligned path through the first choice.
+    s0 = snap(MEM_TAG_UTIL);
+    p = mem_alloc_prefer(MEM_TAG_UTIL, 128, 300, kCaps, 2);
+    CHECK(p != NULL && ((uintptr_t)p & 127) == 0 && !esp_ptr_external_ram(p));
+    check_delta(&s0, MEM_TAG_UTIL, MEM_CLASS_INTERNAL, true, 300, 1, 0, 0);
+    mem_free(MEM_TAG_UTIL, p);
+
+    CHECK(mem_alloc_prefer(MEM_TAG_UTIL, 0, 16, kCaps, 0) == NULL);
+    CHECK(mem_alloc_prefer(MEM_TAG_UTIL, 0, 16, NULL, 2) == NULL);
+}
+
+static void test_bad_tag(void)
+{
+    CHECK(mem_malloc(MEM_TAG_COUNT, 16, MALLOC_CAP_INTERNAL) == NULL);
+    CHECK(mem_calloc((mem_tag_t)-1, 1, 16, MALLOC_CAP_INTERNAL) == NULL);
+    CHECK(mem_try_malloc(MEM_TAG_COUNT, 16, MALLOC_CAP_INTERNAL) == NULL);
+
+    const size_t free0 = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    void *raw = heap_caps_malloc(64, MALLOC_CAP_INTERNAL);
+    mem_free(MEM_TAG_COUNT, raw);   // freed, not accounted anywhere
+    CHECK_EQ(heap_caps_get_free_size(MALLOC_CAP_INTERNAL), free0);
+    mem_free(MEM_TAG_MAIN, NULL);
+
+    mem_stats_t st = { .allocs = 7 };
+    mem_get_stats(MEM_TAG_COUNT, MEM_CLASS_INTERNAL, &st);
+    CHECK_EQ(st.allocs, 0);
+    mem_get_stats(MEM_TAG_MAIN, MEM_CLASS_COUNT, &st);
+    CHECK_EQ(st.live_bytes, 0);
+    CHECK(strcmp(mem_tag_name(MEM_TAG_COUNT), "?") == 0);
+    CHECK(strcmp(mem_tag_name(MEM_TAG_IMAGE), "image") == 0);
+}
+
+int main(void)
+{
+    CHECK_EQ(mem_init(), ESP_OK);
+    CHECK_EQ(mem_init(), ESP_OK);   // idempotent
+    esp_shim_log_level = ESP_LOG_NONE;   // failures dump the table on purpose
+
+    RUN_TEST(test_internal_alloc_free);
+    RUN_TEST(test_classed_by_landing);
+    RUN_TEST(test_peak);
+    RUN_TEST(test_calloc_aligned);
+    RUN_TEST(test_failure_counted);
+    RUN_TEST(test_try_malloc_silent);
+    RUN_TEST(test_prefer_fallback);
+    RUN_TEST(test_bad_tag);
+    return TEST_EXIT();
+}
@@ -0,0 +1,234 @@
+/*
+ * image/slideshow on the pthreads shim, from both sources: a PHOT partition
+ * and a directory of JPEGs. Photos come up in order (name order for a
+ * directory), each present shows exactly that photo decoded and centred,
+ * broken files are skipped and counted, and bad sources fail at open.
+ */
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "test.h"
+#include "display_host.h"
+#include "esp_partition.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "image/jpeg_dec.h"
+#include "image/slideshow.h"
+#include "jpeg_fixtures.h"
+#include "phot_blob.h"
+#include "ui_gfx/ui_kernels.h"
+#include "util/mem.h"
+#include "util/timing.h"
+
+#define PANEL_W     120
+#define PANEL_H     96
+#define SHOW_LAPS   2
+#define WAIT_US     (5 * 1000 * 1000)
+
+typedef struct {
+    const uint8_t *data;
+    size_t         len;
+} photo_t;
+
+#define PHOTO(name) { name, sizeof(name) }
+static const photo_t kPhotos[] = { PHOTO(k_q444_jpg), PHOTO(k_q420_jpg), PHOTO(k_gray_jpg) };
+#define N_PHOTOS ((int)(sizeof(kPhotos) / sizeof(kPhotos[0])))
+
+static char s_dir[64];
+
+/* What the slideshow should put on the panel for a photo: letterboxed, centred, same dither. */
+static void expected_frame(const photo_t *p, const slideshow_cfg_t *cfg, uint16_t *frame)
+{
+    ui_clear565(frame, PANEL_W, PANEL_H, cfg->background);
+    jpeg_dec_handle_t j;
+    CHECK_EQ(jpeg_dec_open_mem(p->data, p->len, &j), ESP_OK);
+    jpeg_fb_sink_t sink = { .fb = frame, .w = PANEL_W, .h = PANEL_H };
+    const jpeg_out_t out = {
+        .dither = cfg->dither, .x = (PANEL_W - FIXTURE_W) / 2, .y = (PANEL_H - FIXTURE_H) / 2,
+        .on_band = jpeg_sink_fb, .ctx = &sink,
+    };
+    CHECK_EQ(jpeg_dec_run(j, &out, NULL), ESP_OK);
+    jpeg_dec_close(j);
+}
+
+/*
+ * Poll until `shows` presents (or the deadline); after each one check the
+ * panel against order[(shown - 1) % n]. Returns the presents seen.
+ */
+static uint32_t show(slideshow_handle_t ss, display_handle_t d, const slideshow_cfg_t *cfg,
+                     const photo_t *const *order, int n, uint32_t shows)
+{
+    uint16_t *want = malloc((size_t)PANEL_W * PANEL_H * sizeof(uint16_t));
+    const uint64_t deadline = timing_now_us() + WAIT_US;
+    slideshow_stats_t st = { 0 };
+    while (st.shown < shows && timing_now_us() < deadline) {
+        if (!slideshow_poll(ss, timing_now_us())) {
+            vTaskDelay(1);
+            continue;
+        }
+        slideshow_get_stats(ss, &st);
+        expected_frame(order[(st.shown - 1) % n], cfg, want);
+        CHECK(memcmp(display_host_pixels(d), want, (size_t)PANEL_W * PANEL_H * sizeof(uint16_t)) == 0);
+    }
+    free(want);
+    return st.shown;
+}
+
+static void test_partition(void)
+{
+    const uint8_t *files[N_PHOTOS];
+    size_t sizes[N_PHOTOS], len;
+    for (int i = 0; i < N_PHOTOS; ++i) files[i] = kPhotos[i].data, sizes[i] = kPhotos[i].len;
+    uint8_t *blob = phot_blob(files, sizes, N_PHOTOS, &len);
+    esp_shim_partition_clear();
+    CHECK_EQ(esp_shim_partition_add("photos", blob, len), ESP_OK);
+
+    display_handle_t d;
+    CHECK_EQ(display_host_init(PANEL_W, PANEL_H, &d), ESP_OK);
+    slideshow_cfg_t cfg = SLIDESHOW_CFG_DEFAULT();
+    cfg.dwell_ms = 0;
+    slideshow_handle_t ss;
+    CHECK_EQ(slideshow_open(&cfg, d, &ss), ESP_OK);
+
+    const photo_t *order[N_PHOTOS] = { &kPhotos[0], &kPhotos[1], &kPhotos[2] };
+    CHECK_EQ(show(ss, d, &cfg, order, N_PHOTOS, SHOW_LAPS * N_PHOTOS), SHOW_LAPS * N_PHOTOS);
+
+    slideshow_stats_t st;
+    slideshow_get_stats(ss, &st);
+    CHECK_EQ(st.photos, N_PHOTOS);
+    CHECK_EQ(st.errors, 0);
+    display_host_stats_t ds;
+    display_host_get_stats(d, &ds);
+    CHECK_EQ(ds.presents, st.shown);
+
+    slideshow_close(ss);
+    display_host_deinit(d);
+    esp_shim_partition_clear();
+    free(blob);
+}
+
+static void put_file(const char *name, const void *data, size_t len)
+{
+    char path[128];
+    snprintf(path, sizeof(path), "%s/%s", s_dir, name);
+    FILE *f = fopen(path, "wb");
+    CHECK(f != NULL);
+    if (!f) return;
+    if (len) CHECK_EQ(fwrite(data, 1, len, f), len);
+    fclose(f);
+}
+
+static void rm_file(const char *name)
+{
+    char path[128];
+    snprintf(path, sizeof(path), "%s/%s", s_dir, name);
+    (void)remove(path);
+}
+
+static void test_directory(void)
+{
+    // Listed out of order, mixed-case extensions, plus things that aren't photos.
+    put_file("b_420.jpg", k_q420_jpg, sizeof(k_q420_jpg));
+    put_file("c_gray.jpeg", k_gray_jpg, sizeof(k_gray_jpg));
+    put_file("a_444.JPG", k_q444_jpg, sizeof(k_q444_jpg));
+    put_file("notes.txt", "x", 1);
+    put_file("empty.jpg", NULL, 0);
+    char sub[96];
+    snprintf(sub, sizeof(sub), "%s/dir.jpg", s_dir);
+    CHECK_EQ(mkdir(sub, 0700), 0);
+
+    display_handle_t d;
+    CHECK_EQ(display_host_init(PANEL_W, PANEL_H, &d), ESP_OK);
+    slideshow_cfg_t cfg = SLIDESHOW_CFG_DEFAULT();
+    cfg.dir      = s_dir;
+    cfg.dwell_ms = 0;
+    cfg.dither   = UI_DITHER_BAYER4;
+    slideshow_handle_t ss;
+    CHECK_EQ(slideshow_open(&cfg, d, &ss), ESP_OK);
+
+    const photo_t *order[N_PHOTOS] = { &kPhotos[0], &kPhotos[1], &kPhotos[2] };   // a, b, c
+    CHECK_EQ(show(ss, d, &cfg, order, N_PHOTOS, SHOW_LAPS * N_PHOTOS), SHOW_LAPS * N_PHOTOS);
+    slideshow_stats_t st;
+    slideshow_get_stats(ss, &st);
+    CHECK_EQ(st.photos, N_PHOTOS);
+    CHECK_EQ(st.errors, 0);
+    CHECK(st.read_max_us > 0 && st.decode_max_us > 0);
+    slideshow_close(ss);
+
+    // A corrupt file and one deleted after open are skipped; the rest still cycle.
+    static uint8_t junk[512];
+    memset(junk, 0x5A, sizeof(junk));
+    put_file("b_420.jpg", junk, sizeof(junk));
+    put_file("d_gone.jpg", k_q444_jpg, sizeof(k_q444_jpg));
+    CHECK_EQ(slideshow_open(&cfg, d, &ss), ESP_OK);
+    rm_file("d_gone.jpg");
+    const photo_t *left[2] = { &kPhotos[0], &kPhotos[2] };
+    esp_shim_log_level = ESP_LOG_NONE;
+    CHECK_EQ(show(ss, d, &cfg, left, 2, 2 * SHOW_LAPS), 2 * SHOW_LAPS);
+    esp_shim_log_level = ESP_LOG_WARN;
+    slideshow_get_stats(ss, &st);
+    CHECK_EQ(st.photos, 4);
+    CHECK(st.errors >= 2 * (SHOW_LAPS - 1));
+    slideshow_close(ss);
+
+    display_host_deinit(d);
+    rmdir(sub);
+    static const char *const kLeft[] = { "a_444.JPG", "b_420.jpg", "c_gray.jpeg", "notes.txt", "empty.jpg" };
+    for (size_t i = 0; i < sizeof(kLeft) / sizeof(kLeft[0]); ++i) rm_file(kLeft[i]);
+}
+
+static void test_open_errors(void)
+{
+    display_handle_t d;
+    CHECK_EQ(display_host_init(PANEL_W, PANEL_H, &d), ESP_OK);
+    slideshow_cfg_t cfg = SLIDESHOW_CFG_DEFAULT();
+    slideshow_handle_t ss = NULL;
+    esp_shim_log_level = ESP_LOG_NONE;
+
+    esp_shim_partition_clear();
+    CHECK_EQ(slideshow_open(&cfg, d, &ss), ESP_ERR_NOT_FOUND);
+    static const uint8_t bad_magic[16] = "PHOX\x01\x00\x01\x00";
+    CHECK_EQ(esp_shim_partition_add("photos", bad_magic, sizeof(bad_magic)), ESP_OK);
+    CHECK_EQ(slideshow_open(&cfg, d, &ss), ESP_ERR_INVALID_RESPONSE);
+    esp_shim_partition_clear();
+
+    cfg.dir = "/nonexistent/photos";
+    CHECK_EQ(slideshow_open(&cfg, d, &ss), ESP_ERR_NOT_FOUND);
+    cfg.dir = s_dir;   // empty by now
+    CHECK_EQ(slideshow_open(&cfg, d, &ss), ESP_ERR_INVALID_SIZE);
+    cfg.dir = NULL;
+    cfg.partition = NULL;
+    CHECK_EQ(slideshow_open(&cfg, d, &ss), ESP_ERR_INVALID_ARG);
+    CHECK(ss == NULL);
+
+    esp_shim_log_level = ESP_LOG_WARN;
+    display_host_deinit(d);
+}
+
+static void test_no_leaks(void)
+{
+    mem_stats_t st;
+    for (int k = 0; k < MEM_CLASS_COUNT; ++k) {
+        mem_get_stats(MEM_TAG_IMAGE, (mem_class_t)k, &st);
+        CHECK_EQ(st.live_bytes, 0);
+    }
+}
+
+int main(void)
+{
+    CHECK_EQ(mem_init(), ESP_OK);
+    esp_shim_log_level = ESP_LOG_WARN;   // every decode logs its timing at INFO
+    snprintf(s_dir, sizeof(s_dir), "/tmp/test_slideshow.XXXXXX");
+    if (!mkdtemp(s_dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+
+    RUN_TEST(test_partition);
+    RUN_TEST(test_directory);
+    RUN_TEST(test_open_errors);
+    RUN_TEST(test_no_leaks);
+    rmdir(s_dir);
+    return TEST_EXIT();
+}
@@ -1,5 +1,5 @@
 // ESP32-P4 Nano + Waveshare 10.1" DSI: bring-up, framebuffer, touch menu, demo fallback.
-// Keep app_main linear; push details into board/display/touch modules.
+// Bring-up is a small stage graph (see kBootStages); keep stages thin and push details into modules.
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -12,55 +12,245 @@
 #include "power_ldo/power_ldo.h"
 #include "display_panel/display.h"
 #include "touch_gt9xx/touch_gt9xx.h"
+#include "ui_gfx/ui_draw.h"
 #include "ui_menu/menu.h"
+#include "ui_menu/menu_bench.h"
 #include "demos/demos.h"
+#include "demos/demo_bench.h"
 #include "util/fb.h"
+#include "util/jobs.h"
+#include "util/mem.h"
+#include "util/arena.h"
+#include "util/boot_graph.h"
+#include "util/timing.h"
+#include "util/timing_bench.h"
+#include "util/trace.h"
+#include "bench/bench.h"
+#include "lvgl_port/lvgl_port.h"
+#include "lvgl_port/lvgl_bench.h"
 
 static const char *TAG = "app_main";
 static const int kMipiPhyMv = 2500;  // JD9365 PHY rail target (matches demo wiring)
+static const int kTouchRefreshMs = 5; // GT911 fastest report period (module default varies)
+static const bool kRunMenuBench = false; // replay canned touch sessions through the menu first
+static const uint32_t kLatencyLogEvery = 16; // touch->photon summary cadence (0 = silent)
+static const uint32_t kDemoBenchFrames = 0;   // >0: run every demo unpaced for N frames at boot
+static const bool kRunTimingBench = false;    // compare tick+spin vs timer sleep jitter at boot
+static const bool kRunMicroBench = false;     // ui_gfx/font/util/timing microbenchmarks vs baselines
+static const int kLvglBenchFrames = 0;        // >0: LVGL vs ui_gfx menu render/present, N frames each
+static const int kPresentFilterTile = 0;      // 32/64: skip unchanged tile rows on full-frame presents
+static const bool kMemReportBoot = true;      // per-component heap table once the touch/menu stack is up
+static const bool kTraceBoot = false;         // record boot + benches, then dump CBOR trace (needs CONFIG_UTIL_TRACE)
 
-void app_main(void)
-{
-    // Board: clocks, pins, carrier specifics.
-    board_init();
+/* ---- boot graph: stages share one context; each returns ESP_OK or why it failed ---- */
+typedef struct {
+    display_handle_t disp;
+    uint16_t        *fb;
+    int              W, H;         // board resolution (fb geometry)
+    touch_handle_t   touch;
+} boot_ctx_t;
 
-    // MIPI PHY rail: request ~2.5 V. Safe if carrier already powers it.
-    // Note: esp_ldo_enable_channel/disable_channel do not exist; see power_ldo.c.
+enum { ST_LDO, ST_ARENA, ST_JOBS, ST_FB, ST_PANEL, ST_SPLASH, ST_TOUCH, ST_ASSETS, ST_COUNT };
+
+// MIPI PHY rail: request ~2.5 V. Safe if carrier already powers it.
+// Note: esp_ldo_enable_channel/disable_channel do not exist; see power_ldo.c.
+static esp_err_t stage_ldo(void *arg)
+{
     esp_err_t err = power_ldo_enable_mipi_phy_mv(kMipiPhyMv);
     if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
         ESP_LOGE(TAG, "MIPI LDO setup failed: %s", esp_err_to_name(err));
         // Proceed: panel may already be powered by carrier.
     }
+    return ESP_OK;
+}
 
-    // Panel: init JD9365 via display module.
-    display_handle_t disp = NULL;
-    err = display_init(&disp);
-    if (err != ESP_OK || !disp) {
-        ESP_LOGE(TAG, "Display init failed: %s", esp_err_to_name(err));
-        abort();
+// Frame-loop memory: reserve arenas before anything fragments the heap.
+static esp_err_t stage_arena(void *arg)
+{
+    esp_err_t err = arena_init(NULL);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Arena reservation incomplete: %s", esp_err_to_name(err));
     }
+    return ESP_OK;
+}
+
+// Row-split workers on both HP cores; drawing falls back to one core if this fails.
+static esp_err_t stage_jobs(void *arg)
+{
+    return jobs_init(NULL);
+}
+
+// Framebuffer: PSRAM + DMA-capable when available; start from a known frame.
+// Sized from the board so it overlaps panel bring-up.
+static esp_err_t stage_fb(void *arg)
+{
+    boot_ctx_t *b = arg;
+    const size_t bytes = (size_t)b->W * (size_t)b->H * sizeof(uint16_t);
+    b->fb = (uint16_t *)util_malloc_psram_dma(bytes);
+    if (!b->fb) return ESP_ERR_NO_MEM;
+    memset(b->fb, 0x00, bytes);
+    return ESP_OK;
+}
+
+// Panel: init JD9365 via display module.
+static esp_err_t stage_panel(void *arg)
+{
+    boot_ctx_t *b = arg;
+    esp_err_t err = display_init(&b->disp);
+    if (err != ESP_OK) return err;
+    if (!b->disp) return ESP_FAIL;
 
-    const int W = display_width(disp);
-    const int H = display_height(disp);
+    const int W = display_width(b->disp);
+    const int H = display_height(b->disp);
+    if (W != b->W || H != b->H) {
+        ESP_LOGE(TAG, "Panel %dx%d does not match board %dx%d", W, H, b->W, b->H);
+        return ESP_ERR_INVALID_SIZE;
+    }
     ESP_LOGI(TAG, "Display online @ %dx%d (RGB565)", W, H);
+    display_latency_set_logging(b->disp, kLatencyLogEvery);
+    if (kPresentFilterTile) {
+        esp_err_t ferr = display_set_present_filter(b->disp, kPresentFilterTile);
+        if (ferr != ESP_OK) ESP_LOGW(TAG, "Present filter off: %s", esp_err_to_name(ferr));
+    }
+    return ESP_OK;
+}
+
+// First light: a cleared frame with one line of text, presented as soon as the panel is up.
+static esp_err_t stage_splash(void *arg)
+{
+    boot_ctx_t *b = arg;
+    static const char kText[] = "Starting...";
+    const int tw = (int)(sizeof(kText) - 1) * 6;
+    (void)ui_draw_text5x7(b->fb, b->W, b->H, (b->W - tw) / 2, b->H / 2 - 4, kText, 0xFFFF, 0x0000);
+    return display_draw_bitmap(b->disp, 0, 0, b->W, b->H, b->fb);
+}
+
+// Touch (GT9xx): I2C only, so it runs alongside the panel.
+static esp_err_t stage_touch(void *arg)
+{
+    boot_ctx_t *b = arg;
+    esp_err_t err = touch_gt9xx_init(&b->touch);
+    if (err != ESP_OK) return err;
+    if (!b->touch) return ESP_FAIL;
+
+    // Pin the report rate so input latency doesn't depend on the module's shipped config.
+    gt911_config_patch_t patch = GT911_CONFIG_PATCH_KEEP();
+    patch.refresh_ms = kTouchRefreshMs;
+    esp_err_t cerr = touch_gt9xx_configure(b->touch, &patch, NULL);
+    if (cerr != ESP_OK) {
+        ESP_LOGW(TAG, "Touch config left as shipped: %s", esp_err_to_name(cerr));
+    }
+    return ESP_OK;
+}
+
+// Assets: pre-render the menu tiles (no panel needed) so the first menu frame only blits.
+// After jobs, so the kernels it draws with see the worker pool either absent or fully up.
+static esp_err_t stage_assets(void *arg)
+{
+    boot_ctx_t *b = arg;
+    menu_prewarm(b->W, b->H);
+    return ESP_OK;
+}
+
+static const boot_stage_t kBootStages[ST_COUNT] = {
+    [ST_LDO]    = { "ldo",    stage_ldo,    0 },
+    [ST_ARENA]  = { "arena",  stage_arena,  0 },
+    [ST_JOBS]   = { "jobs",   stage_jobs,   0 },
+    [ST_FB]     = { "fb",     stage_fb,     BOOT_DEP(ST_ARENA) },
+    [ST_PANEL]  = { "panel",  stage_panel,  BOOT_DEP(ST_LDO), 6144 },
+    [ST_SPLASH] = { "splash", stage_splash, BOOT_DEP(ST_PANEL) | BOOT_DEP(ST_FB) },
+    [ST_TOUCH]  = { "touch",  stage_touch,  0 },
+    [ST_ASSETS] = { "assets", stage_assets, BOOT_DEP(ST_JOBS) },
+};
+
+void app_main(void)
+{
+    // Board: clocks, pins, carrier specifics.
+    board_init();
 
-    // Framebuffer: PSRAM + DMA-capable when available; start from a known frame.
-    const size_t npx   = (size_t)W * (size_t)H;
-    const size_t bytes = npx * sizeof(uint16_t);
-    uint16_t *fb = (uint16_t *)util_malloc_psram_dma(bytes);
-    if (!fb) {
-        ESP_LOGE(TAG, "Framebuffer alloc failed (%zu bytes)", bytes);
+    // Heap accounting: also hooks failed allocations so they show up in mem_dump().
+    (void)mem_init();
+
+    if (kTraceBoot) {
+        trace_start();
+    }
+
+    // Bring-up graph: panel, touch and asset prep overlap; splash as soon as the panel is up.
+    static boot_ctx_t boot;
+    static boot_report_t report;
+    board_panel_resolution(&boot.W, &boot.H);
+    esp_err_t err = boot_graph_run(kBootStages, ST_COUNT, &boot, &report);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Boot graph rejected: %s", esp_err_to_name(err));
+        abort();
+    }
+    boot_graph_log(kBootStages, ST_COUNT, &report);
+
+    if (report.stage[ST_PANEL].status != BOOT_STAGE_OK) {
+        ESP_LOGE(TAG, "Display init failed: %s", esp_err_to_name(report.stage[ST_PANEL].err));
+        abort();
+    }
+    if (report.stage[ST_FB].status != BOOT_STAGE_OK) {
+        ESP_LOGE(TAG, "Framebuffer alloc failed (%dx%d)", boot.W, boot.H);
         abort();
     }
-    memset(fb, 0x00, bytes);
-    (void)display_draw_bitmap(disp, 0, 0, W, H, fb);
 
-    // Touch (GT9xx): menu on success; otherwise fall back to light demos.
-    touch_handle_t touch = NULL;
-    err = touch_gt9xx_init(&touch);
-    if (err == ESP_OK && touch) {
+    display_handle_t disp = boot.disp;
+    uint16_t *fb = boot.fb;
+    const int W = boot.W;
+    const int H = boot.H;
+
+    // Optional: primitive-level cycle counts (uses fb as scratch, so run before the first real frame).
+    if (kRunMicroBench) {
+        bench_cfg_t mcfg = BENCH_CFG_DEFAULT();
+        const int regressions = bench_run_all(fb, W, H, &mcfg);
+        if (regressions) ESP_LOGW(TAG, "%d microbenchmark regression(s)", regressions);
+    }
+
+    // Optional: frame-pacing sleep jitter and CPU spin, old vs new sleep mode.
+    if (kRunTimingBench) {
+        timing_jitter_bench(16667, 300);
+    }
+
+    // Optional: unpaced per-demo frame statistics (graphics regression numbers).
+    if (kDemoBenchFrames > 0) {
+        demo_bench_cfg_t bcfg = DEMO_BENCH_CFG_DEFAULT();
+        bcfg.frames = kDemoBenchFrames;
+        bcfg.output = DEMO_BENCH_OUT_CSV;
+        demo_bench_run_all(disp, fb, &bcfg);
+    }
+
+    // Optional: scripted menu sessions with per-event render/present timings.
+    if (kRunMenuBench) {
+        err = menu_bench_run(disp, fb);
+        if (err != ESP_OK) ESP_LOGW(TAG, "menu bench: %s", esp_err_to_name(err));
+    }
+
+    // Optional: same launcher grid through LVGL and ui_gfx (LVGL stays paused afterwards).
+    if (kLvglBenchFrames > 0) {
+        lvgl_port_cfg_t lcfg = LVGL_PORT_CFG_DEFAULT();
+        err = lvgl_port_init(disp, &lcfg);
+        if (err == ESP_OK) {
+            lvgl_bench_run(disp, fb, kLvglBenchFrames);
+        } else {
+            ESP_LOGW(TAG, "LVGL port unavailable: %s", esp_err_to_name(err));
+        }
+    }
+
+    // Timeline of everything above; decode with tools/trace2chrome.py.
+    if (kTraceBoot) {
+        trace_export_console();
+    }
+
+    // Touch: menu on success; otherwise fall back to light demos.
+    touch_handle_t touch = boot.touch;
+    err = report.stage[ST_TOUCH].err;
+    if (report.stage[ST_TOUCH].status == BOOT_STAGE_OK) {
+        if (kMemReportBoot) mem_dump();
+
         // Menu owns interaction loop; returns only on error/exit.
         menu_draw(disp, fb);
+        ESP_LOGI(TAG, "Menu ready %llu us after app start", (unsigned long long)timing_now_us());
         menu_loop(disp, fb, touch);
         ESP_LOGW(TAG, "menu_loop returned; switching to demo carousel");
     } else {
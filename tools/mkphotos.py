@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""Pack JPEG photos into a PHOT blob for components/image (slideshow.h).
+
+    tools/mkphotos.py -o photos.bin --fit 800x1280 ~/Pictures/*.jpg
+    parttool.py write_partition --partition-name photos --input photos.bin
+
+The decoder on the device handles baseline JPEG only and scales by powers of
+two, so --fit re-encodes each photo (baseline, 4:2:0) at the panel size, or
+smaller keeping its aspect ratio. Without --fit, files are stored as they are
+and progressive ones are rejected. --fit needs Pillow.
+"""
+import argparse
+import io
+import struct
+import sys
+
+MAGIC = b"PHOT"
+VERSION = 1
+
+
+def sof_kind(data):
+    """Return the SOFn number of a JPEG, or None if there is no frame header."""
+    if data[:2] != b"\xff\xd8":
+        return None
+    i = 2
+    while i + 4 <= len(data):
+        if data[i] != 0xFF:
+            i += 1
+            continue
+        m = data[i + 1]
+        if m == 0xFF or m == 0x01 or 0xD0 <= m <= 0xD8:
+            i += 2 if m != 0xFF else 1
+            continue
+        if 0xC0 <= m <= 0xCF and m not in (0xC4, 0xC8, 0xCC):
+            return m - 0xC0
+        if m == 0xDA:
+            return None
+        i += 2 + struct.unpack(">H", data[i + 2:i + 4])[0]
+    return None
+
+
+def refit(path, size, quality):
+    from PIL import Image, ImageOps
+
+    img = ImageOps.exif_transpose(Image.open(path)).convert("RGB")
+    img.thumbnail(size, Image.LANCZOS)
+    out = io.BytesIO()
+    img.save(out, "JPEG", quality=quality, subsampling=2, progressive=False, optimize=True)
+    return out.getvalue()
+
+
+def pad4(b):
+    return b + b"\0" * (-len(b) % 4)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("photos", nargs="+")
+    ap.add_argument("-o", "--output", required=True)
+    ap.add_argument("--fit", help="WxH: re-encode to fit the panel (recommended)")
+    ap.add_argument("--quality", type=int, default=90)
+    args = ap.parse_args()
+
+    size = tuple(int(v) for v in args.fit.split("x")) if args.fit else None
+    files = []
+    for path in args.photos:
+        if size:
+            data = refit(path, size, args.quality)
+        else:
+            with open(path, "rb") as f:
+                data = f.read()
+        kind = sof_kind(data)
+        if kind not in (0, 1):
+            sys.exit("%s: not a baseline JPEG (SOF%s); use --fit" % (path, kind))
+        files.append(data)
+
+    n = len(files)
+    off = len(MAGIC) + 4 + 8 * n
+    off += -off % 4
+    table, body = bytearray(), bytearray()
+    for data in files:
+        table += struct.pack("<II", off + len(body), len(data))
+        body += pad4(data)
+
+    header = MAGIC + struct.pack("<HH", VERSION, n) + bytes(table)
+    with open(args.output, "wb") as f:
+        f.write(pad4(header) + bytes(body))
+    print("%d photos, %d bytes, largest %d" % (n, len(pad4(header)) + len(body), max(len(d) for d in files)))
+
+
+if __name__ == "__main__":
+    main()
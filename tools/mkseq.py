@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""Pack image frames into an ISEQ blob for components/image (img_seq.h).
+
+    tools/mkseq.py -o anim.bin --fps 30 frame_*.png
+    parttool.py write_partition --partition-name anim --input anim.bin
+
+Frame 0 (and every --key-every'th frame) is stored raw; the rest are deltas:
+changed rows are grouped into bands, each band is trimmed to its changed
+columns and stored either raw (zero-copy on target) or run-coded, whichever
+is smaller. Needs Pillow for image input.
+"""
+import argparse
+import struct
+import sys
+
+from PIL import Image
+
+MAGIC = b"ISEQ"
+VERSION = 1
+KIND_RAW, KIND_DELTA = 0, 1
+RECT_RAW = 0x0001
+BAND_GAP = 4  # unchanged rows tolerated inside one band
+
+
+def to565(img, size):
+    img = img.convert("RGB")
+    if img.size != size:
+        img = img.resize(size)
+    px = img.load()
+    w, h = size
+    out = []
+    for y in range(h):
+        for x in range(w):
+            r, g, b = px[x, y]
+            out.append(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+    return out
+
+
+def pad4(b):
+    return b + b"\0" * (-len(b) % 4)
+
+
+def encode_runs(pix):
+    out = bytearray()
+    i, n = 0, len(pix)
+    while i < n:
+        j = i
+        while j < n and pix[j] == pix[i] and j - i < 0x7FFF:
+            j += 1
+        if j - i >= 3:
+            out += struct.pack("<HH", 0x8000 | (j - i), pix[i])
+            i = j
+            continue
+        j = i
+        while j < n and j - i < 0x7FFF and not (j + 2 < n and pix[j] == pix[j + 1] == pix[j + 2]):
+            j += 1
+        out += struct.pack("<H", j - i) + struct.pack("<%dH" % (j - i), *pix[i:j])
+        i = j
+    return bytes(out)
+
+
+def changed_bands(prev, cur, w, h):
+    rows = [y for y in range(h) if prev[y * w:(y + 1) * w] != cur[y * w:(y + 1) * w]]
+    bands = []
+    for y in rows:
+        if bands and y - bands[-1][1] <= BAND_GAP:
+            bands[-1][1] = y
+        else:
+            bands.append([y, y])
+    for y0, y1 in bands:
+        x0, x1 = w, -1
+        for y in range(y0, y1 + 1):
+            for x in range(w):
+                if prev[y * w + x] != cur[y * w + x]:
+                    x0, x1 = min(x0, x), max(x1, x)
+        yield x0, y0, x1 - x0 + 1, y1 - y0 + 1
+
+
+def encode_delta(prev, cur, w, h):
+    rects = []
+    for x, y, rw, rh in changed_bands(prev, cur, w, h):
+        pix = [cur[(y + r) * w + x + c] for r in range(rh) for c in range(rw)]
+        runs = encode_runs(pix)
+        raw = struct.pack("<%dH" % len(pix), *pix)
+        flags, payload = (RECT_RAW, raw) if len(raw) <= len(runs) else (0, runs)
+        rects.append(struct.pack("<HHHHHHI", x, y, rw, rh, flags, 0, len(payload)) + pad4(payload))
+    return struct.pack("<HH", len(rects), 0) + b"".join(rects)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("frames", nargs="+")
+    ap.add_argument("-o", "--output", required=True)
+    ap.add_argument("--fps", type=float, default=30.0)
+    ap.add_argument("--size", help="WxH (default: first frame's size)")
+    ap.add_argument("--key-every", type=int, default=0, help="store every Nth frame raw (0 = first only)")
+    args = ap.parse_args()
+
+    first = Image.open(args.frames[0])
+    size = tuple(int(v) for v in args.size.split("x")) if args.size else first.size
+    w, h = size
+
+    blobs, prev = [], None
+    for i, path in enumerate(args.frames):
+        cur = to565(Image.open(path), size)
+        key = prev is None or (args.key_every and i % args.key_every == 0)
+        if key:
+            blobs.append((KIND_RAW, struct.pack("<%dH" % len(cur), *cur)))
+        else:
+            blobs.append((KIND_DELTA, encode_delta(prev, cur, w, h)))
+        prev = cur
+
+    n = len(blobs)
+    header = MAGIC + struct.pack("<HHHHI", VERSION, w, h, n, int(1e6 / args.fps))
+    off = len(header) + 12 * n
+    off += -off % 4
+    table, body = bytearray(), bytearray()
+    for kind, data in blobs:
+        table += struct.pack("<IIB3x", off + len(body), len(data), kind)
+        body += pad4(data)
+    out = header + table + b"\0" * (-(len(header) + len(table)) % 4) + body
+    with open(args.output, "wb") as f:
+        f.write(out)
+    raw = 2 * w * h * n
+    print("%s: %d frames %dx%d, %d bytes (%.1f%% of raw)" % (args.output, n, w, h, len(out), 100.0 * len(out) / raw),
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
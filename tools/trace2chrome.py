@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Convert a util/trace console dump into Chrome trace JSON.
+
+    idf.py monitor | tee boot.log          # CONFIG_UTIL_TRACE=y and kTraceBoot = true
+    tools/trace2chrome.py boot.log -o boot.json
+
+Open the JSON in chrome://tracing or https://ui.perfetto.dev. Each core is a
+thread; BEGIN/END become slices, COUNTER a counter track, INSTANT a marker.
+Only stdlib is needed (the CBOR subset used by the exporter is decoded here).
+"""
+import argparse
+import json
+import sys
+
+EV_BEGIN, EV_END, EV_COUNTER, EV_INSTANT = range(4)
+
+
+def cbor_decode(buf, i=0):
+    """Decode one item (uint, negint, text, array) starting at i; returns (value, next_i)."""
+    ib = buf[i]
+    major, info = ib >> 5, ib & 0x1F
+    i += 1
+    if info < 24:
+        arg = info
+    elif info in (24, 25, 26, 27):
+        n = 1 << (info - 24)
+        arg = int.from_bytes(buf[i:i + n], "big")
+        i += n
+    else:
+        raise ValueError("unsupported CBOR additional info %d" % info)
+    if major == 0:
+        return arg, i
+    if major == 1:
+        return -1 - arg, i
+    if major == 3:
+        return buf[i:i + arg].decode("utf-8", "replace"), i + arg
+    if major == 4:
+        out = []
+        for _ in range(arg):
+            v, i = cbor_decode(buf, i)
+            out.append(v)
+        return out, i
+    raise ValueError("unsupported CBOR major type %d" % major)
+
+
+def read_events(lines):
+    events, inside = [], False
+    for line in lines:
+        # Tolerate monitor prefixes/colour codes before the marker.
+        k = line.find("TRACE")
+        if k < 0:
+            continue
+        line = line[k:].strip()
+        if line.startswith("TRACE-BEGIN"):
+            inside, events = True, []
+            print(line, file=sys.stderr)
+        elif line.startswith("TRACE-END"):
+            inside = False
+            print(line, file=sys.stderr)
+        elif inside and line.startswith("TRACE "):
+            chunk, _ = cbor_decode(bytes.fromhex(line[6:]))
+            events.extend(chunk)
+    return events
+
+
+def to_chrome(events):
+    out = []
+    for etype, core, t_us, name, value in sorted(events, key=lambda e: e[2]):
+        ev = {"name": name, "pid": 0, "tid": core, "ts": t_us}
+        if etype == EV_BEGIN:
+            ev["ph"] = "B"
+        elif etype == EV_END:
+            ev["ph"] = "E"
+        elif etype == EV_COUNTER:
+            ev.update(ph="C", args={name: value})
+        else:
+            ev.update(ph="i", s="t")
+        out.append(ev)
+    meta = [{"name": "thread_name", "ph": "M", "pid": 0, "tid": c, "args": {"name": "core %d" % c}}
+            for c in sorted({e[1] for e in events})]
+    return {"traceEvents": meta + out, "displayTimeUnit": "ms"}
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("log", help="captured console output ('-' for stdin)")
+    ap.add_argument("-o", "--output", default="-")
+    args = ap.parse_args()
+
+    src = sys.stdin if args.log == "-" else open(args.log, encoding="utf-8", errors="replace")
+    events = read_events(src)
+    if not events:
+        sys.exit("no TRACE-BEGIN/TRACE lines found")
+    doc = json.dumps(to_chrome(events))
+    if args.output == "-":
+        print(doc)
+    else:
+        with open(args.output, "w") as f:
+            f.write(doc)
+    print("%d events" % len(events), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()